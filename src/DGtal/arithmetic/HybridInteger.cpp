@@ -0,0 +1,38 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file HybridInteger.cpp
+ *
+ * @date 2026/10/18
+ *
+ * Implementation of methods defined in HybridInteger.h
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include "DGtal/arithmetic/HybridInteger.h"
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_BIGINTEGER
+namespace DGtal
+{
+  //Constant definitions in NumberTraits specializations.
+  const DGtal::HybridInteger NumberTraits<DGtal::HybridInteger>::ONE = 1;
+  const DGtal::HybridInteger NumberTraits<DGtal::HybridInteger>::ZERO = 0;
+}
+#endif
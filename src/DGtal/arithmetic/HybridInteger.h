@@ -0,0 +1,366 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file HybridInteger.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module HybridInteger.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(HybridInteger_RECURSES)
+#error Recursive header files inclusion detected in HybridInteger.h
+#else // defined(HybridInteger_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define HybridInteger_RECURSES
+
+#if !defined HybridInteger_h
+/** Prevents repeated inclusion of headers. */
+#define HybridInteger_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_unsigned.hpp>
+#include <boost/utility/enable_if.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/NumberTraits.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_BIGINTEGER
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class HybridInteger
+  /**
+   * Description of class 'HybridInteger' <p>
+   * \brief Aim: A signed integer of arbitrary size, stored and computed
+   * as a native 64-bit integer as long as it fits, and as a
+   * DGtal::BigInteger otherwise.
+   *
+   * Each operation on two native values is computed natively and
+   * checked for overflow (with the compiler builtins
+   * __builtin_add_overflow, __builtin_sub_overflow and
+   * __builtin_mul_overflow when available). Only when the result
+   * does not fit in 64 bits is it computed again with GMP and stored
+   * as a BigInteger. Conversely, a BigInteger result that fits in 64
+   * bits is stored natively. Results are thus always exact, as with
+   * BigInteger, but are almost as fast as with DGtal::int64_t when
+   * values are small, which is the most frequent case.
+   *
+   * It is a model of CInteger, and can be used as the integer type of
+   * the arithmetical DSSs and DSLs, and of their recognition
+   * algorithms, as well as the internal integer type of the plane
+   * recognition algorithms:
+   * @code
+   typedef ArithmeticalDSSComputer<std::vector<Z2i::Point>::const_iterator,
+                                   HybridInteger, 4> DSSComputer;
+   typedef COBANaivePlaneComputer<Z3i::Space, HybridInteger> PlaneComputer;
+   * @endcode
+   *
+   * Division and remainder round toward zero, as for the built-in
+   * integer types and BigInteger.
+   *
+   * @note This class is only available when DGtal is built with GMP
+   * (i.e. if WITH_BIGINTEGER is defined).
+   *
+   * @see NumberTraits, IntegerComputer, testHybridInteger.cpp
+   */
+  class HybridInteger
+  {
+  public:
+    /// The native integer type.
+    typedef DGtal::int64_t Native;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Destructor.
+     */
+    ~HybridInteger();
+
+    /**
+     * Constructor. The value is zero.
+     */
+    HybridInteger();
+
+    /**
+     * Constructor from any built-in integer.
+     * @param aValue any integer.
+     */
+    template <typename T>
+    HybridInteger( T aValue,
+                   typename boost::enable_if_c< boost::is_integral<T>::value >::type* = 0 );
+
+    /**
+     * Constructor from a big integer.
+     * @param aValue any big integer.
+     */
+    explicit HybridInteger( const BigInteger & aValue );
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     */
+    HybridInteger( const HybridInteger & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     */
+    HybridInteger & operator=( const HybridInteger & other );
+
+    /**
+     * Move constructor.
+     * @param other the object to move.
+     */
+    HybridInteger( HybridInteger && other );
+
+    /**
+     * Move assignment.
+     * @param other the object to move.
+     * @return a reference on 'this'.
+     */
+    HybridInteger & operator=( HybridInteger && other );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /**
+     * @return 'true' if the value is stored as a native integer.
+     */
+    bool isNative() const;
+
+    /**
+     * @pre isNative()
+     * @return the native value.
+     */
+    Native native() const;
+
+    /**
+     * @return the value as a big integer.
+     */
+    BigInteger toBigInteger() const;
+
+    /**
+     * @return the value as a double.
+     */
+    double toDouble() const;
+
+    /**
+     * Conversion to a built-in integer type (the value should fit in it).
+     * @return the value.
+     */
+    template <typename T,
+              typename = typename boost::enable_if_c< boost::is_integral<T>::value >::type>
+    explicit operator T() const;
+
+    // ----------------------- Arithmetic -------------------------------------
+  public:
+
+    HybridInteger & operator+=( const HybridInteger & other );
+    HybridInteger & operator-=( const HybridInteger & other );
+    HybridInteger & operator*=( const HybridInteger & other );
+    HybridInteger & operator/=( const HybridInteger & other );
+    HybridInteger & operator%=( const HybridInteger & other );
+    HybridInteger & operator++();
+    HybridInteger & operator--();
+    HybridInteger operator++( int );
+    HybridInteger operator--( int );
+    HybridInteger operator-() const;
+    HybridInteger operator+() const;
+
+    /**
+     * Three-way comparison.
+     * @param a any integer.
+     * @param b any integer.
+     * @return a negative number, zero or a positive number when @a a
+     * is respectively less, equal or greater than @a b.
+     */
+    static int compare( const HybridInteger & a, const HybridInteger & b );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Stores a big value, natively if it fits.
+     * @param aValue any big integer.
+     */
+    void setBig( const BigInteger & aValue );
+
+    /**
+     * Stores a native value.
+     * @param aValue any native integer.
+     */
+    void setNative( Native aValue );
+
+    /**
+     * @param aValue any native integer.
+     * @return the same value as a big integer.
+     */
+    static BigInteger toBig( Native aValue );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The value, when native.
+    Native myNative;
+    /// The value, when big, or 0 when native.
+    BigInteger * myBig;
+
+  }; // end of class HybridInteger
+
+  HybridInteger operator+( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator-( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator*( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator/( const HybridInteger & a, const HybridInteger & b );
+  HybridInteger operator%( const HybridInteger & a, const HybridInteger & b );
+  bool operator==( const HybridInteger & a, const HybridInteger & b );
+  bool operator!=( const HybridInteger & a, const HybridInteger & b );
+  bool operator<( const HybridInteger & a, const HybridInteger & b );
+  bool operator<=( const HybridInteger & a, const HybridInteger & b );
+  bool operator>( const HybridInteger & a, const HybridInteger & b );
+  bool operator>=( const HybridInteger & a, const HybridInteger & b );
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'HybridInteger'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'HybridInteger' to write.
+   * @return the output stream after the writing.
+   */
+  std::ostream&
+  operator<< ( std::ostream & out, const HybridInteger & object );
+
+
+  /**
+   * Specialization for DGtal::HybridInteger. As for DGtal::BigInteger,
+   * it represents signed and unsigned arbitrary-size integers, therefore
+   * both IsUnsigned and IsSigned are TagTrue.
+   */
+  template <>
+  struct NumberTraits<DGtal::HybridInteger>
+  {
+    typedef TagTrue IsIntegral;
+    typedef TagFalse IsBounded;
+    typedef TagTrue IsUnsigned;
+    typedef TagTrue IsSigned;
+    typedef TagTrue IsSpecialized;
+    typedef DGtal::HybridInteger SignedVersion;
+    typedef DGtal::HybridInteger UnsignedVersion;
+    typedef DGtal::HybridInteger ReturnType;
+    typedef const DGtal::HybridInteger & ParamType;
+    static const DGtal::HybridInteger ZERO;
+    static const DGtal::HybridInteger ONE;
+    static ReturnType zero()
+    {
+      return ZERO;
+    }
+    static ReturnType one()
+    {
+      return ONE;
+    }
+    static ReturnType min()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support min() function");
+      return ZERO;
+    }
+    static ReturnType max()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support max() function");
+      return ZERO;
+    }
+    static unsigned int digits()
+    {
+      FATAL_ERROR_MSG(false, "UnBounded interger type does not support digits() function");
+      return 0;
+    }
+    static BoundEnum isBounded()
+    {
+      return UNBOUNDED;
+    }
+    static SignEnum isSigned()
+    {
+      return SIGNED;
+    }
+    static DGtal::int64_t castToInt64_t( const DGtal::HybridInteger & aT )
+    {
+      return aT.isNative() ? aT.native() : aT.toBigInteger().get_si();
+    }
+    static double castToDouble( const DGtal::HybridInteger & aT )
+    {
+      return aT.toDouble();
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is even.
+    */
+    static bool even( ParamType aT )
+    {
+      return aT.isNative() ? ( ( aT.native() & 1 ) == 0 )
+                           : mpz_even_p( aT.toBigInteger().get_mpz_t() );
+    }
+    /**
+       @param aT any number.
+       @return 'true' iff the number is odd.
+    */
+    static bool odd( ParamType aT )
+    {
+      return ! even( aT );
+    }
+  }; // end of class NumberTraits<DGtal::HybridInteger>.
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/arithmetic/HybridInteger.ih"
+
+#endif // WITH_BIGINTEGER
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined HybridInteger_h
+
+#undef HybridInteger_RECURSES
+#endif // else defined(HybridInteger_RECURSES)
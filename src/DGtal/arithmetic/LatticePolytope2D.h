@@ -77,6 +77,10 @@ namespace DGtal
 
      @tparam TSpace an arbitrary 2-dimensional model of CSpace.
      @tparam TSequence a model of boost::Sequence whose elements are points (TSpace::Point). Default is list of points.
+     A contiguous sequence like std::vector is also valid (push_front
+     and pushFront are then not available): cuts erase and insert
+     vertices by ranges, and copies reuse the already allocated memory,
+     which is faster for the small polygons met in practice.
    */
   template < typename TSpace, 
              typename TSequence = std::list< typename TSpace::Point > >
@@ -360,6 +364,19 @@ namespace DGtal
      */
     bool cut( const HalfSpace & hs );
 
+    /**
+       Cuts the lattice polytope with each half-space constraint of
+       the range [ \a itb, \a ite ), in this order. Stops as soon as
+       the polytope is empty.
+
+       @param itb begin iterator on half-space constraints.
+       @param ite end iterator on half-space constraints.
+       @return the number of cuts that modified the polygon.
+       @tparam HalfSpaceIterator a model of input iterator on HalfSpace.
+     */
+    template <typename HalfSpaceIterator>
+    Size cut( HalfSpaceIterator itb, HalfSpaceIterator ite );
+
     /**
        Computes the constraint of the form N.P<=c whose supporting
        line passes through point *it and *(it+1), such that the other
@@ -536,7 +553,7 @@ namespace DGtal
     mutable Integer _a, _b, _c, _c1, _c3, _den, _g, _fl, _ce;
     mutable Point _A, _B, _A1, _B1, _A2, _B2;
     mutable Vector _N, _DV, _u, _v;
-    mutable std::vector<Point> _inPts, _outPts;
+    mutable std::vector<Point> _inPts, _outPts, _newPts;
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -164,6 +164,22 @@ namespace functors
     {
       return aT;
     }
+
+    /**
+     * Span form: copies the values of [ @a first, @a last ) into @a out.
+     * @param first begin iterator on the input values.
+     * @param last end iterator on the input values.
+     * @param out output iterator.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    inline
+    TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      for ( ; first != last; ++first, ++out )
+        *out = *first;
+      return out;
+    }
   };
 
   /**
@@ -270,6 +286,22 @@ namespace functors
     {
       return static_cast<TOutput>(aInput);
     }
+
+    /**
+     * Span form: casts the values of [ @a first, @a last ) into @a out.
+     * @param first begin iterator on the input values.
+     * @param last end iterator on the input values.
+     * @param out output iterator.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    inline
+    TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      for ( ; first != last; ++first, ++out )
+        *out = static_cast<TOutput>( *first );
+      return out;
+    }
   };
 
 
@@ -388,6 +420,22 @@ class Thresholder
       std::less_equal<Input> c;
       return c(aI,myT);
     }
+
+    /**
+     * Span form: compares each value of [ @a first, @a last ) to the threshold.
+     * @param first begin iterator on the input values.
+     * @param last end iterator on the input values.
+     * @param out output iterator.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    inline
+    TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      for ( ; first != last; ++first, ++out )
+        *out = ( *first <= myT );
+      return out;
+    }
   private:
     /**
      * Threshold value
@@ -414,6 +462,22 @@ struct Thresholder<T,false,false>
     return c(aI,myT);
     }
 
+    /**
+     * Span form: compares each value of [ @a first, @a last ) to the threshold.
+     * @param first begin iterator on the input values.
+     * @param last end iterator on the input values.
+     * @param out output iterator.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    inline
+    TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      for ( ; first != last; ++first, ++out )
+        *out = ( *first > myT );
+      return out;
+    }
+
   private:
     Input myT;
 };
@@ -433,6 +497,22 @@ struct Thresholder<T,false,true>
     return c(aI,myT);
     }
 
+    /**
+     * Span form: compares each value of [ @a first, @a last ) to the threshold.
+     * @param first begin iterator on the input values.
+     * @param last end iterator on the input values.
+     * @param out output iterator.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    inline
+    TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      for ( ; first != last; ++first, ++out )
+        *out = ( *first >= myT );
+      return out;
+    }
+
   private:
     Input myT;
 };
@@ -454,6 +534,22 @@ struct Thresholder<T,true,false>
     return c(aI,myT);
     }
 
+    /**
+     * Span form: compares each value of [ @a first, @a last ) to the threshold.
+     * @param first begin iterator on the input values.
+     * @param last end iterator on the input values.
+     * @param out output iterator.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    inline
+    TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      for ( ; first != last; ++first, ++out )
+        *out = ( *first < myT );
+      return out;
+    }
+
   private:
     Input myT;
 };
@@ -475,6 +571,22 @@ struct Thresholder<T,true,true>
     return c(aI,myT);
     }
 
+    /**
+     * Span form: compares each value of [ @a first, @a last ) to the threshold.
+     * @param first begin iterator on the input values.
+     * @param last end iterator on the input values.
+     * @param out output iterator.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    inline
+    TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      for ( ; first != last; ++first, ++out )
+        *out = ( *first <= myT );
+      return out;
+    }
+
   private:
     Input myT;
 };
@@ -603,6 +715,22 @@ public:
   {
     return myPred(aI);
   }
+
+  /**
+   * Span form: compares each value of [ @a first, @a last ) to the interval.
+   * @param first begin iterator on the input values.
+   * @param last end iterator on the input values.
+   * @param out output iterator.
+   * @return the output iterator past the last written value.
+   */
+  template <typename TInputIterator, typename TOutputIterator>
+  inline
+  TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+  {
+    for ( ; first != last; ++first, ++out )
+      *out = myTlow( *first ) && myTup( *first );
+    return out;
+  }
 private:
   /**
    * First thresholder
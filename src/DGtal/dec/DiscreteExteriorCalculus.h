@@ -44,6 +44,8 @@
 #include <vector>
 #include <map>
 #include <list>
+#include <algorithm>
+#include <boost/cstdint.hpp>
 #include <boost/array.hpp>
 #include <boost/unordered_map.hpp>
 #include "DGtal/kernel/SpaceND.h"
@@ -53,6 +55,7 @@
 #include "DGtal/dec/Duality.h"
 #include "DGtal/dec/KForm.h"
 #include "DGtal/dec/LinearOperator.h"
+#include "DGtal/dec/MatrixFreeLinearOperator.h"
 #include "DGtal/dec/VectorField.h"
 #include "DGtal/base/ConstAlias.h"
 
@@ -167,6 +170,18 @@ namespace DGtal
     typedef std::vector<SCell> SCells;
     typedef boost::array<SCells, dimEmbedded+1> IndexedSCells;
 
+    /**
+     * Orderings of the cell indexes.
+     * @var IndexOrdering::HASH_ORDER
+     * Cells are indexed in the traversal order of the properties map (default).
+     * @var IndexOrdering::MORTON_ORDER
+     * Cells are indexed along the Morton (Z-order) curve of their Khalimsky coordinates.
+     * @var IndexOrdering::REVERSE_CUTHILL_MCKEE_ORDER
+     * Cells are indexed by the reverse Cuthill-McKee algorithm on the graph of cells sharing a face or a coface,
+     * which reduces the bandwidth of operators.
+     */
+    enum IndexOrdering { HASH_ORDER, MORTON_ORDER, REVERSE_CUTHILL_MCKEE_ORDER };
+
     /**
      * Vector field typedefs.
      */
@@ -333,6 +348,22 @@ namespace DGtal
     void
     updateIndexes();
 
+    /**
+     * Set the ordering of cell indexes and update indexes accordingly.
+     * The ordering is kept by subsequent updateIndexes() calls.
+     * Kforms and operators created before must be recreated.
+     * @param ordering new ordering of cell indexes.
+     */
+    void
+    reorderIndexes(const IndexOrdering& ordering);
+
+    /**
+     * Get the ordering of cell indexes.
+     * @return ordering of cell indexes.
+     */
+    IndexOrdering
+    indexOrdering() const;
+
     /**
      * Get all cells properties.
      * @return associative container from Cell to Property.
@@ -410,6 +441,46 @@ namespace DGtal
     LinearOperator<Self, order, duality, dimEmbedded-order, OppositeDuality<duality>::duality>
     hodge() const;
 
+    /**
+     * Matrix free derivative operator from _order_-forms to _(order+1)_-forms.
+     * Stores the signed incident cells of each output cell instead of a sparse matrix.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @return matrix free derivative operator.
+     */
+    template <Order order, Duality duality>
+    MatrixFreeLinearOperator<Self, order, duality, order+1, duality>
+    matrixFreeDerivative() const;
+
+    /**
+     * Matrix free antiderivative operator from _order_-forms to _(order-1)_-forms.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @return matrix free antiderivative operator.
+     */
+    template <Order order, Duality duality>
+    MatrixFreeLinearOperator<Self, order, duality, order-1, duality>
+    matrixFreeAntiderivative() const;
+
+    /**
+     * Matrix free laplace operator from duality 0-forms to duality 0-forms.
+     * Its single stencil is computed cell by cell, without any sparse matrix product.
+     * @return matrix free Laplace operator.
+     */
+    template <Duality duality>
+    MatrixFreeLinearOperator<Self, 0, duality, 0, duality>
+    matrixFreeLaplace() const;
+
+    /**
+     * Matrix free hodge operator from duality _order_-form to opposite duality _(dimEmbedded-order)_-forms.
+     * @tparam order order of input k-form.
+     * @tparam duality duality of input k-form.
+     * @return matrix free hodge operator.
+     */
+    template <Order order, Duality duality>
+    MatrixFreeLinearOperator<Self, order, duality, dimEmbedded-order, OppositeDuality<duality>::duality>
+    matrixFreeHodge() const;
+
     /**
      * Construct 1-form from vector field.
      * @tparam duality input vector field and output 1-form duality.
@@ -566,6 +637,28 @@ namespace DGtal
      */
     bool myIndexesNeedUpdate;
 
+    /**
+     * Ordering of cell indexes.
+     */
+    IndexOrdering myIndexOrdering;
+
+    /**
+     * Kinds of cached operator matrixes.
+     */
+    enum CachedOperator { DERIVATIVE_OPERATOR, ANTIDERIVATIVE_OPERATOR, HODGE_OPERATOR, LAPLACE_OPERATOR };
+
+    /**
+     * Cached operator matrixes, indexed by kind, duality and order.
+     * Filled on first request, cleared when the structure, the sizes or the indexes change.
+     * Requesting operators concurrently from several threads is thus not safe.
+     */
+    mutable boost::array<boost::array<boost::array<SparseMatrix, dimEmbedded+1>, 2>, 4> myOperatorMatrixes;
+
+    /**
+     * Validity flags of cached operator matrixes.
+     */
+    mutable boost::array<boost::array<boost::array<bool, dimEmbedded+1>, 2>, 4> myOperatorMatrixesValid;
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -579,6 +672,45 @@ namespace DGtal
     void
     updateCachedOperators();
 
+    /**
+     * Invalidate the cached derivative, antiderivative, hodge and laplace matrixes.
+     */
+    void
+    clearCachedOperatorMatrixes();
+
+    /**
+     * Reindex cells of dimension @a dim.
+     * @param dim dimension of reindexed cells.
+     * @param new_order current indexes of cells in new index order.
+     */
+    void
+    reorderIndexedSCells(const Dimension& dim, const std::vector<Index>& new_order);
+
+    /**
+     * Compute the reverse Cuthill-McKee ordering of cells of dimension @a dim.
+     * @param dim dimension of ordered cells.
+     * @param incidences incidence matrixes of cells of each positive dimension, see incidenceMatrix().
+     * @return current indexes of cells in new index order.
+     */
+    std::vector<Index>
+    reverseCuthillMcKeeOrder(const Dimension& dim, const boost::array<SparseMatrix, dimEmbedded+1>& incidences) const;
+
+    /**
+     * Compute the incidence matrix between cells of dimension @a dim and their faces in the calculus.
+     * @param dim dimension of cells, must be positive.
+     * @return sparse matrix with one row per cell and one column per face.
+     */
+    SparseMatrix
+    incidenceMatrix(const Dimension& dim) const;
+
+    /**
+     * Compute the Morton ordering of cells of dimension @a dim.
+     * @param dim dimension of ordered cells.
+     * @return current indexes of cells in new index order.
+     */
+    std::vector<Index>
+    mortonOrder(const Dimension& dim) const;
+
     /**
      * Update flat operator cache.
      * @tparam duality duality of updated flat operator.
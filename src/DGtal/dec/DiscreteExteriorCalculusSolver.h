@@ -46,6 +46,7 @@
 #include "DGtal/base/Clone.h"
 #include "DGtal/dec/KForm.h"
 #include "DGtal/dec/LinearOperator.h"
+#include "DGtal/math/linalg/EigenSupport.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -58,6 +59,12 @@ namespace DGtal
    * \brief Aim:
    * This wraps a linear algebra solver around a discrete exterior calculus.
    *
+   * Operators sharing the same sparsity pattern, e.g. implicit time steps
+   * of various sizes, are solved with one call to analyzePattern() followed
+   * by factorize() for each of them. Iterative solvers (e.g. Eigen conjugate
+   * gradient) keep a reference to the last factorized operator, which must
+   * outlive the solves.
+   *
    * @tparam TCalculus should be DiscreteExteriorCalculus.
    * @tparam TLinearAlgebraSolver should be a model of CLinearAlgebraSolver.
    * @tparam order_in is the input order of the linear problem.
@@ -81,6 +88,7 @@ namespace DGtal
     typedef LinearOperator<Calculus, order_in, duality_in, order_out, duality_out> Operator;
     typedef KForm<Calculus, order_in, duality_in> SolutionKForm;
     typedef KForm<Calculus, order_out, duality_out> InputKForm;
+    typedef typename Calculus::DenseMatrix DenseMatrix;
 
     /**
      * Constructor.
@@ -112,6 +120,25 @@ namespace DGtal
      */
     DiscreteExteriorCalculusSolver& compute(const Operator& linear_operator);
 
+    /**
+     * Symbolic analysis of the problem operator, e.g. fill-reducing ordering
+     * and elimination tree of sparse factorizations. Only depends on the
+     * sparsity pattern of the operator: once done, operators sharing the same
+     * pattern (e.g. other time steps or frequencies) are passed to factorize().
+     * The linear algebra solver must provide analyzePattern().
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& analyzePattern(const Operator& linear_operator);
+
+    /**
+     * Numerical factorization of an operator with the pattern of the last
+     * call to analyzePattern(). The linear algebra solver must provide factorize().
+     * @param linear_operator linear operator.
+     * @return *this.
+     */
+    DiscreteExteriorCalculusSolver& factorize(const Operator& linear_operator);
+
     /**
      * Solve prefactorized / set problem input.
      * @param input_kform input k-form.
@@ -119,6 +146,23 @@ namespace DGtal
      */
     SolutionKForm solve(const InputKForm& input_kform) const;
 
+    /**
+     * Solve prefactorized / set problem input, starting iterative solvers
+     * from an initial guess, e.g. the solution of the previous time step.
+     * The guess is ignored by direct solvers.
+     * @param input_kform input k-form.
+     * @param guess_kform initial guess of the solution.
+     * @return problem solution.
+     */
+    SolutionKForm solve(const InputKForm& input_kform, const SolutionKForm& guess_kform) const;
+
+    /**
+     * Solve prefactorized / set problem for a block of inputs at once.
+     * @param input_kforms matrix whose columns are the containers of the input k-forms.
+     * @return matrix whose columns are the containers of the solution k-forms.
+     */
+    DenseMatrix solve(const DenseMatrix& input_kforms) const;
+
     /**
      * Checks the validity/consistency of the object.
      * @return 'true' if the object is valid, 'false' otherwise.
@@ -137,6 +181,54 @@ namespace DGtal
   }; // end of class DiscreteExteriorCalculusSolver
 
 
+  /**
+   * Called by DiscreteExteriorCalculusSolver::compute before the linear
+   * algebra solver computation. Does nothing by default, solvers that
+   * need the structure of the calculus, such as GeometricMultigridSolver,
+   * overload it.
+   * @param solver linear algebra solver.
+   * @param linear_operator solved operator.
+   */
+  template <typename TLinearAlgebraSolver, typename TLinearOperator>
+  void
+  bindLinearAlgebraSolver(TLinearAlgebraSolver& solver, const TLinearOperator& linear_operator);
+
+  /**
+   * Called by DiscreteExteriorCalculusSolver::solve with an initial guess.
+   * Ignores the guess by default, iterative solvers overload it.
+   * @param solver linear algebra solver.
+   * @param input right hand side.
+   * @param guess initial guess of the solution.
+   * @return solution.
+   */
+  template <typename TLinearAlgebraSolver, typename TDenseVector>
+  TDenseVector
+  solveLinearAlgebraSolverWithGuess(const TLinearAlgebraSolver& solver, const TDenseVector& input, const TDenseVector& guess);
+
+#if defined(WITH_EIGEN)
+  /**
+   * Starts Eigen conjugate gradient from an initial guess.
+   * @param solver linear algebra solver.
+   * @param input right hand side.
+   * @param guess initial guess of the solution.
+   * @return solution.
+   */
+  template <typename TMatrix, int UpLo, typename TPreconditioner, typename TDenseVector>
+  TDenseVector
+  solveLinearAlgebraSolverWithGuess(const Eigen::ConjugateGradient<TMatrix, UpLo, TPreconditioner>& solver, const TDenseVector& input, const TDenseVector& guess);
+
+  /**
+   * Starts Eigen biconjugate gradient stabilized from an initial guess.
+   * @param solver linear algebra solver.
+   * @param input right hand side.
+   * @param guess initial guess of the solution.
+   * @return solution.
+   */
+  template <typename TMatrix, typename TPreconditioner, typename TDenseVector>
+  TDenseVector
+  solveLinearAlgebraSolverWithGuess(const Eigen::BiCGSTAB<TMatrix, TPreconditioner>& solver, const TDenseVector& input, const TDenseVector& guess);
+#endif
+
   /**
    * Overloads 'operator<<' for displaying objects of class 'DiscreteExteriorCalculusSolver'.
    * @param out the output stream where the object is written.
@@ -0,0 +1,185 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file EigenMatrixFreeOperator.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module EigenMatrixFreeOperator
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(EigenMatrixFreeOperator_RECURSES)
+#error Recursive header files inclusion detected in EigenMatrixFreeOperator.h
+#else // defined(EigenMatrixFreeOperator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define EigenMatrixFreeOperator_RECURSES
+
+#if !defined EigenMatrixFreeOperator_h
+/** Prevents repeated inclusion of headers. */
+#define EigenMatrixFreeOperator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/MatrixFreeLinearOperator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#if !defined(WITH_EIGEN)
+#error You need to have activated EIGEN (WITH_EIGEN) to include this file.
+#endif
+
+#if !EIGEN_VERSION_AT_LEAST(3,3,0)
+#error EigenMatrixFreeOperator requires Eigen 3.3 or newer.
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class EigenMatrixFreeOperator
+  /**
+   * Description of template class 'EigenMatrixFreeOperator' <p>
+   * \brief Aim:
+   * Wraps a MatrixFreeLinearOperator as an Eigen matrix free operator,
+   * so that Eigen iterative solvers only call its application on
+   * vectors.
+   *
+   * @code
+   typedef MatrixFreeLinearOperator<Calculus, 0, DUAL, 0, DUAL> Laplace;
+   typedef EigenMatrixFreeOperator<Laplace> Operator;
+   const Laplace laplace = calculus.matrixFreeLaplace<DUAL>();
+   const Operator wrapped_laplace(laplace);
+   Operator::SolverConjugateGradient solver;
+   solver.compute(wrapped_laplace);
+   const Calculus::DualForm0 solution(calculus, solver.solve(input.myContainer));
+   * @endcode
+   *
+   * Only the identity preconditioner is available since the
+   * coefficients of the operator are not stored.
+   *
+   * @tparam TMatrixFreeOperator should be MatrixFreeLinearOperator.
+   */
+  template <typename TMatrixFreeOperator>
+  class EigenMatrixFreeOperator
+    : public Eigen::EigenBase< EigenMatrixFreeOperator<TMatrixFreeOperator> >
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TMatrixFreeOperator MatrixFreeOperator;
+    typedef EigenMatrixFreeOperator<TMatrixFreeOperator> Self;
+    typedef typename MatrixFreeOperator::Scalar Scalar;
+    typedef Scalar RealScalar;
+    typedef typename MatrixFreeOperator::Index StorageIndex;
+    typedef typename MatrixFreeOperator::DenseVector DenseVector;
+
+    enum
+    {
+      ColsAtCompileTime = Eigen::Dynamic,
+      MaxColsAtCompileTime = Eigen::Dynamic,
+      IsRowMajor = false
+    };
+
+    ///Conjugate gradient solver, for symmetric definite operators
+    typedef Eigen::ConjugateGradient<Self, Eigen::Lower|Eigen::Upper, Eigen::IdentityPreconditioner> SolverConjugateGradient;
+    ///Biconjugate gradient stabilized solver
+    typedef Eigen::BiCGSTAB<Self, Eigen::IdentityPreconditioner> SolverBiCGSTAB;
+
+    /**
+     * Constructor.
+     * @param matrix_free_operator the wrapped operator.
+     */
+    EigenMatrixFreeOperator(ConstAlias<MatrixFreeOperator> matrix_free_operator)
+      : myOperator(&matrix_free_operator)
+    {}
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Pointer to the wrapped operator.
+     */
+    const MatrixFreeOperator* myOperator;
+
+    /// @return the number of rows of the operator.
+    Eigen::Index rows() const { return myOperator->rows(); }
+
+    /// @return the number of columns of the operator.
+    Eigen::Index cols() const { return myOperator->cols(); }
+
+    /**
+     * Lazy product with a dense vector, evaluated by Eigen through
+     * generic_product_impl.
+     * @param x dense vector.
+     * @return the product expression.
+     */
+    template <typename Rhs>
+    Eigen::Product<Self, Rhs, Eigen::AliasFreeProduct>
+    operator*(const Eigen::MatrixBase<Rhs>& x) const
+    {
+      return Eigen::Product<Self, Rhs, Eigen::AliasFreeProduct>(*this, x.derived());
+    }
+
+  }; // end of class EigenMatrixFreeOperator
+
+} // namespace DGtal
+
+namespace Eigen
+{
+  namespace internal
+  {
+    /// An EigenMatrixFreeOperator has the traits of a sparse matrix.
+    template <typename TMatrixFreeOperator>
+    struct traits< DGtal::EigenMatrixFreeOperator<TMatrixFreeOperator> >
+      : public Eigen::internal::traits< Eigen::SparseMatrix<typename TMatrixFreeOperator::Scalar> >
+    {};
+
+    /// Product of an EigenMatrixFreeOperator with a dense vector.
+    template <typename TMatrixFreeOperator, typename Rhs>
+    struct generic_product_impl< DGtal::EigenMatrixFreeOperator<TMatrixFreeOperator>, Rhs,
+                                 SparseShape, DenseShape, GemvProduct >
+      : generic_product_impl_base< DGtal::EigenMatrixFreeOperator<TMatrixFreeOperator>, Rhs,
+                                   generic_product_impl< DGtal::EigenMatrixFreeOperator<TMatrixFreeOperator>, Rhs > >
+    {
+      typedef typename Product< DGtal::EigenMatrixFreeOperator<TMatrixFreeOperator>, Rhs >::Scalar Scalar;
+
+      template <typename Dest>
+      static void scaleAndAddTo(Dest& dst, const DGtal::EigenMatrixFreeOperator<TMatrixFreeOperator>& lhs,
+                                const Rhs& rhs, const Scalar& alpha)
+      {
+        typedef typename TMatrixFreeOperator::DenseVector DenseVector;
+        const DenseVector input = rhs;
+        DenseVector output;
+        lhs.myOperator->apply(input, output);
+        dst.noalias() += alpha * output;
+      }
+    };
+  } // namespace internal
+} // namespace Eigen
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined EigenMatrixFreeOperator_h
+
+#undef EigenMatrixFreeOperator_RECURSES
+#endif // else defined(EigenMatrixFreeOperator_RECURSES)
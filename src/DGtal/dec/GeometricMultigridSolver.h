@@ -0,0 +1,397 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file GeometricMultigridSolver.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module GeometricMultigridSolver.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(GeometricMultigridSolver_RECURSES)
+#error Recursive header files inclusion detected in GeometricMultigridSolver.h
+#else // defined(GeometricMultigridSolver_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define GeometricMultigridSolver_RECURSES
+
+#if !defined GeometricMultigridSolver_h
+/** Prevents repeated inclusion of headers. */
+#define GeometricMultigridSolver_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/LinearOperator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#if !defined(WITH_EIGEN)
+#error You need to have activated EIGEN (WITH_EIGEN) to include this file.
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class GeometricMultigridSolver
+  /**
+   * Description of template class 'GeometricMultigridSolver' <p>
+   * \brief Aim:
+   * Conjugate gradient solver preconditioned by a geometric multigrid
+   * V-cycle, for the laplace operators of a DiscreteExteriorCalculus
+   * built on a grid.
+   *
+   * The hierarchy follows the cells of the solved form: each coarse
+   * unknown aggregates the cells lying in the same \f$2^n\f$ block of
+   * the grid, the block size doubling at each level. The prolongation
+   * is the piecewise constant interpolation of the aggregates smoothed
+   * by one damped Jacobi step, the restriction its transpose and the
+   * coarse operators the Galerkin products. Damped Jacobi smoothing and
+   * sparse products are parallel when OpenMP is enabled. The coarsest
+   * level is solved with a sparse LDLT factorization.
+   *
+   * It fits in the linear algebra solver slot of
+   * DiscreteExteriorCalculusSolver, which binds the cells of the
+   * operator before calling compute():
+   * @code
+   typedef GeometricMultigridSolver<Calculus> LinearAlgebraSolver;
+   typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, DUAL, 0, DUAL> Solver;
+   Solver solver;
+   solver.myLinearAlgebraSolver.setTolerance(1e-8);
+   solver.compute(calculus.laplace<DUAL>());
+   const Calculus::DualForm0 solution = solver.solve(input);
+   * @endcode
+   *
+   * The operator must be symmetric and definite, e.g. the dual 0-form
+   * (primal n-form) laplace of a calculus with border. The primal 0-form
+   * laplace is only symmetric when primal 0-cells have unit dual sizes.
+   * Used alone, setCells() must be called before compute().
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus.
+   */
+  template <typename TCalculus>
+  class GeometricMultigridSolver
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+    typedef GeometricMultigridSolver<TCalculus> Self;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::DenseVector DenseVector;
+    typedef typename Calculus::DenseMatrix DenseMatrix;
+    typedef typename Calculus::SparseMatrix SparseMatrix;
+    typedef typename Calculus::KSpace KSpace;
+    typedef typename Calculus::SCells SCells;
+    typedef typename KSpace::Point Point;
+    typedef Eigen::SparseMatrix<Scalar, Eigen::RowMajor, Index> RowMajorSparseMatrix;
+
+    /**
+     * Constructor.
+     */
+    GeometricMultigridSolver();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Set the cells of the solved form, in index order.
+     * @param signed_cells cells indexed as the unknowns of the solved problem.
+     * @param kspace Khalimsky space of the cells.
+     */
+    void
+    setCells(const SCells& signed_cells, const KSpace& kspace);
+
+    /**
+     * Set the relative residual norm at which iterations stop.
+     * @param tolerance relative tolerance.
+     * @return *this.
+     */
+    Self&
+    setTolerance(const Scalar& tolerance);
+
+    /**
+     * Set the maximum number of conjugate gradient iterations.
+     * @param max_iterations maximum number of iterations.
+     * @return *this.
+     */
+    Self&
+    setMaxIterations(const Index& max_iterations);
+
+    /**
+     * Set the number of Jacobi steps before and after each coarse correction.
+     * @param smoothing_steps number of pre and post smoothing steps.
+     * @return *this.
+     */
+    Self&
+    setSmoothingSteps(const unsigned int& smoothing_steps);
+
+    /**
+     * Set the size below which a level is solved directly.
+     * @param coarsest_size maximum size of the coarsest level.
+     * @return *this.
+     */
+    Self&
+    setCoarsestSize(const Index& coarsest_size);
+
+    /**
+     * Build the multigrid hierarchy of a problem, i.e. analyzePattern()
+     * followed by factorize().
+     * @param matrix symmetric definite matrix of the problem.
+     * @return *this.
+     */
+    Self&
+    compute(const SparseMatrix& matrix);
+
+    /**
+     * Build the aggregates of all levels, which only depend on the cells.
+     * @param matrix matrix of the problem, only its size is used.
+     * @return *this.
+     */
+    Self&
+    analyzePattern(const SparseMatrix& matrix);
+
+    /**
+     * Build the operators of all levels from the aggregates of the last
+     * call to analyzePattern().
+     * @param matrix symmetric definite matrix of the problem.
+     * @return *this.
+     */
+    Self&
+    factorize(const SparseMatrix& matrix);
+
+    /**
+     * Solve the problem with the preconditioned conjugate gradient.
+     * @param input right hand side.
+     * @return solution.
+     */
+    DenseVector
+    solve(const DenseVector& input) const;
+
+    /**
+     * Solve the problem with the preconditioned conjugate gradient
+     * starting from an initial guess.
+     * @param input right hand side.
+     * @param guess initial guess of the solution.
+     * @return solution.
+     */
+    DenseVector
+    solveWithGuess(const DenseVector& input, const DenseVector& guess) const;
+
+    /**
+     * Solve the problem for each column of a block of right hand sides.
+     * iterations() and error() report the worst column.
+     * @param inputs right hand sides.
+     * @return solutions.
+     */
+    DenseMatrix
+    solve(const DenseMatrix& inputs) const;
+
+    /**
+     * Apply one V-cycle on a residual, starting from a zero solution.
+     * @param input residual.
+     * @return approximate solution.
+     */
+    DenseVector
+    cycle(const DenseVector& input) const;
+
+    /**
+     * @return Eigen::Success when the hierarchy is built and the last solve converged.
+     */
+    Eigen::ComputationInfo
+    info() const;
+
+    /**
+     * @return number of conjugate gradient iterations of the last solve.
+     */
+    Index
+    iterations() const;
+
+    /**
+     * @return relative residual norm of the last solve.
+     */
+    Scalar
+    error() const;
+
+    /**
+     * @return number of levels of the hierarchy, including the finest one.
+     */
+    std::size_t
+    levels() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void
+    selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool
+    isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /**
+     * Level of the multigrid hierarchy.
+     */
+    struct Level
+    {
+      /// Operator of the level.
+      RowMajorSparseMatrix myMatrix;
+      /// Aggregate of each unknown of the level, empty on the coarsest level.
+      std::vector<Index> myAggregates;
+      /// Number of aggregates.
+      Index myCoarseLength;
+      /// Inverse of the diagonal of the operator.
+      DenseVector myInverseDiagonal;
+      /// Damped Jacobi weight.
+      Scalar myJacobiWeight;
+      /// Interpolation from the next coarser level.
+      RowMajorSparseMatrix myProlongation;
+      /// Transpose of the interpolation.
+      RowMajorSparseMatrix myRestriction;
+    };
+
+    /**
+     * Levels from the finest to the coarsest.
+     */
+    std::vector<Level> myLevels;
+
+    /**
+     * Factorization of the coarsest level.
+     */
+    Eigen::SimplicialLDLT<SparseMatrix> myCoarsestSolver;
+
+    /**
+     * Grid coordinates of the cells of the solved form.
+     */
+    std::vector<Point> myCellCoordinates;
+
+    Scalar myTolerance;
+    Index myMaxIterations;
+    unsigned int mySmoothingSteps;
+    Index myCoarsestSize;
+
+    mutable Eigen::ComputationInfo myInfo;
+    mutable Index myIterations;
+    mutable Scalar myError;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Parallel sparse matrix dense vector product.
+     * @param matrix row major sparse matrix.
+     * @param input dense vector.
+     * @param output product, resized.
+     */
+    static
+    void
+    multiply(const RowMajorSparseMatrix& matrix, const DenseVector& input, DenseVector& output);
+
+    /**
+     * Damped Jacobi steps.
+     * @param level smoothed level.
+     * @param input right hand side.
+     * @param solution smoothed solution.
+     * @param buffer temporary vector.
+     */
+    void
+    smooth(const Level& level, const DenseVector& input, DenseVector& solution, DenseVector& buffer) const;
+
+    /**
+     * V-cycle from a level, starting from a zero solution.
+     * @param level_index index of the level.
+     * @param input residual of the level.
+     * @param solution approximate solution, resized.
+     */
+    void
+    cycle(const std::size_t& level_index, const DenseVector& input, DenseVector& solution) const;
+
+    /**
+     * Aggregate points lying in the same 2x2...x2 block.
+     * @param coordinates point coordinates, replaced by the coordinates of the aggregates.
+     * @param aggregates aggregate index of each point.
+     * @return number of aggregates.
+     */
+    static
+    Index
+    aggregate(std::vector<Point>& coordinates, std::vector<Index>& aggregates);
+
+  }; // end of class GeometricMultigridSolver
+
+  /**
+   * Binds the cells of the solution of a linear operator to a
+   * GeometricMultigridSolver, called by DiscreteExteriorCalculusSolver::compute.
+   * @param solver multigrid solver.
+   * @param linear_operator solved operator.
+   */
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  void
+  bindLinearAlgebraSolver(GeometricMultigridSolver<TCalculus>& solver,
+                          const LinearOperator<TCalculus, order_in, duality_in, order_out, duality_out>& linear_operator);
+
+  /**
+   * Starts a GeometricMultigridSolver from an initial guess, called by
+   * DiscreteExteriorCalculusSolver::solve.
+   * @param solver multigrid solver.
+   * @param input right hand side.
+   * @param guess initial guess of the solution.
+   * @return solution.
+   */
+  template <typename TCalculus>
+  typename GeometricMultigridSolver<TCalculus>::DenseVector
+  solveLinearAlgebraSolverWithGuess(const GeometricMultigridSolver<TCalculus>& solver,
+                                    const typename GeometricMultigridSolver<TCalculus>::DenseVector& input,
+                                    const typename GeometricMultigridSolver<TCalculus>::DenseVector& guess);
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'GeometricMultigridSolver'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'GeometricMultigridSolver' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TCalculus>
+  std::ostream&
+  operator<<(std::ostream& out, const GeometricMultigridSolver<TCalculus>& object);
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/GeometricMultigridSolver.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined GeometricMultigridSolver_h
+
+#undef GeometricMultigridSolver_RECURSES
+#endif // else defined(GeometricMultigridSolver_RECURSES)
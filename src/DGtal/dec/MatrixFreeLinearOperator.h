@@ -0,0 +1,374 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MatrixFreeLinearOperator.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MatrixFreeLinearOperator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MatrixFreeLinearOperator_RECURSES)
+#error Recursive header files inclusion detected in MatrixFreeLinearOperator.h
+#else // defined(MatrixFreeLinearOperator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MatrixFreeLinearOperator_RECURSES
+
+#if !defined MatrixFreeLinearOperator_h
+/** Prevents repeated inclusion of headers. */
+#define MatrixFreeLinearOperator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/dec/Duality.h"
+#include "DGtal/dec/KForm.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeStencil
+  /**
+   * Description of template class 'MatrixFreeStencil' <p>
+   * \brief Aim:
+   * MatrixFreeStencil is one stage of a MatrixFreeLinearOperator: the
+   * value of each output cell is a weighted sum of the values of a
+   * fixed number of input cells.
+   *
+   * Each row stores exactly 'width' input indices and coefficients,
+   * unused entries having a zero coefficient. A diagonal stencil stores
+   * no index and maps each cell on itself.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus.
+   */
+  template <typename TCalculus>
+  struct MatrixFreeStencil
+  {
+    typedef TCalculus Calculus;
+    typedef typename Calculus::Index Index;
+    typedef typename Calculus::Scalar Scalar;
+    typedef typename Calculus::DenseVector DenseVector;
+
+    /**
+     * Constructor of an empty stencil.
+     */
+    MatrixFreeStencil();
+
+    /**
+     * Constructor of a stencil with zero coefficients.
+     * @param rows number of output values.
+     * @param cols number of input values.
+     * @param width number of input values per output value, 0 for a diagonal stencil.
+     */
+    MatrixFreeStencil(const Index rows, const Index cols, const Dimension width);
+
+    /**
+     * Number of output values.
+     */
+    Index myRows;
+
+    /**
+     * Number of input values.
+     */
+    Index myCols;
+
+    /**
+     * Number of input values per output value, 0 for a diagonal stencil.
+     */
+    Dimension myWidth;
+
+    /**
+     * Input indices, 'myWidth' per row.
+     */
+    std::vector<Index> myIndices;
+
+    /**
+     * Coefficients, 'myWidth' per row or one per row for a diagonal stencil.
+     */
+    std::vector<Scalar> myCoefficients;
+
+    /**
+     * @return 'true' iff the stencil maps each cell on itself.
+     */
+    bool isDiagonal() const;
+
+    /**
+     * Computes output = stencil * input, in parallel over the output
+     * cells when OpenMP is enabled.
+     * @param input input values, of size myCols.
+     * @param output output values, resized to myRows.
+     */
+    void apply(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * Multiplies each row by a factor.
+     * @param factors one factor per row.
+     */
+    void scaleRows(const std::vector<Scalar>& factors);
+
+    /**
+     * Multiplies each coefficient by a factor of its input index.
+     * @param factors one factor per column.
+     */
+    void scaleCols(const std::vector<Scalar>& factors);
+
+    /**
+     * Computes the stencil of the composition of two stencils, row by
+     * row: the entries of an output row are the merged entries of the
+     * rows of @a right referenced by the row of @a left. No global
+     * sparse product is formed.
+     * @param left stencil applied last.
+     * @param right stencil applied first.
+     * @return the stencil of left * right.
+     */
+    static
+    MatrixFreeStencil
+    compose(const MatrixFreeStencil& left, const MatrixFreeStencil& right);
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Merges the entries of row @a row of left * right.
+     * @param left stencil applied last.
+     * @param right stencil applied first.
+     * @param row output row.
+     * @param indices output indices, with enough room for the merged entries.
+     * @param coefficients output coefficients, with enough room for the merged entries.
+     * @return the number of merged entries.
+     */
+    static
+    Dimension
+    composeRow(const MatrixFreeStencil& left, const MatrixFreeStencil& right, const Index row,
+               Index* indices, Scalar* coefficients);
+
+  }; // end of struct MatrixFreeStencil
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MatrixFreeLinearOperator
+  /**
+   * Description of template class 'MatrixFreeLinearOperator' <p>
+   * \brief Aim:
+   * MatrixFreeLinearOperator represents a discrete linear operator
+   * between discrete kforms in the DEC package, without assembling its
+   * sparse matrix.
+   *
+   * The operator is a sequence of MatrixFreeStencil, applied from the
+   * first to the last one. Derivatives are stored as the signed
+   * incidences of each output cell and hodge operators as diagonals,
+   * that are folded into the neighbouring stencils when operators are
+   * composed. Stencils may also be fused row by row with fused(). For
+   * instance, the laplace operator returned by
+   * DiscreteExteriorCalculus::matrixFreeLaplace is the (2n+1)-point
+   * stencil of each cell on a n-dimensional grid, computed from the
+   * incident cells of each cell instead of the products of four sparse
+   * matrices.
+   *
+   * Use EigenMatrixFreeOperator to solve linear problems with the
+   * iterative solvers of Eigen.
+   *
+   * @tparam TCalculus should be DiscreteExteriorCalculus.
+   * @tparam order_in is the input order of the linear operator.
+   * @tparam duality_in is the input duality of the linear operator.
+   * @tparam order_out is the output order of the linear operator.
+   * @tparam duality_out is the output duality of the linear operator.
+   *
+   * @see LinearOperator EigenMatrixFreeOperator
+   */
+  template <typename TCalculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  class MatrixFreeLinearOperator
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TCalculus Calculus;
+
+    BOOST_STATIC_ASSERT(( order_in >= 0 ));
+    BOOST_STATIC_ASSERT(( order_in <= Calculus::dimensionEmbedded ));
+    BOOST_STATIC_ASSERT(( order_out >= 0 ));
+    BOOST_STATIC_ASSERT(( order_out <= Calculus::dimensionEmbedded ));
+
+    ///Calculus scalar type
+    typedef typename Calculus::Scalar Scalar;
+    ///Calculus index type
+    typedef typename Calculus::Index Index;
+    ///Calculus dense vector type
+    typedef typename Calculus::DenseVector DenseVector;
+    ///Stencil type
+    typedef MatrixFreeStencil<Calculus> Stencil;
+    ///Stencils container type
+    typedef std::vector<Stencil> Stencils;
+    ///Input KForm type
+    typedef KForm<Calculus, order_in, duality_in> InputKForm;
+    ///Output KForm type
+    typedef KForm<Calculus, order_out, duality_out> OutputKForm;
+
+    /**
+     * Constructor.
+     * @param calculus the discrete exterior calculus to use.
+     * @param stencil the single stencil of the operator.
+     */
+    MatrixFreeLinearOperator(ConstAlias<Calculus> calculus, const Stencil& stencil);
+
+    /**
+     * Constructor.
+     * @param calculus the discrete exterior calculus to use.
+     * @param stencils the stencils of the operator, in application order.
+     */
+    MatrixFreeLinearOperator(ConstAlias<Calculus> calculus, const Stencils& stencils);
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Stencils of the operator, in application order.
+     */
+    Stencils myStencils;
+
+    /**
+     * Pointer to const calculus.
+     */
+    const Calculus* myCalculus;
+
+    /**
+     * @return the length of output kforms.
+     */
+    Index rows() const;
+
+    /**
+     * @return the length of input kforms.
+     */
+    Index cols() const;
+
+    /**
+     * Computes output = operator * input.
+     * @param input input values, of size cols().
+     * @param output output values, resized to rows().
+     */
+    void apply(const DenseVector& input, DenseVector& output) const;
+
+    /**
+     * Fuses the stencils of the operator into a single one, see
+     * MatrixFreeStencil::compose. The fused operator reads each input
+     * value once per output value referencing it and needs no
+     * intermediate form, at the price of wider rows.
+     * @return the fused operator.
+     */
+    MatrixFreeLinearOperator fused() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    MatrixFreeLinearOperator();
+
+  }; // end of class MatrixFreeLinearOperator
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MatrixFreeLinearOperator'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MatrixFreeLinearOperator' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  std::ostream&
+  operator<<(std::ostream& out,
+             const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& object);
+
+  /**
+   * Overloads 'operator*' for scalar multiplication of objects of class 'MatrixFreeLinearOperator'.
+   * @param scalar left operant
+   * @param linear_operator right operant
+   * @return scalar * linear_operator.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator*(const typename Calculus::Scalar& scalar,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator);
+
+  /**
+   * Overloads 'operator*' for the composition of objects of class 'MatrixFreeLinearOperator'.
+   * Diagonal stencils are folded into the neighbouring stencils.
+   * @param operator_left left operant
+   * @param operator_right right operant
+   * @return operator_left * operator_right.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_fold, Duality duality_fold, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator*(const MatrixFreeLinearOperator<Calculus, order_fold, duality_fold, order_out, duality_out>& operator_left,
+            const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_fold, duality_fold>& operator_right);
+
+  /**
+   * Overloads 'operator*' for application of objects of class 'MatrixFreeLinearOperator' on objects of class 'KForm'.
+   * @param linear_operator left operant
+   * @param input_form right operant
+   * @return linear_operator * input_form.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  KForm<Calculus, order_out, duality_out>
+  operator*(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator,
+            const KForm<Calculus, order_in, duality_in>& input_form);
+
+  /**
+   * Overloads 'operator-' for unary additive inverse of objects of class 'MatrixFreeLinearOperator'.
+   * @param linear_operator operant
+   * @return -linear_operator.
+   */
+  template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+  MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>
+  operator-(const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& linear_operator);
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/dec/MatrixFreeLinearOperator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MatrixFreeLinearOperator_h
+
+#undef MatrixFreeLinearOperator_RECURSES
+#endif // else defined(MatrixFreeLinearOperator_RECURSES)
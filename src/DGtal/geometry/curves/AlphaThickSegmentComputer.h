@@ -45,6 +45,9 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <cstddef>
+#include <deque>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/ReverseIterator.h"
 #include "DGtal/kernel/SpaceND.h"
@@ -79,6 +82,18 @@ namespace DGtal
  * time (with point substraction) proposed by Buzer
  * @cite lilianComputing2007 is not yet implemented.
  *
+ * A candidate point lying inside the current convex hull is accepted
+ * in constant time, since neither the hull nor its thickness
+ * change. Otherwise, the thickness is updated by rotating calipers:
+ * the antipodal pair of each edge of the hull is kept from one point
+ * to the next, and only the pairs of the two new edges and of the
+ * edges whose antipodal vertex is removed or next to the new point
+ * are computed again, as in \cite lilianComputing2007. The widths of
+ * the edges are only scanned when the edge of minimal width is
+ * removed or widened. The input points are not stored: only the
+ * vertices of the convex hull are, so that the computer may be used in
+ * GreedySegmentation on long noisy curves.
+ *
  *
  *
  * @tparam TInputPoint the type of input points: their dimension must
@@ -143,7 +158,6 @@ public:
    **/
   typedef std::vector< InputPoint > InputPointContainer;
   typedef typename InputPointContainer::size_type Size;
-  typedef typename InputPointContainer::const_iterator ContainerConstIterator;
   typedef typename DGtal::functions::Hull2D::ThicknessDefinition ThicknessDef;
 
   typedef typename InputPointContainer::iterator Iterator;
@@ -160,10 +174,28 @@ public:
   typedef AlphaThickSegmentComputer<InputPoint, ReverseIterator<ConstIterator> > Reverse;
   typedef DGtal::InHalfPlaneBySimple3x3Matrix<InputPoint, typename InputPoint::Component> Functor;
   typedef typename  DGtal::MelkmanConvexHull<InputPoint, Functor>::ConstIterator ConvexhullConstIterator;
+  /**
+   * The points stored in the container are the vertices of the convex hull.
+   **/
+  typedef ConvexhullConstIterator ContainerConstIterator;
 
   // ----------------------- internal types --------------------------------------
 
 private:
+  /**
+   * Antipodal pair of an edge of the convex hull. The vertices are
+   * given by their index in the container of the convex hull (see
+   * MelkmanConvexHull::operator[]) shifted by State::offset.
+   **/
+  struct Edge{
+    /** the first vertex farthest from the edge, from which the antipodal pairs of the next edges are searched */
+    std::ptrdiff_t antipode;
+    /** the vertex of the antipodal pair: the first farthest vertex or the next one if they are at the same distance */
+    std::ptrdiff_t vertex;
+    /** the thickness of the antipodal pair */
+    double width;
+  };
+
   struct State{
     DGtal::MelkmanConvexHull<InputPoint, Functor> melkmanCH;
     /** the last point added at the front of the alpha thick segment */
@@ -178,6 +210,12 @@ private:
     InputPoint vertexSh;
     /** the actual thickness of the current segment */
     double actualThickness;
+    /** the antipodal pairs of the convexhull edges, the i-th edge joining the points i and i+1 of melkmanCH */
+    std::deque<Edge> edges;
+    /** the offset of the vertex and edge indices (incremented when points are removed from the front of melkmanCH) */
+    std::ptrdiff_t offset;
+    /** the index (shifted by offset) of the edge of the antipodal pair of minimal thickness */
+    std::ptrdiff_t minEdge;
   };
 
 
@@ -257,33 +295,31 @@ public:
 public:
 
   /**
-   * @return the number of distinct points stored in the container.
-   * @note it returns 0 if segment computer is initialized with a curve
-   * iterator without the option of saving samples).
+   * @return the number of distinct points stored in the container,
+   * ie. the number of vertices of the convex hull.
+   * @note the input points are not stored (see getNumberSegmentPoints).
    */
   Size size() const;
 
 
   /**
    * @return 'true' if and only if the container contains no point.
-   * @note: returns always 'true' if the segment computer is initialized with a curve
-   * const iterator without the option of saving samples).
    */
   bool empty() const;
 
 
   /**
-   * @return a const iterator pointing on the first point given in the
-   * container associated to the current alpha thick segment (is empty
-   * if the saving option is not selected in the init method).
+   * @return a const iterator pointing on the first point stored in the
+   * container associated to the current alpha thick segment, ie. on
+   * the first vertex of its convex hull.
    */
   ContainerConstIterator containerBegin() const;
 
 
   /**
-   * @return a const iterator pointing after the last point given in the
-   * container associated to the current alpha thick segment (is
-   * empty if the saving option is not selected in the init method).
+   * @return a const iterator pointing after the last point stored in the
+   * container associated to the current alpha thick segment, ie. after
+   * the last vertex of its convex hull.
    */
   ContainerConstIterator containerEnd() const;
 
@@ -480,7 +516,10 @@ public:
 
 
   /**
-   * @return 'true' if the points of the segment computer are stored in the main container.
+   * @return 'true' if the points of the segment computer are given
+   * by value (see extendFront(const InputPoint&)) and not by
+   * iterators. Only the vertices of their convex hull are then
+   * available, in the main container.
    **/
   bool isStoringSegmentPoints() const;
 
@@ -588,11 +627,6 @@ protected:
     // ------------------------- Private Datas --------------------------------
 private:
 
-  /**
-   * The set of points contained in the alpha thick segment which can be changed during computations.
-   **/
-  mutable InputPointContainer myPointContainer;
-
   /**
    * The maximal thickness of the segment.
    */
@@ -616,16 +650,27 @@ private:
   State myState;
 
   /**
-   * Previous saved computer state
+   * Buffer storing the vertices of the convex hull obtained by adding
+   * a candidate point (reused from one candidate to the next).
+   **/
+  std::vector<InputPoint> myCandidateHull;
+
+  /**
+   * Buffer storing the antipodal pairs computed again for a candidate
+   * point (reused from one candidate to the next).
    **/
-  mutable State myPreviousState;
+  std::vector<Edge> myCandidateEdges;
 
+  /**
+   * 'true' if the points of the segment are given by value, ie. if
+   * they are added by extendFront(const InputPoint&).
+   **/
   bool myIsStoringPoints;
 
   /**
-   * Used by the size method.
+   * The number of points of the segment.
    **/
-  unsigned int myNbPointsAddedFromIterators;
+  unsigned int myNbPoints;
 
 
 
@@ -636,20 +681,86 @@ protected:
 
 
   /**
-   * Depending on connexity, return true if a convex is valid.
-   */
-  bool melkmanIsConvexValid() ;
+   * Checks whether the thickness of the convex hull of the segment
+   * points and of a new point is lower than the maximal thickness,
+   * and if so, possibly updates the convex hull, its thickness and
+   * its antipodal pair.
+   *
+   * When the new point lies outside the hull, the hull keeps a chain
+   * of its vertices (see MelkmanConvexHull::pointsKeptByAdding) and
+   * the new point is inserted at both ends of this chain. The
+   * farthest vertex from a kept edge is then either unchanged or one
+   * of the two last kept vertices, the new point or the first kept
+   * vertex: by monotonicity of the antipodal pairs, these edges are
+   * found by a binary search and their pairs are updated with a
+   * caliper walk of at most three steps. The pairs of the two new
+   * edges are obtained by caliper walks from the pair of the last
+   * kept edge.
+   *
+   * @param[in] aPoint the new point.
+   * @param[in] isUpdating if 'true' the state of the computer is
+   * updated when the new thickness is valid, else it is left unchanged.
+   * @return 'true' if the new thickness is valid.
+   **/
+  bool checkAndUpdateThickness(const InputPoint &aPoint, bool isUpdating);
 
 
   /**
-   *  Updates the main height of the melkman convex hull
-   *   and update the antipodal pairs.
+   *  Computes the main height of a convex hull
+   *   and its antipodal pair.
    *
-   * @return the thickness of the segment (thickness defined by
+   * @param[in] itBegin the begin iterator on the convex hull vertices.
+   * @param[in] itEnd the end iterator on the convex hull vertices.
+   * @param[out] anEdgeP the first point of the edge of the antipodal pair.
+   * @param[out] anEdgeQ the second point of the edge of the antipodal pair.
+   * @param[out] aVertexS the vertex of the antipodal pair.
+   * @return the thickness of the convex hull (thickness defined by
    * default as the vertical/horizontal width (see @ref
    * moduleAlphaThickSegmentReco for more details).
    **/
-  double updateMainHeightAndAntiPodal();
+  template<typename TConstIteratorG>
+  double computeMainHeightAndAntiPodal(const TConstIteratorG & itBegin, const TConstIteratorG & itEnd,
+                                       InputPoint & anEdgeP, InputPoint & anEdgeQ,
+                                       InputPoint & aVertexS) const;
+
+
+  /**
+   * Computes the antipodal pairs of all the edges of the convex hull
+   * by rotating calipers, and updates the thickness and the antipodal
+   * pair of the segment.
+   **/
+  void computeAntipodalPairs();
+
+
+  /**
+   * Computes the antipodal pair of an edge of the polygon made of
+   * the points of indices @a aFirst to @a aLast of the convex hull
+   * container (see MelkmanConvexHull::operator[]), followed by the
+   * point @a aPoint, of index @a aLast + 1.
+   *
+   * @param[in] aFirst the index of the first point of the polygon.
+   * @param[in] aLast the index of the last point of the hull container in the polygon.
+   * @param[in] aPoint the last point of the polygon.
+   * @param[in] anEdgeP the first point of the edge.
+   * @param[in] anEdgeQ the second point of the edge.
+   * @param[in] aStart the index of the vertex from which the farthest
+   * vertex is searched, which must not be after it.
+   * @return the antipodal pair, whose indices are not shifted.
+   **/
+  Edge computeAntipodalPair(const std::ptrdiff_t aFirst, const std::ptrdiff_t aLast,
+                            const InputPoint & aPoint, const InputPoint & anEdgeP,
+                            const InputPoint & anEdgeQ, std::ptrdiff_t aStart) const;
+
+
+  /**
+   * @return the distance from a point to the straight line of an
+   * edge, up to the length of the edge.
+   * @param[in] anEdgeP the first point of the edge.
+   * @param[in] anEdgeQ the second point of the edge.
+   * @param[in] aPoint the point.
+   **/
+  static double edgeDistance(const InputPoint & anEdgeP, const InputPoint & anEdgeQ,
+                             const InputPoint & aPoint);
 
 
 
@@ -0,0 +1,268 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file FreemanChainCollection.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module FreemanChainCollection.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(FreemanChainCollection_RECURSES)
+#error Recursive header files inclusion detected in FreemanChainCollection.h
+#else // defined(FreemanChainCollection_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define FreemanChainCollection_RECURSES
+
+#if !defined FreemanChainCollection_h
+/** Prevents repeated inclusion of headers. */
+#define FreemanChainCollection_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class FreemanChainCollection
+  /**
+   * Description of template class 'FreemanChainCollection' <p>
+   * \brief Aim: Stores many Freeman chains (typically the contours of
+   * the connected components of the slices of a volume) as a
+   * structure of arrays: the codes of all the chains are
+   * concatenated into one string, the i-th chain being made of the
+   * codes in [offset(i), offset(i+1)), and the coordinates of the
+   * starting points are stored in two arrays.
+   *
+   * Compared to a std::vector of FreemanChain, there is no
+   * allocation per chain, and the data of successive chains are
+   * contiguous in memory. Per-point quantities computed on the whole
+   * collection (see BatchCurveEstimators) are naturally stored in flat
+   * arrays indexed like the codes: the quantity of the k-th point of
+   * the i-th chain (the point before its k-th code) is at index
+   * offset(i) + k.
+   *
+   * @code
+   FreemanChainCollection<int> contours;
+   contours.reserve( 2, 10 );
+   contours.push_back( 0, 0, "0123" );
+   contours.push_back( FreemanChain<int>( "00112233", 5, 5 ) );
+   std::vector< FreemanChainCollection<int>::Point > points;
+   contours.getContourPoints( 1, points ); // 9 points
+   * @endcode
+   *
+   * @tparam TInteger type of the coordinates of the starting points.
+   *
+   * @see FreemanChain, BatchCurveEstimators, testFreemanChainCollection.cpp
+   */
+  template <typename TInteger>
+  class FreemanChainCollection
+  {
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
+    typedef TInteger Integer;
+    typedef FreemanChainCollection<Integer> Self;
+    typedef DGtal::FreemanChain<Integer> Chain;
+    typedef PointVector<2, Integer> Point;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    /// Iterator on the codes of a chain.
+    typedef std::string::const_iterator ConstIterator;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The collection is empty.
+     */
+    FreemanChainCollection();
+
+    /**
+     * Reserves memory.
+     * @param nbChains the expected number of chains.
+     * @param nbCodes the expected total number of codes.
+     */
+    void reserve( Size nbChains, Size nbCodes );
+
+    /**
+     * Removes all the chains (the memory is kept).
+     */
+    void clear();
+
+    /**
+     * Appends a chain.
+     * @param aChain any Freeman chain.
+     */
+    void push_back( const Chain & aChain );
+
+    /**
+     * Appends a chain.
+     * @param x0 the x-coordinate of the starting point.
+     * @param y0 the y-coordinate of the starting point.
+     * @param aCodes the codes ('0' to '3') of the chain.
+     */
+    void push_back( const Integer & x0, const Integer & y0, const std::string & aCodes );
+
+    /**
+     * Appends a chain whose codes are given by a range of characters.
+     * @param x0 the x-coordinate of the starting point.
+     * @param y0 the y-coordinate of the starting point.
+     * @param itb begin iterator on the codes ('0' to '3').
+     * @param ite end iterator on the codes.
+     * @tparam TIterator any model of input iterator on characters.
+     */
+    template <typename TIterator>
+    void push_back( const Integer & x0, const Integer & y0, TIterator itb, TIterator ite );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /// @return the number of chains.
+    Size size() const;
+
+    /// @return 'true' if there is no chain.
+    bool empty() const;
+
+    /// @return the total number of codes.
+    Size nbCodes() const;
+
+    /**
+     * @param i the index of a chain.
+     * @return its number of codes.
+     */
+    Size length( Index i ) const;
+
+    /**
+     * @param i the index of a chain (or size()).
+     * @return the index of its first code in codes().
+     */
+    Index offset( Index i ) const;
+
+    /// @return the size()+1 offsets of the chains.
+    const std::vector<Index> & offsets() const;
+
+    /// @return the concatenation of the codes of all the chains.
+    const std::string & codes() const;
+
+    /**
+     * @param i the index of a chain.
+     * @return an iterator on its first code.
+     */
+    ConstIterator begin( Index i ) const;
+
+    /**
+     * @param i the index of a chain.
+     * @return an iterator after its last code.
+     */
+    ConstIterator end( Index i ) const;
+
+    /**
+     * @param i the index of a chain.
+     * @return its starting point.
+     */
+    Point firstPoint( Index i ) const;
+
+    /**
+     * @param i the index of a chain.
+     * @return 'true' if the chain ends on its starting point.
+     */
+    bool isClosed( Index i ) const;
+
+    /**
+     * @param i the index of a chain.
+     * @return a copy of the chain as a FreemanChain.
+     */
+    Chain chain( Index i ) const;
+
+    /**
+     * Decodes the points of a chain, as FreemanChain::getContourPoints
+     * does (length(i) + 1 points, the last one being the first one
+     * for a closed chain). The memory of @a aPoints is reused.
+     *
+     * @param i the index of a chain.
+     * @param aPoints (returns) the points of the chain.
+     */
+    void getContourPoints( Index i, std::vector<Point> & aPoints ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The codes of all the chains.
+    std::string myCodes;
+    /// The index of the first code of each chain, followed by the number of codes.
+    std::vector<Index> myOffsets;
+    /// The x-coordinates of the starting points.
+    std::vector<Integer> myX0;
+    /// The y-coordinates of the starting points.
+    std::vector<Integer> myY0;
+
+  }; // end of class FreemanChainCollection
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'FreemanChainCollection'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'FreemanChainCollection' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const FreemanChainCollection<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/FreemanChainCollection.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined FreemanChainCollection_h
+
+#undef FreemanChainCollection_RECURSES
+#endif // else defined(FreemanChainCollection_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
 #include "DGtal/geometry/curves/CForwardSegmentComputer.h"
@@ -154,6 +155,7 @@ namespace DGtal
     BOOST_CONCEPT_ASSERT(( concepts::CForwardSegmentComputer<TSegmentComputer> ) );
     typedef TSegmentComputer SegmentComputer;
     typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Difference Difference;
 
     // ----------------------- Standard services ------------------------------
   public:
@@ -430,6 +432,29 @@ namespace DGtal
      */
     typename GreedySegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Computes all the segments of the segmentation, i.e. the
+     * segments of the range [begin(), end()), in parallel.
+     *
+     * The range to process is split into chunks, each chunk being
+     * greedily segmented from its first element (with OpenMP if
+     * available). Then, the chunks are stitched from left to right:
+     * the segmentation of a chunk is kept from the first segment
+     * starting where the (exact) segmentation of the previous chunks
+     * leads, the segments before this synchronization point being
+     * computed again from the right starting element. The result is
+     * thus exactly the sequential one, for both iterators and
+     * circulators. If the ConstIterator type is not random-access,
+     * or if the range is too short, the segments are computed
+     * sequentially.
+     *
+     * @param aSegments (returns) the sequence of segments (cleared first).
+     * @param aNbChunks the number of chunks, or 0 to get one chunk
+     * per 4096 elements (at most 256 chunks).
+     */
+    void getSegmentsParallel( std::vector<SegmentComputer> & aSegments,
+                              unsigned int aNbChunks = 0 ) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -499,6 +524,42 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Sequential computation of the segments, used for non
+     * random-access ranges.
+     * @param aSegments (returns) the sequence of segments.
+     */
+    void getSegmentsParallel( std::vector<SegmentComputer> & aSegments,
+                              unsigned int aNbChunks, ForwardCategory ) const;
+
+    /**
+     * Chunk-based computation of the segments.
+     * @param aSegments (returns) the sequence of segments.
+     * @param aNbChunks the number of chunks, 0 for the default.
+     */
+    void getSegmentsParallel( std::vector<SegmentComputer> & aSegments,
+                              unsigned int aNbChunks, RandomAccessCategory ) const;
+
+    /**
+     * Greedy segmentation of the range from the element at index @a
+     * aFirst (indices start at myStart), as if a segment started
+     * there. It stops at the first segment starting at index @a
+     * aLast or after, or at a segment starting at one of the indices
+     * of @a aSync.
+     *
+     * @param aFirst index of the first segment start.
+     * @param aLast index bounding the segment starts.
+     * @param aSync sorted indices where the run stops.
+     * @param aSegments (returns) the computed segments are appended.
+     * @param aStarts (returns) their starting indices are appended.
+     * @return the index of the start of the first segment that is not
+     * appended, or -1 if the segmentation is over.
+     */
+    Difference runFrom( const Difference & aFirst, const Difference & aLast,
+                        const std::vector<Difference> & aSync,
+                        std::vector<SegmentComputer> & aSegments,
+                        std::vector<Difference> & aStarts ) const;
+
   }; // end of class GreedySegmentation
 
 
@@ -0,0 +1,320 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file PackedFreemanChain.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module PackedFreemanChain.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(PackedFreemanChain_RECURSES)
+#error Recursive header files inclusion detected in PackedFreemanChain.h
+#else // defined(PackedFreemanChain_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define PackedFreemanChain_RECURSES
+
+#if !defined PackedFreemanChain_h
+/** Prevents repeated inclusion of headers. */
+#define PackedFreemanChain_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class PackedFreemanChain
+  /**
+   * Description of template class 'PackedFreemanChain' <p>
+   * \brief Aim: A 4-connected Freeman chain whose codes are stored
+   * with 2 bits per move, i.e. 4 codes per byte, instead of one
+   * character per move as in FreemanChain.
+   *
+   * The memory used by the codes is divided by 4. Moreover, the
+   * traversals of the whole chain (bounding box, contour points,
+   * area, number of loops, spikes) are decoded a byte at a time,
+   * i.e. 4 moves at once, with precomputed tables giving, for each of
+   * the 256 possible bytes, the total displacement, the extremal
+   * coordinates reached, the displacement after each move, the turns
+   * and the contribution to the area.
+   *
+   * The code at position i is stored in the bits 2(i mod 4) and
+   * 2(i mod 4)+1 of byte i/4, with the values 0 to 3 of the codes '0'
+   * to '3' of FreemanChain. Results are the same as the ones of the
+   * corresponding FreemanChain methods.
+   *
+   * @code
+   FreemanChain<int> fc( "00112233", 5, 5 );
+   PackedFreemanChain<int> pc( fc );
+   int min_x, min_y, max_x, max_y;
+   pc.computeBoundingBox( min_x, min_y, max_x, max_y );
+   int loops = pc.ccwLoops();                 // 1
+   int area2 = pc.twiceSignedArea();          // 8
+   FreemanChain<int> fc2 = pc.unpack();       // fc2 == fc
+   * @endcode
+   *
+   * @tparam TInteger type of the coordinates of the points.
+   *
+   * @see FreemanChain, testPackedFreemanChain.cpp
+   */
+  template <typename TInteger>
+  class PackedFreemanChain
+  {
+  public:
+
+    BOOST_CONCEPT_ASSERT(( concepts::CInteger<TInteger> ) );
+    typedef TInteger Integer;
+    typedef PackedFreemanChain<Integer> Self;
+    typedef DGtal::FreemanChain<Integer> Chain;
+    typedef PointVector<2, Integer> Point;
+    typedef PointVector<2, Integer> Vector;
+    typedef std::size_t Size;
+    typedef std::size_t Index;
+    typedef DGtal::uint8_t Byte;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param s a string of codes '0' to '3'.
+     * @param x the x-coordinate of the first point.
+     * @param y the y-coordinate of the first point.
+     */
+    PackedFreemanChain( const std::string & s = "", Integer x = 0, Integer y = 0 );
+
+    /**
+     * Constructor from a Freeman chain.
+     * @param aChain any Freeman chain.
+     */
+    explicit PackedFreemanChain( const Chain & aChain );
+
+    /**
+     * @return the equivalent FreemanChain.
+     */
+    Chain unpack() const;
+
+    /**
+     * Appends a code at the end of the chain.
+     * @param aCode a code '0' to '3'.
+     */
+    void push_back( char aCode );
+
+    /**
+     * Reserves memory.
+     * @param aSize the expected number of codes.
+     */
+    void reserve( Size aSize );
+
+    // ----------------------- Accessors --------------------------------------
+  public:
+
+    /**
+     * @return the number of codes of the chain.
+     */
+    Size size() const;
+
+    /**
+     * @return 'true' if the chain has no code.
+     */
+    bool empty() const;
+
+    /**
+     * @param pos a position in [0,size()).
+     * @return the code ('0' to '3') at position @a pos.
+     */
+    char code( Index pos ) const;
+
+    /**
+     * @return the packed codes (4 codes per byte).
+     */
+    const std::vector<Byte> & bytes() const;
+
+    /**
+     * @return the first point of the chain.
+     */
+    Point firstPoint() const;
+
+    /**
+     * @return the last point of the chain.
+     */
+    Point lastPoint() const;
+
+    /**
+     * @return 'true' if the last point is the first one.
+     */
+    bool isClosed() const;
+
+    // ----------------------- Traversals -------------------------------------
+  public:
+
+    /**
+     * Computes a bounding box of the points of the chain, as
+     * FreemanChain::computeBoundingBox.
+     *
+     * @param min_x (returns) the minimal x-coordinate.
+     * @param min_y (returns) the minimal y-coordinate.
+     * @param max_x (returns) the maximal x-coordinate.
+     * @param max_y (returns) the maximal y-coordinate.
+     */
+    void computeBoundingBox( Integer & min_x, Integer & min_y,
+                             Integer & max_x, Integer & max_y ) const;
+
+    /**
+     * Computes the points of the chain, i.e. the first point followed
+     * by the point reached after each move (size()+1 points).
+     * @param aPoints (returns) the points (the memory of the vector is
+     * reused).
+     */
+    void getContourPoints( std::vector<Point> & aPoints ) const;
+
+    /**
+     * Computes twice the signed area of the polygon joining the points
+     * of the chain, closed by the segment from the last point to the
+     * first one (positive when counterclockwise). For a closed
+     * 4-connected chain, this is always an even number.
+     * @return twice the signed area.
+     */
+    Integer twiceSignedArea() const;
+
+    /**
+     * Number of counterclockwise loops, as FreemanChain::ccwLoops.
+     * @return the number of counterclockwise loops, or '0' if the
+     * chain is open or has a spike.
+     */
+    int ccwLoops() const;
+
+    /**
+     * Counts the spikes, i.e. the positions i such that the code at
+     * i+1 is opposite to the code at i (steps "02", "13", "20" or
+     * "31"). If the chain is closed, the last code is followed by the
+     * first one.
+     * @return the number of spikes.
+     */
+    Size nbSpikes() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Information on the 4 moves coded by each of the 256 bytes.
+     */
+    struct ByteTable
+    {
+      /// Total displacement.
+      int8_t dx[ 256 ], dy[ 256 ];
+      /// Extremal displacements after each move.
+      int8_t minX[ 256 ], maxX[ 256 ], minY[ 256 ], maxY[ 256 ];
+      /// Displacement after each move.
+      int8_t x[ 256 ][ 4 ], y[ 256 ][ 4 ];
+      /// Number of counterclockwise minus clockwise turns between the moves.
+      int8_t turns[ 256 ];
+      /// Number of spikes between the moves.
+      int8_t spikes[ 256 ];
+      /// Sum of the cross products (x_k, y_k) ^ (dx_k, dy_k) of the moves.
+      int8_t area[ 256 ];
+
+      ByteTable();
+    };
+
+    /**
+     * @return the table of the bytes (computed once).
+     */
+    static const ByteTable & table();
+
+    /**
+     * @param aCode a code '0' to '3'.
+     * @return its displacement.
+     */
+    static Vector displacement( unsigned int aCode );
+
+    /**
+     * Counts the turns and the spikes between consecutive codes.
+     * @param aCyclic when 'true', the last code is followed by the first one.
+     * @param aTurns (returns) counterclockwise minus clockwise turns.
+     * @param aSpikes (returns) number of spikes.
+     */
+    void countTurns( bool aCyclic, int & aTurns, Size & aSpikes ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// The codes, 4 per byte.
+    std::vector<Byte> myBytes;
+    /// The number of codes.
+    Size mySize;
+    /// The first point.
+    Integer myX0, myY0;
+    /// The last point.
+    Integer myXn, myYn;
+
+  }; // end of class PackedFreemanChain
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'PackedFreemanChain'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'PackedFreemanChain' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TInteger>
+  std::ostream&
+  operator<< ( std::ostream & out, const PackedFreemanChain<TInteger> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/PackedFreemanChain.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined PackedFreemanChain_h
+
+#undef PackedFreemanChain_RECURSES
+#endif // else defined(PackedFreemanChain_RECURSES)
@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/geometry/curves/SegmentComputerUtils.h"
@@ -158,6 +159,7 @@ namespace DGtal
     BOOST_CONCEPT_ASSERT(( concepts::CForwardSegmentComputer<TSegmentComputer> ));
     typedef TSegmentComputer SegmentComputer;
     typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Difference Difference;
 
   private: 
 
@@ -451,6 +453,29 @@ namespace DGtal
      */
     typename SaturatedSegmentation::SegmentComputerIterator end() const;
 
+    /**
+     * Computes all the segments of the segmentation, i.e. the
+     * maximal segments of the range [begin(), end()), in parallel.
+     *
+     * The maximal segments located between the first and the last
+     * ones of the segmentation are split into chunks according to
+     * the position of their first element. Each chunk is processed
+     * (with OpenMP if available) from the first maximal segment
+     * passing through its first position, the maximal segments
+     * starting before the chunk being skipped. Since the maximal
+     * segments do not depend on the starting point of the scan, the
+     * concatenation of the chunks is exactly the sequential result,
+     * for both iterators and circulators. If the ConstIterator type
+     * is not random-access, or if the range is too short, the
+     * segments are computed sequentially.
+     *
+     * @param aSegments (returns) the sequence of segments (cleared first).
+     * @param aNbChunks the number of chunks, or 0 to get one chunk
+     * per 4096 elements (at most 256 chunks).
+     */
+    void getSegmentsParallel( std::vector<SegmentComputer> & aSegments,
+                              unsigned int aNbChunks = 0 ) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -520,6 +545,22 @@ namespace DGtal
     // ------------------------- Internals ------------------------------------
   private:
 
+    /**
+     * Sequential computation of the segments, used for non
+     * random-access ranges.
+     * @param aSegments (returns) the sequence of segments.
+     */
+    void getSegmentsParallel( std::vector<SegmentComputer> & aSegments,
+                              unsigned int aNbChunks, ForwardCategory ) const;
+
+    /**
+     * Chunk-based computation of the segments.
+     * @param aSegments (returns) the sequence of segments.
+     * @param aNbChunks the number of chunks, 0 for the default.
+     */
+    void getSegmentsParallel( std::vector<SegmentComputer> & aSegments,
+                              unsigned int aNbChunks, RandomAccessCategory ) const;
+
   }; // end of class SaturatedSegmentation
 
 
@@ -0,0 +1,361 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingSegmentation.h
+ *
+ * @date 2026/10/18
+ *
+ * @brief Header file for module StreamingSegmentation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingSegmentation_RECURSES)
+#error Recursive header files inclusion detected in StreamingSegmentation.h
+#else // defined(StreamingSegmentation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingSegmentation_RECURSES
+
+#if !defined StreamingSegmentation_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingSegmentation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <cstddef>
+#include <boost/iterator/iterator_facade.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ReverseIterator.h"
+#include "DGtal/geometry/curves/CForwardSegmentComputer.h"
+
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamWindow
+  /**
+   * Description of template class 'StreamWindow' <p>
+   * \brief Aim: A sliding window over a stream of values, stored in a
+   * circular buffer, whose iterators remain valid while values are
+   * appended at the back and removed at the front.
+   *
+   * Each value receives the index of its position in the stream. An
+   * iterator is a pair (window, index), so that it is not invalidated
+   * when the buffer grows. Dereferencing an iterator is only valid
+   * while its value lies in the window, i.e. between begin() and
+   * end().
+   *
+   * The capacity is a power of two that doubles when the window is
+   * full: it is bounded by the largest number of values
+   * simultaneously kept, not by the length of the stream.
+   *
+   * @tparam TValue type of the values, e.g. digital points.
+   */
+  template <typename TValue>
+  class StreamWindow
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TValue Value;
+    typedef std::size_t Size;
+    typedef StreamWindow<TValue> Self;
+
+    /**
+     * Random-access readable iterator on the values of a StreamWindow.
+     */
+    class ConstIterator
+      : public boost::iterator_facade<ConstIterator, Value const,
+                                      boost::random_access_traversal_tag,
+                                      Value const &, std::ptrdiff_t>
+    {
+    public:
+      /// Default constructor (not valid).
+      ConstIterator() : myWindow( 0 ), myIndex( 0 ) {}
+
+      /**
+       * Constructor.
+       * @param aWindow the visited window.
+       * @param anIndex the index in the stream of the pointed value.
+       */
+      ConstIterator( const Self* aWindow, Size anIndex )
+        : myWindow( aWindow ), myIndex( anIndex ) {}
+
+      /// @return the index in the stream of the pointed value.
+      Size index() const { return myIndex; }
+
+    private:
+      friend class boost::iterator_core_access;
+
+      Value const & dereference() const
+      {
+        ASSERT( myWindow->contains( myIndex ) );
+        return myWindow->myBuffer[ myIndex & myWindow->myMask ];
+      }
+      bool equal( const ConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+      void increment() { ++myIndex; }
+      void decrement() { --myIndex; }
+      void advance( std::ptrdiff_t n ) { myIndex += n; }
+      std::ptrdiff_t distance_to( const ConstIterator & other ) const
+      { return (std::ptrdiff_t) other.myIndex - (std::ptrdiff_t) myIndex; }
+
+      /// The visited window.
+      const Self* myWindow;
+      /// The index in the stream of the pointed value.
+      Size myIndex;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The window is empty and starts at index 0.
+     * @param aCapacity the initial capacity, rounded up to a power of two.
+     */
+    StreamWindow( Size aCapacity = 64 );
+
+    /**
+     * Empties the window, the next value receives the index 0.
+     */
+    void clear();
+
+    /**
+     * Appends a value at the back of the window.
+     * @param aValue any value.
+     */
+    void push_back( const Value & aValue );
+
+    /**
+     * Removes the values before @a it from the window.
+     * @param it any iterator between begin() and end().
+     */
+    void eraseBefore( const ConstIterator & it );
+
+    /// @return an iterator on the first value of the window.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last value of the window.
+    ConstIterator end() const;
+
+    /// @return the number of values in the window.
+    Size size() const;
+
+    /// @return the number of values that may be stored without reallocation.
+    Size capacity() const;
+
+    /**
+     * @param anIndex any index in the stream.
+     * @return 'true' iff the value of index @a anIndex is in the window.
+     */
+    bool contains( Size anIndex ) const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The circular buffer.
+    std::vector<Value> myBuffer;
+    /// The capacity minus one.
+    Size myMask;
+    /// The index of the first value of the window.
+    Size myFirst;
+    /// The index after the last value of the window.
+    Size myLast;
+
+  }; // end of class StreamWindow
+
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamingSegmentation
+  /**
+   * Description of template class 'StreamingSegmentation' <p>
+   * \brief Aim: Computes the greedy or the saturated segmentation of
+   * a curve given by a single-pass input iterator, e.g. a stream of
+   * points too large to be stored.
+   *
+   * The points are read once and kept in a StreamWindow, from the
+   * first point of the current segment to the last read point. Each
+   * segment is given to a functor as soon as it cannot be extended
+   * anymore, and the points before the next segment are then
+   * forgotten. The memory is thus bounded by the length of the
+   * longest segment.
+   *
+   * The segments are the ones of GreedySegmentation and of
+   * SaturatedSegmentation (in the default "First" mode) along the
+   * whole range of points. The segment computer is any model of
+   * CForwardSegmentComputer whose ConstIterator is
+   * StreamWindow<Point>::ConstIterator, like Naive3DDSSComputer or
+   * StandardDSS6Computer:
+   *
+   * @code
+   typedef PointVector<3,int> Point;
+   typedef StreamWindow<Point>::ConstIterator ConstIterator;
+   typedef Naive3DDSSComputer<ConstIterator, DGtal::int64_t, 8> SegmentComputer;
+   StreamingSegmentation<SegmentComputer> segmentation;
+   // itb, ite: any single pass input iterators on Point, e.g. reading a file.
+   segmentation.greedySegmentation( itb, ite, functor );
+   * @endcode
+   *
+   * The functor is called as aFunctor( aSegmentComputer ). The
+   * iterators of the segment computer are valid only during this
+   * call, their method index() gives the position of the points in
+   * the stream.
+   *
+   * @tparam TSegmentComputer any model of CForwardSegmentComputer
+   * on StreamWindow<Point>::ConstIterator.
+   *
+   * @see GreedySegmentation SaturatedSegmentation
+   */
+  template <typename TSegmentComputer>
+  class StreamingSegmentation
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CForwardSegmentComputer<TSegmentComputer> ));
+
+    // ----------------------- Types ------------------------------
+  public:
+    typedef TSegmentComputer SegmentComputer;
+    typedef typename SegmentComputer::ConstIterator ConstIterator;
+    typedef typename IteratorCirculatorTraits<ConstIterator>::Value Point;
+    typedef StreamWindow<Point> Window;
+    typedef typename Window::Size Size;
+    BOOST_STATIC_ASSERT(( concepts::ConceptUtils::SameType< ConstIterator,
+                          typename Window::ConstIterator >::value ));
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor.
+     * @param aSegmentComputer a segment computer used as prototype.
+     */
+    StreamingSegmentation( const SegmentComputer& aSegmentComputer = SegmentComputer() );
+
+    /**
+     * Computes the greedy segmentation of the points of [itb,ite):
+     * the last point of a segment is the first point of the next one
+     * when the two points form a segment.
+     *
+     * @param itb begin iterator on the points, read once.
+     * @param ite end iterator on the points.
+     * @param aFunctor functor called on each segment, in order.
+     * @return the number of segments.
+     *
+     * @tparam TInputIterator a model of single pass input iterator.
+     * @tparam TFunctor a functor taking a const SegmentComputer&.
+     */
+    template <typename TInputIterator, typename TFunctor>
+    Size greedySegmentation( TInputIterator itb, const TInputIterator& ite,
+                             TFunctor& aFunctor );
+
+    /**
+     * Computes the maximal segments of the points of [itb,ite),
+     * i.e. the saturated segmentation.
+     *
+     * Each maximal segment is computed from the end of the previous
+     * one by a backward extension followed by a forward extension, as
+     * in SaturatedSegmentation.
+     *
+     * @param itb begin iterator on the points, read once.
+     * @param ite end iterator on the points.
+     * @param aFunctor functor called on each maximal segment, in order.
+     * @return the number of maximal segments.
+     *
+     * @tparam TInputIterator a model of single pass input iterator.
+     * @tparam TFunctor a functor taking a const SegmentComputer&.
+     */
+    template <typename TInputIterator, typename TFunctor>
+    Size saturatedSegmentation( TInputIterator itb, const TInputIterator& ite,
+                                TFunctor& aFunctor );
+
+    /**
+     * @return the largest number of points kept simultaneously by
+     * the last segmentation.
+     */
+    Size maxWindowSize() const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+     * Makes sure that the point pointed by @a it is in the window,
+     * reading one point of the stream if necessary.
+     * @return 'false' iff @a it is the end of the stream.
+     */
+    template <typename TInputIterator>
+    bool fill( const ConstIterator& it, TInputIterator& itb, const TInputIterator& ite );
+
+    /**
+     * Extends @a aSegmentComputer as long as possible, reading the
+     * stream if necessary.
+     * @return 'true' iff the end of the stream has been reached.
+     */
+    template <typename TInputIterator>
+    bool longestSegment( SegmentComputer& aSegmentComputer,
+                         TInputIterator& itb, const TInputIterator& ite );
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The prototype of segment computer.
+    SegmentComputer mySegmentComputer;
+    /// The points of the current segment and the read points after it.
+    Window myWindow;
+    /// The largest size of the window.
+    Size myMaxWindowSize;
+
+  }; // end of class StreamingSegmentation
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StreamingSegmentation'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StreamingSegmentation' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSegmentComputer>
+  std::ostream&
+  operator<< ( std::ostream & out, const StreamingSegmentation<TSegmentComputer> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/StreamingSegmentation.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingSegmentation_h
+
+#undef StreamingSegmentation_RECURSES
+#endif // else defined(StreamingSegmentation_RECURSES)
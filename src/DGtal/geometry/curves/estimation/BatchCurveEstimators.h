@@ -0,0 +1,212 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchCurveEstimators.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BatchCurveEstimators.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchCurveEstimators_RECURSES)
+#error Recursive header files inclusion detected in BatchCurveEstimators.h
+#else // defined(BatchCurveEstimators_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchCurveEstimators_RECURSES
+
+#if !defined BatchCurveEstimators_h
+/** Prevents repeated inclusion of headers. */
+#define BatchCurveEstimators_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/FreemanChainCollection.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/BinomialConvolver.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+#include "DGtal/geometry/curves/estimation/FunctorsLambdaMST.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class BatchCurveEstimators
+  /**
+   * Description of template class 'BatchCurveEstimators' <p>
+   * \brief Aim: Computes tangents, curvatures and lengths of all the
+   * contours of a FreemanChainCollection at once.
+   *
+   * Each contour is a closed Freeman chain of n codes, hence n
+   * distinct points (the last point of the chain, equal to the first
+   * one, is dropped). Per-point results are written in flat arrays
+   * indexed like the codes of the collection (the k-th point of the
+   * i-th contour is at index offset(i) + k), per-contour results in
+   * arrays indexed by the contours.
+   *
+   * The contours are processed in parallel with OpenMP (if
+   * available). Each thread decodes the points of its contours into
+   * its own scratch buffers and reuses them from a contour to the
+   * next, so that no memory is allocated per contour. The results are
+   * the same as the ones of the usual estimators applied to each
+   * contour with circulators:
+   * - tangents(): MostCenteredMaximalSegmentEstimator with
+   *   TangentFromDSSEstimator (4-connected DSSs).
+   * - lambdaMSTTangents(): the λ-MST tangent estimator (LambdaMST2D)
+   *   on the closed contour, i.e. with the maximal segments given by a
+   *   SaturatedSegmentation on circulators.
+   * - curvatures(): BinomialConvolver with
+   *   CurvatureFromBinomialConvolverFunctor, with the size of the
+   *   kernel given or suggested per contour.
+   * - lengths(): DSSLengthEstimator (length of the polygon given by
+   *   a greedy segmentation into DSSs).
+   *
+   * @code
+   FreemanChainCollection<int> contours;
+   ... // push_back of many closed chains
+   std::vector< PointVector<2,double> > tangents;
+   std::vector<double> curvatures, lengths;
+   BatchCurveEstimators<int>::tangents( contours, tangents );
+   BatchCurveEstimators<int>::curvatures( contours, curvatures, 0.1 );
+   BatchCurveEstimators<int>::lengths( contours, lengths, 0.1 );
+   * @endcode
+   *
+   * @tparam TInteger type of the coordinates of the contours.
+   *
+   * @see FreemanChainCollection, testBatchCurveEstimators.cpp
+   */
+  template <typename TInteger>
+  class BatchCurveEstimators
+  {
+  public:
+    typedef TInteger Integer;
+    typedef FreemanChainCollection<Integer> Collection;
+    typedef typename Collection::Point Point;
+    typedef typename Collection::Index Index;
+    typedef PointVector<2, double> RealVector;
+
+    /// Iterator and circulator on the points of a contour.
+    typedef typename std::vector<Point>::const_iterator PointConstIterator;
+    typedef Circulator<PointConstIterator> PointConstCirculator;
+    /// Segment computer used by the tangent and length estimators.
+    typedef ArithmeticalDSSComputer<PointConstCirculator, Integer, 4> DSSComputer;
+
+    // ----------------------- Static services ------------------------------
+  public:
+
+    /**
+     * Most centered maximal DSS tangent estimation.
+     * @param aContours a collection of closed chains.
+     * @param aTangents (returns) the unit tangent at each point
+     * (nbCodes() vectors).
+     */
+    static void tangents( const Collection & aContours,
+                          std::vector<RealVector> & aTangents );
+
+    /**
+     * λ-MST tangent estimation.
+     * @param aContours a collection of closed chains.
+     * @param aTangents (returns) the unit tangent at each point
+     * (nbCodes() vectors).
+     */
+    static void lambdaMSTTangents( const Collection & aContours,
+                                   std::vector<RealVector> & aTangents );
+
+    /**
+     * Binomial convolver curvature estimation.
+     * @param aContours a collection of closed chains.
+     * @param aCurvatures (returns) the curvature at each point
+     * (nbCodes() values).
+     * @param h the grid step.
+     * @param n the size parameter of the binomial kernel, or 0 to use
+     * BinomialConvolver::suggestedSize for each contour.
+     */
+    static void curvatures( const Collection & aContours,
+                            std::vector<double> & aCurvatures,
+                            double h, unsigned int n = 0 );
+
+    /**
+     * DSS length estimation.
+     * @param aContours a collection of closed chains.
+     * @param aLengths (returns) the length of each contour (size() values).
+     * @param h the grid step.
+     */
+    static void lengths( const Collection & aContours,
+                         std::vector<double> & aLengths,
+                         double h );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Decodes the distinct points of a closed contour.
+     * @param aContours a collection of closed chains.
+     * @param i the index of a contour.
+     * @param aPoints (returns) its points.
+     */
+    static void getPoints( const Collection & aContours, Index i,
+                           std::vector<Point> & aPoints );
+
+    /**
+     * Computes the binomial kernel of order 2n as Signal::G2n does.
+     * @param n the size parameter.
+     * @param aKernel (returns) the 2n+1 coefficients.
+     * @param aTmp a scratch buffer.
+     */
+    static void binomialKernel( unsigned int n, std::vector<double> & aKernel,
+                                std::vector<double> & aTmp );
+
+    /**
+     * Periodic convolution by a kernel centered at index @a aZero, as
+     * Signal::operator* does.
+     * @param aIn input signal.
+     * @param aKernel convolution kernel.
+     * @param aZero index of the kernel center.
+     * @param aOut (returns) output signal.
+     */
+    static void convolve( const std::vector<double> & aIn,
+                          const std::vector<double> & aKernel, int aZero,
+                          std::vector<double> & aOut );
+
+  }; // end of class BatchCurveEstimators
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/curves/estimation/BatchCurveEstimators.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchCurveEstimators_h
+
+#undef BatchCurveEstimators_RECURSES
+#endif // else defined(BatchCurveEstimators_RECURSES)
@@ -44,6 +44,7 @@
 // Inclusions
 #include <iostream>
 #include <set>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CInteger.h"
 #include "DGtal/kernel/CSpace.h"
@@ -160,7 +161,9 @@ namespace DGtal
     typedef PointVector< 3, InternalInteger > InternalPoint3;
     typedef SpaceND< 2, InternalInteger > InternalSpace2;
     typedef typename InternalSpace2::Point InternalPoint2;
-    typedef LatticePolytope2D< InternalSpace2 > ConvexPolygonZ2;
+    /// The search space is cut at each step: a contiguous sequence
+    /// avoids one allocation per vertex.
+    typedef LatticePolytope2D< InternalSpace2, std::vector<InternalPoint2> > ConvexPolygonZ2;
     typedef typename ConvexPolygonZ2::HalfSpace HalfSpace;
 
     /**
@@ -0,0 +1,306 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file BatchTensorVotingFeatureExtraction.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module BatchTensorVotingFeatureExtraction.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(BatchTensorVotingFeatureExtraction_RECURSES)
+#error Recursive header files inclusion detected in BatchTensorVotingFeatureExtraction.h
+#else // defined(BatchTensorVotingFeatureExtraction_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define BatchTensorVotingFeatureExtraction_RECURSES
+
+#if !defined BatchTensorVotingFeatureExtraction_h
+/** Prevents repeated inclusion of headers. */
+#define BatchTensorVotingFeatureExtraction_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/base/CUnaryFunctor.h"
+#include "DGtal/geometry/volumes/distance/CMetricSpace.h"
+#include "DGtal/topology/CDigitalSurfaceContainer.h"
+#include "DGtal/topology/DigitalSurfaceCSRGraph.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class BatchTensorVotingFeatureExtraction
+/**
+* Description of template class 'BatchTensorVotingFeatureExtraction' <p>
+* \brief Aim: Computes the tensor voting feature score of
+* functors::TensorVotingFeatureExtraction at many surfels of a digital
+* surface at once, in parallel with OpenMP.
+*
+* As with LocalEstimatorFromSurfelFunctorAdapter, the neighborhood of
+* a surfel @a s is the set of surfels connected to @a s through
+* surfels at distance lower than the radius from @a s, the surfels
+* being embedded with CanonicSCellEmbedder. Each neighbor votes with
+* the tensor @f$I - vv^T/\|vv^T\|@f$ weighted by the convolution
+* kernel, and the score is the ratio
+* @f$\frac{\lambda_1+\lambda_2}{\lambda_3}@f$ of the eigenvalues of
+* the accumulated tensor.
+*
+* The batch evaluation differs from the surfel by surfel one in the
+* following ways:
+* - the neighborhoods are traversed on the adjacency arrays of a
+*   DigitalSurfaceCSRGraph, built once at construction;
+* - the kernel weights of all the Khalimsky offsets within the radius
+*   are precomputed in a table, so that neither the metric nor the
+*   kernel are evaluated during the traversals;
+* - the votes of a neighborhood are gathered in coordinate arrays
+*   and accumulated in a loop without branches;
+* - the eigenvalues are computed in closed form from the six
+*   coefficients of the symmetric tensors, stored in one array per
+*   coefficient.
+*
+* The metric is evaluated on the doubled offsets between Khalimsky
+* coordinates, which are integer, and divided by 2. It must thus be
+* translation invariant, homogeneous and not lower than the
+* @f$l_\infty@f$ distance, as the @f$l_p@f$ metrics
+* ExactPredicateLpSeparableMetric. Distances are therefore exact
+* distances between the canonical embeddings of the surfels.
+*
+* @code
+* typedef BatchTensorVotingFeatureExtraction<SurfaceContainer, Z3i::L2Metric, functors::GaussianKernel> Batch;
+* functors::GaussianKernel kernel( 1.0 );
+* Batch batch( surface, Z3i::l2Metric, kernel, 4.0 );
+* std::vector<double> scores;
+* batch.eval( surface.begin(), surface.end(), std::back_inserter( scores ) );
+* @endcode
+*
+* @tparam TDigitalSurfaceContainer any model of digital surface
+* container concept (CDigitalSurfaceContainer), of dimension 3.
+* @tparam TMetric any model of CMetricSpace as described above.
+* @tparam TConvolutionFunctor type of functor on double
+* [0,1]->[0,1] to implement the response of a symmetric convolution
+* kernel (e.g. functors::GaussianKernel).
+*
+* @see testBatchTensorVotingFeatureExtraction.cpp
+*/
+template <typename TDigitalSurfaceContainer, typename TMetric, typename TConvolutionFunctor>
+class BatchTensorVotingFeatureExtraction
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CDigitalSurfaceContainer<TDigitalSurfaceContainer> ));
+  BOOST_CONCEPT_ASSERT(( concepts::CMetricSpace<TMetric> ));
+  BOOST_CONCEPT_ASSERT(( concepts::CUnaryFunctor<TConvolutionFunctor,double,double> ));
+  BOOST_STATIC_ASSERT(( TDigitalSurfaceContainer::KSpace::dimension == 3 ));
+
+public:
+  typedef BatchTensorVotingFeatureExtraction<TDigitalSurfaceContainer, TMetric, TConvolutionFunctor> Self;
+  typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+  typedef TMetric Metric;
+  typedef TConvolutionFunctor ConvolutionFunctor;
+  typedef DigitalSurfaceCSRGraph<DigitalSurfaceContainer> Graph;
+  typedef typename Graph::Surface Surface;
+  typedef typename Graph::Surfel Surfel;
+  typedef typename Graph::Vertex Vertex;
+  typedef typename Graph::KSpace KSpace;
+  typedef typename KSpace::Integer Integer;
+  typedef double Quantity;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+  * Constructor. Builds the adjacency arrays of the surface and the
+  * table of kernel weights.
+  *
+  * @param aSurface the digital surface.
+  * @param aMetric the metric which defines the neighborhoods.
+  * @param aConvolutionFunctor the convolution kernel, evaluated at
+  * (radius - distance) / radius.
+  * @param radius the radius of the neighborhoods (>0), in the unit
+  * of the canonical embedding.
+  */
+  BatchTensorVotingFeatureExtraction( ConstAlias<Surface> aSurface,
+                                      ConstAlias<Metric> aMetric,
+                                      ConstAlias<ConvolutionFunctor> aConvolutionFunctor,
+                                      const double radius );
+
+  /**
+  * Destructor.
+  */
+  ~BatchTensorVotingFeatureExtraction();
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+  * Computes the feature scores of a range of surfels of the surface.
+  *
+  * @param itb iterator on the first surfel.
+  * @param ite iterator after the last surfel.
+  * @param result output iterator on the scores, one per surfel, in
+  * the order of the range.
+  * @return the output iterator after the last score.
+  *
+  * @tparam SurfelConstIterator a model of forward iterator on Surfel.
+  * @tparam OutputIterator a model of output iterator on Quantity.
+  */
+  template <typename SurfelConstIterator, typename OutputIterator>
+  OutputIterator eval( const SurfelConstIterator & itb,
+                       const SurfelConstIterator & ite,
+                       OutputIterator result ) const;
+
+  /**
+  * @param s a surfel of the surface.
+  * @return the feature score at @a s.
+  */
+  Quantity eval( const Surfel & s ) const;
+
+  /**
+  * Computes in closed form the eigenvalues of a symmetric 3x3
+  * matrix, with the trigonometric solution of its characteristic
+  * polynomial.
+  *
+  * @param a00 the coefficient (0,0) of the matrix.
+  * @param a01 the coefficients (0,1) and (1,0).
+  * @param a02 the coefficients (0,2) and (2,0).
+  * @param a11 the coefficient (1,1).
+  * @param a12 the coefficients (1,2) and (2,1).
+  * @param a22 the coefficient (2,2).
+  * @param[out] l0 the smallest eigenvalue.
+  * @param[out] l1 the middle eigenvalue.
+  * @param[out] l2 the largest eigenvalue.
+  */
+  static void eigenValues( const double a00, const double a01, const double a02,
+                           const double a11, const double a12, const double a22,
+                           double & l0, double & l1, double & l2 );
+
+  /**
+  * @return the adjacency arrays of the surface.
+  */
+  const Graph & graph() const;
+
+  /**
+  * @return the radius of the neighborhoods.
+  */
+  double radius() const;
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  /// The adjacency arrays of the surface.
+  Graph myGraph;
+  /// The radius of the neighborhoods.
+  double myRadius;
+  /// The Khalimsky coordinates of the surfels, one array per axis.
+  std::vector<Integer> myCoordinates[ 3 ];
+  /// The maximal absolute value of an offset coordinate in the table.
+  Integer myHalfWidth;
+  /// The kernel weight of each Khalimsky offset, negative outside the radius.
+  std::vector<double> myWeights;
+
+  // ------------------------- Hidden services ------------------------------
+protected:
+
+  /**
+  * Constructor.
+  * Forbidden by default (protected to avoid g++ warnings).
+  */
+  BatchTensorVotingFeatureExtraction();
+
+private:
+
+  /**
+  * Copy constructor.
+  * @param other the object to clone.
+  * Forbidden by default.
+  */
+  BatchTensorVotingFeatureExtraction ( const BatchTensorVotingFeatureExtraction & other );
+
+  /**
+  * Assignment.
+  * @param other the object to copy.
+  * @return a reference on 'this'.
+  * Forbidden by default.
+  */
+  BatchTensorVotingFeatureExtraction & operator= ( const BatchTensorVotingFeatureExtraction & other );
+
+  // ------------------------- Internals ------------------------------------
+private:
+
+  /**
+  * Computes the table of kernel weights.
+  * @param aMetric the metric which defines the neighborhoods.
+  * @param aConvolutionFunctor the convolution kernel.
+  */
+  void computeWeights( const Metric & aMetric,
+                       const ConvolutionFunctor & aConvolutionFunctor );
+
+  /**
+  * Computes the feature scores at some vertices of the graph.
+  * @param vertices the vertices.
+  * @param[out] scores their scores, resized.
+  */
+  void evalVertices( const std::vector<Vertex> & vertices,
+                     std::vector<Quantity> & scores ) const;
+
+}; // end of class BatchTensorVotingFeatureExtraction
+
+
+/**
+* Overloads 'operator<<' for displaying objects of class 'BatchTensorVotingFeatureExtraction'.
+* @param out the output stream where the object is written.
+* @param object the object of class 'BatchTensorVotingFeatureExtraction' to write.
+* @return the output stream after the writing.
+*/
+template <typename TDigitalSurfaceContainer, typename TMetric, typename TConvolutionFunctor>
+std::ostream&
+operator<< ( std::ostream & out,
+             const BatchTensorVotingFeatureExtraction<TDigitalSurfaceContainer, TMetric, TConvolutionFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/BatchTensorVotingFeatureExtraction.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined BatchTensorVotingFeatureExtraction_h
+
+#undef BatchTensorVotingFeatureExtraction_RECURSES
+#endif // else defined(BatchTensorVotingFeatureExtraction_RECURSES)
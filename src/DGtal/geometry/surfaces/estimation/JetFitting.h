@@ -0,0 +1,252 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file JetFitting.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module JetFitting.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(JetFitting_RECURSES)
+#error Recursive header files inclusion detected in JetFitting.h
+#else // defined(JetFitting_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define JetFitting_RECURSES
+
+#if !defined JetFitting_h
+/** Prevents repeated inclusion of headers. */
+#define JetFitting_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/math/linalg/EigenSupport.h"
+//////////////////////////////////////////////////////////////////////////////
+
+#if !defined(WITH_EIGEN)
+#error You need to have activated EIGEN (WITH_EIGEN) to include this file.
+#endif
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class JetFitting
+  /**
+   * Description of template class 'JetFitting' <p>
+   * \brief Aim: Fits a polynomial height function (a jet) to a set of
+   * 3D points and computes the normal vector and principal curvatures
+   * of its Monge form at the first point, as CGAL Monge_via_jet_fitting
+   * does, using Eigen only.
+   *
+   * The local frame is given by the principal component analysis of
+   * the points, whose moments are accumulated as points are pushed. At
+   * fit time, the normal equations of the least squares problem are
+   * accumulated in one pass over the points in scaled local coordinates
+   * and solved with an LDLT factorization. Points and matrices are kept
+   * between fits: after reset(), fitting a neighborhood of similar size
+   * does not allocate memory.
+   *
+   * The orientation of the normal vector, hence the sign of curvatures,
+   * is the one of the smallest principal axis and is arbitrary.
+   *
+   * @code
+   JetFitting<Z3i::RealPoint> fitting;
+   for (...) fitting.push(point);
+   if (fitting.fit(4)) trace.info() << fitting.meanCurvature() << std::endl;
+   fitting.reset();
+   * @endcode
+   *
+   * @tparam TRealPoint type of 3D points, e.g. Z3i::RealPoint.
+   */
+  template <typename TRealPoint>
+  class JetFitting
+  {
+    // ----------------------- Standard services ------------------------------
+  public:
+    typedef TRealPoint RealPoint;
+    typedef Eigen::Vector3d Vector;
+    typedef Eigen::Matrix3d Matrix;
+    typedef Eigen::VectorXd DenseVector;
+    typedef Eigen::MatrixXd DenseMatrix;
+
+    BOOST_STATIC_ASSERT(( RealPoint::dimension == 3 ));
+
+    /**
+     * Constructor.
+     */
+    JetFitting();
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Forget the points, keeping allocated memory.
+     */
+    void
+    reset();
+
+    /**
+     * Add a point. The first point is the one at which the Monge form is computed.
+     * @param point a point.
+     */
+    void
+    push(const RealPoint& point);
+
+    /**
+     * @return number of points.
+     */
+    std::size_t
+    size() const;
+
+    /**
+     * Fit a jet to the points. The degree is lowered when there are
+     * fewer points than polynomial coefficients.
+     * @param degree degree of the fitted polynomial, at least 1.
+     * @return true if the fit succeeded.
+     */
+    bool
+    fit(const unsigned int degree);
+
+    /**
+     * @return degree of the last fitted polynomial.
+     */
+    unsigned int
+    degree() const;
+
+    /**
+     * @return unit normal vector of the fitted surface at the first point.
+     */
+    RealPoint
+    normal() const;
+
+    /**
+     * @return maximal and minimal principal curvatures at the first point.
+     */
+    std::pair<double, double>
+    principalCurvatures() const;
+
+    /**
+     * @return mean curvature at the first point.
+     */
+    double
+    meanCurvature() const;
+
+    /**
+     * @return Gaussian curvature at the first point.
+     */
+    double
+    gaussianCurvature() const;
+
+    /**
+     * @return coefficients of the fitted polynomial in the local frame,
+     * monomials \f$x^i y^j\f$ ordered by total degree then by increasing \f$j\f$.
+     */
+    const DenseVector&
+    coefficients() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void
+    selfDisplay(std::ostream& out) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the last fit succeeded, 'false' otherwise.
+     */
+    bool
+    isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+
+    /// Points relative to the first one.
+    std::vector<Vector> myPoints;
+    /// First point.
+    Vector myOrigin;
+    /// Sum of the relative points.
+    Vector mySum;
+    /// Sum of the outer products of the relative points.
+    Matrix mySecondMoments;
+
+    /// Rows are the principal axes, the last one is the height direction.
+    Matrix myFrame;
+    /// Normal matrix of the least squares problem (lower part).
+    DenseMatrix myNormalMatrix;
+    /// Right hand side of the normal equations.
+    DenseVector myRightHandSide;
+    /// Monomials of one point.
+    DenseVector myMonomials;
+    /// Powers of the coordinates of one point.
+    DenseMatrix myPowers;
+    /// Fitted coefficients.
+    DenseVector myCoefficients;
+    /// Factorization of the normal matrix.
+    Eigen::LDLT<DenseMatrix> myFactorization;
+
+    unsigned int myDegree;
+    bool myValid;
+    Vector myNormal;
+    double myMaxCurvature;
+    double myMinCurvature;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Fill the monomials of a point.
+     * @param u first scaled local coordinate.
+     * @param v second scaled local coordinate.
+     */
+    void
+    computeMonomials(const double u, const double v);
+
+  }; // end of class JetFitting
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'JetFitting'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'JetFitting' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TRealPoint>
+  std::ostream&
+  operator<<(std::ostream& out, const JetFitting<TRealPoint>& object);
+
+} // namespace DGtal
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/JetFitting.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined JetFitting_h
+
+#undef JetFitting_RECURSES
+#endif // else defined(JetFitting_RECURSES)
@@ -273,6 +273,25 @@ namespace DGtal
                         const SurfelConstIterator& ite,
                         OutputIterator result) const;
 
+    /**
+     * Evaluates the quantity in the range [itb,ite) with one copy of
+     * the functor and of the digital surface per OpenMP thread, as
+     * eval(itb, ite, result) does sequentially without OpenMP. The
+     * functor must thus be copy constructible, and the surface
+     * container, metric and convolution functor must support
+     * concurrent const access.
+     *
+     * @return the estimated quantity in the range [itb,ite)
+     * @param [in] itb starting surfel iterator.
+     * @param [in] ite end surfel iterator.
+     * @param [in,out] result resulting output iterator
+     *
+     */
+    template< typename SurfelConstIterator, typename OutputIterator>
+    OutputIterator evalParallel(const SurfelConstIterator& itb,
+                                const SurfelConstIterator& ite,
+                                OutputIterator result) const;
+
 
     /**
      * Writes/Displays the object on an output stream.
@@ -290,6 +309,14 @@ namespace DGtal
 
   private:
 
+    /**
+     * @return the quantity estimated by a given functor at a surfel.
+     * @param [in] aSurface the digital surface to visit, a copy of mySurface.
+     * @param [in] aSurfel the surfel at which we evaluate the quantity.
+     * @param [in,out] aFunctor the functor on surfels, reset afterwards.
+     */
+    Quantity evalWithFunctor(const Surface& aSurface, const Surfel& aSurfel,
+                             FunctorOnSurfel& aFunctor) const;
 
     // ------------------------- Internals ------------------------------------
   private:
@@ -0,0 +1,232 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingIntegralInvariantVolumeEstimator.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module StreamingIntegralInvariantVolumeEstimator.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingIntegralInvariantVolumeEstimator_RECURSES)
+#error Recursive header files inclusion detected in StreamingIntegralInvariantVolumeEstimator.h
+#else // defined(StreamingIntegralInvariantVolumeEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingIntegralInvariantVolumeEstimator_RECURSES
+
+#if !defined StreamingIntegralInvariantVolumeEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingIntegralInvariantVolumeEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+/////////////////////////////////////////////////////////////////////////////
+// template class StreamingIntegralInvariantVolumeEstimator
+/**
+* Description of template class 'StreamingIntegralInvariantVolumeEstimator' <p>
+* \brief Aim: Computes for a surfel the volume of the intersection
+* of a shape with a ball of given radius centered on the surfel, as
+* IntegralInvariantVolumeEstimator does, from any point predicate
+* given at evaluation time.
+*
+* The digital ball is the one of IntegralInvariantVolumeEstimator
+* and the volume is the mean of the volumes at the two spels
+* incident to the surfel: both estimators give the same quantities.
+* Since the ball offsets are precomputed and the shape is only
+* evaluated at evaluation time, this estimator can be evaluated on
+* the window of a
+* StreamingDigitalSurface whose halo is at least halo(), so that the
+* surface and the shape are never entirely in memory:
+*
+* @code
+* typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> Functor;
+* StreamingIntegralInvariantVolumeEstimator<Z3i::KSpace, Functor> estimator( K, Functor() );
+* estimator.setParams( 5.0 );
+* estimator.init( h );
+* StreamingDigitalSurface<Z3i::KSpace, Predicate> streaming( K, predicate, estimator.halo() );
+* streaming.eval( estimator, std::ostream_iterator<double>( output, "\n" ) );
+* @endcode
+*
+* The call operator is const and can be evaluated concurrently.
+*
+* @tparam TKSpace a model of CCellularGridSpaceND, the cellular space
+* in which the shape is defined.
+*
+* @tparam TVolumeFunctor a model of functor Real -> Quantity, that
+* defines how the volume is transformed into e.g. a curvature. Models
+* include functors::IICurvatureFunctor and
+* functors::IIMeanCurvature3DFunctor.
+*
+* @see testStreamingDigitalSurface.cpp
+*/
+template <typename TKSpace, typename TVolumeFunctor>
+class StreamingIntegralInvariantVolumeEstimator
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND< TKSpace > ));
+
+public:
+  typedef StreamingIntegralInvariantVolumeEstimator<TKSpace, TVolumeFunctor> Self;
+  typedef TKSpace KSpace;
+  typedef TVolumeFunctor VolumeFunctor;
+  typedef typename KSpace::Integer Integer;
+  typedef typename KSpace::Size Size;
+  typedef typename KSpace::Point Point;
+  typedef typename KSpace::SCell SCell;
+  typedef typename KSpace::SCell Surfel;
+  typedef typename VolumeFunctor::Quantity Quantity;
+  typedef double Scalar;
+
+  // ----------------------- Standard services ------------------------------
+public:
+
+  /**
+  * Constructor.
+  *
+  * @param[in] K the cellular grid space in which the shape is defined.
+  * @param[in] fct the volume functor used to transform the volume
+  * into a quantity, initialized by init().
+  */
+  StreamingIntegralInvariantVolumeEstimator( ConstAlias<KSpace> K,
+                                             VolumeFunctor fct = VolumeFunctor() );
+
+  // ----------------------- Interface --------------------------------------
+public:
+
+  /**
+  * @return the gridstep.
+  */
+  Scalar h() const;
+
+  /**
+  * Set specific parameters: the radius of the ball.
+  *
+  * @param[in] dRadius the "digital" radius of the kernel (but may be non integer).
+  */
+  void setParams( const double dRadius );
+
+  /**
+  * Initialisation: computes the ball offsets and initializes the
+  * volume functor.
+  *
+  * @param[in] _h grid size (must be >0).
+  */
+  void init( const double _h );
+
+  /**
+  * @return the number of slices on each side of a surfel that are
+  * evaluated by the estimator.
+  */
+  Integer halo() const;
+
+  /**
+  * @return the number of points of the digital ball.
+  */
+  Size kernelSize() const;
+
+  /**
+  * @tparam PointPredicate a model of concepts::CPointPredicate.
+  * @param[in] aSurfel a surfel of the boundary of the shape.
+  * @param[in] aPointPredicate the shape, e.g. a StreamingDigitalSurface::Window.
+  * @return the mean number of points of the shape in the balls
+  * centered at the two spels incident to @a aSurfel.
+  */
+  template <typename PointPredicate>
+  Scalar volume( const Surfel & aSurfel, const PointPredicate & aPointPredicate ) const;
+
+  /**
+  * -- Estimation --
+  *
+  * @tparam PointPredicate a model of concepts::CPointPredicate.
+  * @param[in] aSurfel a surfel of the boundary of the shape.
+  * @param[in] aPointPredicate the shape, e.g. a StreamingDigitalSurface::Window.
+  * @return the estimated quantity at @a aSurfel.
+  */
+  template <typename PointPredicate>
+  Quantity operator()( const Surfel & aSurfel, const PointPredicate & aPointPredicate ) const;
+
+  /**
+  * Writes/Displays the object on an output stream.
+  * @param out the output stream where the object is written.
+  */
+  void selfDisplay ( std::ostream & out ) const;
+
+  /**
+  * Checks the validity/consistency of the object.
+  * @return 'true' if the object is valid, 'false' otherwise.
+  */
+  bool isValid() const;
+
+  // ------------------------- Hidden services ------------------------------
+private:
+
+  /**
+  * @param[in] aCenter the center of the ball.
+  * @param[in] aPointPredicate the shape.
+  * @return the number of points of the shape in the ball centered at @a aCenter.
+  */
+  template <typename PointPredicate>
+  Size count( const Point & aCenter, const PointPredicate & aPointPredicate ) const;
+
+  // ------------------------- Private Datas --------------------------------
+private:
+
+  const KSpace* myKSpace;       ///< The cellular grid space.
+  VolumeFunctor myFct;          ///< The volume functor that transforms the volume into a quantity.
+  std::vector<Point> myOffsets; ///< Offsets of the points of the digital ball.
+  Scalar myH;                   ///< precision of the grid
+  Scalar myRadius;              ///< Digital radius of the kernel
+
+}; // end of class StreamingIntegralInvariantVolumeEstimator
+
+/**
+* Overloads 'operator<<' for displaying objects of class 'StreamingIntegralInvariantVolumeEstimator'.
+* @param out the output stream where the object is written.
+* @param object the object of class 'StreamingIntegralInvariantVolumeEstimator' to write.
+* @return the output stream after the writing.
+*/
+template <typename TKSpace, typename TVolumeFunctor>
+std::ostream&
+operator<< ( std::ostream & out, const StreamingIntegralInvariantVolumeEstimator<TKSpace, TVolumeFunctor> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/geometry/surfaces/estimation/StreamingIntegralInvariantVolumeEstimator.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingIntegralInvariantVolumeEstimator_h
+
+#undef StreamingIntegralInvariantVolumeEstimator_RECURSES
+#endif // else defined(StreamingIntegralInvariantVolumeEstimator_RECURSES)
@@ -95,7 +95,12 @@ LocalEstimatorFromSurfelFunctorAdapter.
   functors::LinearLeastSquareFittingNormalVectorEstimator (if WITH_CGAL),
   functors::ElementaryConvolutionNormalVectorEstimator,
   functors::TensorVotingFeatureExtraction,
-  functors::SphereFittingEstimator (if WITH_PATATE)
+  functors::SphereFittingEstimator (if WITH_PATATE),
+  functors::JetFittingGaussianCurvatureEstimator (if WITH_EIGEN),
+  functors::JetFittingMeanCurvatureEstimator (if WITH_EIGEN),
+  functors::JetFittingPrincipalCurvaturesEstimator (if WITH_EIGEN),
+  functors::JetFittingNormalVectorEstimator (if WITH_EIGEN),
+  functors::OrientedSphereFittingEstimator
 
 ### Notes
 
@@ -0,0 +1,325 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file JetFittingEstimators.h
+ * @brief Normal vector and curvature estimators from jet fitting, without CGAL.
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testJetFitting.cpp
+ */
+
+#if defined(JetFittingEstimators_RECURSES)
+#error Recursive header files inclusion detected in JetFittingEstimators.h
+#else // defined(JetFittingEstimators_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define JetFittingEstimators_RECURSES
+
+#if !defined JetFittingEstimators_h
+/** Prevents repeated inclusion of headers. */
+#define JetFittingEstimators_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <utility>
+#include <DGtal/base/Common.h>
+#include <DGtal/base/ConstAlias.h>
+#include <DGtal/geometry/surfaces/estimation/JetFitting.h>
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace functors
+  {
+  /////////////////////////////////////////////////////////////////////////////
+  // template class JetFittingEstimatorBase
+  /**
+   * Description of template class 'JetFittingEstimatorBase' <p>
+   * \brief Aim: Collects the embedded surfels of a neighborhood in a
+   * JetFitting, base of the jet fitting estimators.
+   *
+   * The JetFitting keeps its buffers between neighborhoods, and copies
+   * of the estimator are independent, so that one copy per thread can be
+   * used by LocalEstimatorFromSurfelFunctorAdapter::evalParallel.
+   *
+   * @tparam TSurfel type of surfels
+   * @tparam TEmbedder type of functors which embed surfel to @f$ \mathbb{R}^3@f$
+   */
+  template <typename TSurfel, typename TEmbedder>
+  class JetFittingEstimatorBase
+  {
+  public:
+
+    typedef TSurfel Surfel;
+    typedef TEmbedder SCellEmbedder;
+    typedef typename SCellEmbedder::RealPoint RealPoint;
+
+    /**
+     * Constructor.
+     *
+     * @param anEmbedder embedder to map surfel to R^n.
+     * @param h gridstep
+     * @param d degree of the polynomial surface to fit.
+     */
+    JetFittingEstimatorBase(ConstAlias<SCellEmbedder> anEmbedder, const double h, unsigned int d = 4):
+      myEmbedder(&anEmbedder), myH(h), myD(d)
+    {
+      FATAL_ERROR_MSG(d>=2, "Polynomial surface degree must be greater than 2");
+    }
+
+    /**
+     * Add the geometrical embedding of a surfel to the fitted points.
+     *
+     * @param aSurf a surfel to add
+     * @param aDistance distance of aSurf to the neighborhood boundary
+     */
+    void pushSurfel(const Surfel & aSurf,
+                    const double aDistance)
+    {
+      BOOST_VERIFY(aDistance==aDistance);
+
+      const RealPoint p = myEmbedder->operator()(aSurf);
+      myFitting.push(p*myH);
+    }
+
+    /**
+     * Reset the fitted points.
+     */
+    void reset()
+    {
+      myFitting.reset();
+    }
+
+  protected:
+
+    /**
+     * Fit the jet to the pushed points.
+     * @return true if the fit succeeded.
+     */
+    bool fit()
+    {
+      return myFitting.fit(myD);
+    }
+
+    ///Jet fitting of the neighborhood
+    JetFitting<RealPoint> myFitting;
+
+  private:
+
+    ///Alias of the geometrical embedder
+    const SCellEmbedder * myEmbedder;
+
+    ///Grid Step
+    double myH;
+
+    ///Degree of the polynomial surface to fit
+    unsigned int myD;
+
+  }; // end of class JetFittingEstimatorBase
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class JetFittingNormalVectorEstimator
+  /**
+   * Description of template class 'JetFittingNormalVectorEstimator' <p>
+   * \brief Aim: Estimates normal vector using jet fitting and Monge
+   * form, without CGAL (see MongeJetFittingNormalVectorEstimator).
+   *
+   * model of concepts::CLocalEstimatorFromSurfelFunctor.
+   *
+   * @tparam TSurfel type of surfels
+   * @tparam TEmbedder type of functors which embed surfel to @f$ \mathbb{R}^3@f$
+   */
+  template <typename TSurfel, typename TEmbedder>
+  class JetFittingNormalVectorEstimator: public JetFittingEstimatorBase<TSurfel, TEmbedder>
+  {
+  public:
+
+    typedef JetFittingEstimatorBase<TSurfel, TEmbedder> Base;
+    typedef typename Base::Surfel Surfel;
+    typedef typename Base::SCellEmbedder SCellEmbedder;
+    typedef typename Base::RealPoint RealPoint;
+    typedef RealPoint Quantity;
+
+    /**
+     * Constructor.
+     *
+     * @param anEmbedder embedder to map surfel to R^n.
+     * @param h gridstep
+     * @param d degree of the polynomial surface to fit (default d=4).
+     */
+    JetFittingNormalVectorEstimator(ConstAlias<SCellEmbedder> anEmbedder, const double h, unsigned int d = 4):
+      Base(anEmbedder, h, d)
+    {}
+
+    /**
+     * Evaluate the normal vector from Monge form.
+     *
+     * @return the normal vector, the null vector if the fit failed.
+     */
+    Quantity eval()
+    {
+      return this->fit() ? this->myFitting.normal() : RealPoint();
+    }
+  }; // end of class JetFittingNormalVectorEstimator
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class JetFittingMeanCurvatureEstimator
+  /**
+   * Description of template class 'JetFittingMeanCurvatureEstimator' <p>
+   * \brief Aim: Estimates mean curvature using jet fitting and Monge
+   * form, without CGAL (see MongeJetFittingMeanCurvatureEstimator).
+   *
+   * model of concepts::CLocalEstimatorFromSurfelFunctor.
+   *
+   * @tparam TSurfel type of surfels
+   * @tparam TEmbedder type of functors which embed surfel to @f$ \mathbb{R}^3@f$
+   */
+  template <typename TSurfel, typename TEmbedder>
+  class JetFittingMeanCurvatureEstimator: public JetFittingEstimatorBase<TSurfel, TEmbedder>
+  {
+  public:
+
+    typedef JetFittingEstimatorBase<TSurfel, TEmbedder> Base;
+    typedef typename Base::Surfel Surfel;
+    typedef typename Base::SCellEmbedder SCellEmbedder;
+    typedef double Quantity;
+
+    /**
+     * Constructor.
+     *
+     * @param anEmbedder embedder to map surfel to R^n.
+     * @param h gridstep
+     * @param d degree of the polynomial surface to fit (default d=4).
+     */
+    JetFittingMeanCurvatureEstimator(ConstAlias<SCellEmbedder> anEmbedder, const double h, unsigned int d = 4):
+      Base(anEmbedder, h, d)
+    {}
+
+    /**
+     * Evaluate the curvature from Monge form.
+     *
+     * @return the mean curvature, 0 if the fit failed.
+     */
+    Quantity eval()
+    {
+      return this->fit() ? this->myFitting.meanCurvature() : 0.;
+    }
+  }; // end of class JetFittingMeanCurvatureEstimator
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class JetFittingGaussianCurvatureEstimator
+  /**
+   * Description of template class 'JetFittingGaussianCurvatureEstimator' <p>
+   * \brief Aim: Estimates Gaussian curvature using jet fitting and Monge
+   * form, without CGAL (see MongeJetFittingGaussianCurvatureEstimator).
+   *
+   * model of concepts::CLocalEstimatorFromSurfelFunctor.
+   *
+   * @tparam TSurfel type of surfels
+   * @tparam TEmbedder type of functors which embed surfel to @f$ \mathbb{R}^3@f$
+   */
+  template <typename TSurfel, typename TEmbedder>
+  class JetFittingGaussianCurvatureEstimator: public JetFittingEstimatorBase<TSurfel, TEmbedder>
+  {
+  public:
+
+    typedef JetFittingEstimatorBase<TSurfel, TEmbedder> Base;
+    typedef typename Base::Surfel Surfel;
+    typedef typename Base::SCellEmbedder SCellEmbedder;
+    typedef double Quantity;
+
+    /**
+     * Constructor.
+     *
+     * @param anEmbedder embedder to map surfel to R^n.
+     * @param h gridstep
+     * @param d degree of the polynomial surface to fit (default d=4).
+     */
+    JetFittingGaussianCurvatureEstimator(ConstAlias<SCellEmbedder> anEmbedder, const double h, unsigned int d = 4):
+      Base(anEmbedder, h, d)
+    {}
+
+    /**
+     * Evaluate the curvature from Monge form.
+     *
+     * @return the Gaussian curvature, 0 if the fit failed.
+     */
+    Quantity eval()
+    {
+      return this->fit() ? this->myFitting.gaussianCurvature() : 0.;
+    }
+  }; // end of class JetFittingGaussianCurvatureEstimator
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class JetFittingPrincipalCurvaturesEstimator
+  /**
+   * Description of template class 'JetFittingPrincipalCurvaturesEstimator' <p>
+   * \brief Aim: Estimates principal curvatures using jet fitting and
+   * Monge form, without CGAL (see MongeJetFittingPrincipalCurvaturesEstimator).
+   *
+   * model of concepts::CLocalEstimatorFromSurfelFunctor.
+   *
+   * @tparam TSurfel type of surfels
+   * @tparam TEmbedder type of functors which embed surfel to @f$ \mathbb{R}^3@f$
+   */
+  template <typename TSurfel, typename TEmbedder>
+  class JetFittingPrincipalCurvaturesEstimator: public JetFittingEstimatorBase<TSurfel, TEmbedder>
+  {
+  public:
+
+    typedef JetFittingEstimatorBase<TSurfel, TEmbedder> Base;
+    typedef typename Base::Surfel Surfel;
+    typedef typename Base::SCellEmbedder SCellEmbedder;
+    typedef std::pair<double, double> Quantity;
+
+    /**
+     * Constructor.
+     *
+     * @param anEmbedder embedder to map surfel to R^n.
+     * @param h gridstep
+     * @param d degree of the polynomial surface to fit (default d=4).
+     */
+    JetFittingPrincipalCurvaturesEstimator(ConstAlias<SCellEmbedder> anEmbedder, const double h, unsigned int d = 4):
+      Base(anEmbedder, h, d)
+    {}
+
+    /**
+     * Evaluate the curvatures from Monge form.
+     *
+     * @return the maximal and minimal principal curvatures, (0,0) if the fit failed.
+     */
+    Quantity eval()
+    {
+      return this->fit() ? this->myFitting.principalCurvatures() : Quantity(0., 0.);
+    }
+  }; // end of class JetFittingPrincipalCurvaturesEstimator
+  }
+} // namespace DGtal
+
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined JetFittingEstimators_h
+
+#undef JetFittingEstimators_RECURSES
+#endif // else defined(JetFittingEstimators_RECURSES)
@@ -0,0 +1,266 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file OrientedSphereFittingEstimator.h
+ * @brief Local algebraic sphere fitting from points and normal vectors, without Patate.
+ *
+ * @date 2026/10/18
+ *
+ * This file is part of the DGtal library.
+ *
+ * @see testJetFitting.cpp
+ */
+
+#if defined(OrientedSphereFittingEstimator_RECURSES)
+#error Recursive header files inclusion detected in OrientedSphereFittingEstimator.h
+#else // defined(OrientedSphereFittingEstimator_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define OrientedSphereFittingEstimator_RECURSES
+
+#if !defined OrientedSphereFittingEstimator_h
+/** Prevents repeated inclusion of headers. */
+#define OrientedSphereFittingEstimator_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <cmath>
+#include <limits>
+#include <DGtal/base/Common.h>
+#include <DGtal/base/ConstAlias.h>
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace functors
+  {
+    /////////////////////////////////////////////////////////////////////////////
+    // template class OrientedSphereFittingEstimator
+    /**
+     * Description of template class 'OrientedSphereFittingEstimator' <p>
+     * \brief Aim: Performs a local algebraic sphere fitting from points
+     * and normal vectors, as the Patate OrientedSphereFit used by
+     * SphereFittingEstimator, without any dependency.
+     *
+     * The weighted moments of the neighborhood (sums of positions,
+     * normals, position-normal and position-position dot products) are
+     * accumulated as surfels are pushed, with the smooth weight
+     * @f$ (1 - (d/r)^2)^2 @f$ of a point at distance @f$ d < r @f$ of the
+     * first point. The algebraic sphere
+     * @f$ u_c + u_l \cdot x + u_q |x|^2 @f$ is computed from them at
+     * evaluation time, and Pratt normalized. Contrary to
+     * SphereFittingEstimator, the first point also contributes to the
+     * moments.
+     *
+     * Model of concepts::CLocalEstimatorFromSurfelFunctor.
+     *
+     * @tparam TSurfel type of surfels
+     * @tparam TEmbedder type of functors which embed surfel to @f$
+     * \mathbb{R}^3@f$.
+     * @tparam TNormalVectorEstimatorCache the type of normal vector
+     * cache to consider (see EstimatorCache class).
+     **/
+    template <typename TSurfel,
+              typename TEmbedder,
+              typename TNormalVectorEstimatorCache>
+    class OrientedSphereFittingEstimator
+    {
+    public:
+
+      typedef TSurfel Surfel;
+      typedef TEmbedder SCellEmbedder;
+      typedef typename SCellEmbedder::RealPoint RealPoint;
+
+      typedef TNormalVectorEstimatorCache NormalVectorEstimatorCache;
+
+      ///Quantity type: a 3-sphere (model of CQuantity)
+      struct Quantity
+      {
+        RealPoint center;
+        double radius;
+        double tau;
+        double kappa;
+        RealPoint eta;
+
+        Quantity(){}
+        Quantity(RealPoint p, double rad, double _tau,
+                 double _kappa, RealPoint _eta): center(p), radius(rad),
+                                                 tau(_tau), kappa(_kappa),
+                                                 eta(_eta) {}
+        ~Quantity(){}
+        bool operator==(const Quantity& aq) const {return (center==aq.center) && (radius==aq.radius);}
+        bool operator<(const Quantity& aq) const {return (center<aq.center) && (radius<aq.radius);}
+        bool operator!=(const Quantity& aq) const {return !(*this == aq);}
+      };
+
+      /**
+       * Constructor.
+       *
+       * @param [in] anEmbedder embedder to map surfel to R^n.
+       * @param [in] h gridstep.
+       * @param [in] radius  radius of the convolution kernel (in
+       * @f$\mathbb{Z}^n@f$ space).
+       * @param [in] anEstimator normal vector estimator on the surface.
+       */
+      OrientedSphereFittingEstimator(ConstAlias<SCellEmbedder> anEmbedder,
+                                     const double h,
+                                     const double radius,
+                                     ConstAlias<NormalVectorEstimatorCache> anEstimator):
+        myEmbedder(&anEmbedder), myH(h), myRadius(radius),
+        myNormalEstimatorCache(&anEstimator)
+      {
+        reset();
+      }
+
+      /**
+       * Add the geometrical embedding of a surfel and its normal vector
+       * to the moments.
+       *
+       * @param [in] aSurf a surfel to add
+       * @param [in] aDistance of aSurf to the neighborhood boundary
+       */
+      void pushSurfel(const Surfel & aSurf,
+                      const double aDistance)
+      {
+        BOOST_VERIFY(aDistance==aDistance);
+
+        const RealPoint p = myEmbedder->operator()(aSurf) * myH;
+        if (myNbPoints == 0)
+          myOrigin = p;
+        myNbPoints++;
+
+        const RealPoint q = p - myOrigin;
+        const double distance2 = q.dot(q) / (myRadius*myRadius);
+        if (distance2 >= 1.)
+          return;
+        const double w = (1. - distance2) * (1. - distance2);
+
+        const RealPoint normal = myNormalEstimatorCache->eval(aSurf);
+        mySumW += w;
+        mySumP += w * q;
+        mySumN += w * normal;
+        mySumDotPN += w * normal.dot(q);
+        mySumDotPP += w * q.dot(q);
+      }
+
+      /**
+       * Evaluate the sphere fitting.
+       *
+       * @return the fitted sphere, whose radius is infinite when the
+       * neighborhood is planar.
+       */
+      Quantity eval()
+      {
+        if (mySumW == 0 || myNbPoints < 3)
+          return Quantity(myOrigin, 0., 0., 0., RealPoint());
+
+        const double invSumW = 1. / mySumW;
+        const double num = mySumDotPN - invSumW * mySumP.dot(mySumN);
+        const double den = mySumDotPP - invSumW * mySumP.dot(mySumP);
+
+        double uq = 0.;
+        RealPoint ul;
+        double uc;
+        if (std::abs(den) < std::numeric_limits<double>::epsilon() * mySumDotPP)
+          {
+            // plane
+            ul = mySumN / mySumN.norm();
+            uc = -invSumW * ul.dot(mySumP);
+          }
+        else
+          {
+            uq = .5 * num / den;
+            ul = invSumW * (mySumN - (2. * uq) * mySumP);
+            uc = -invSumW * (ul.dot(mySumP) + mySumDotPP * uq);
+          }
+
+        // Pratt normalization
+        const double pratt = std::sqrt(ul.dot(ul) - 4. * uc * uq);
+        uc /= pratt;
+        ul /= pratt;
+        uq /= pratt;
+
+        Quantity res;
+        res.tau = uc;
+        res.eta = ul;
+        res.kappa = 2. * uq;
+        if (uq == 0.)
+          {
+            res.center = myOrigin;
+            res.radius = std::numeric_limits<double>::infinity();
+          }
+        else
+          {
+            res.center = myOrigin - (.5 / uq) * ul;
+            res.radius = std::sqrt(ul.dot(ul) / (4. * uq * uq) - uc / uq);
+          }
+        return res;
+      }
+
+      /**
+       * Reset the moments.
+       *
+       */
+      void reset()
+      {
+        myNbPoints = 0;
+        mySumW = mySumDotPN = mySumDotPP = 0.;
+        mySumP = mySumN = RealPoint();
+      }
+
+
+    private:
+
+      ///Alias of the geometrical embedder
+      const SCellEmbedder * myEmbedder;
+
+      ///Grid step
+      double myH;
+
+      ///Radius of the weight kernel
+      double myRadius;
+
+      ///NormalVectorCache
+      const NormalVectorEstimatorCache *myNormalEstimatorCache;
+
+      ///Number of pushed points
+      unsigned int myNbPoints;
+
+      ///First point, origin of the moments
+      RealPoint myOrigin;
+
+      ///Weighted moments of the points and normal vectors
+      double mySumW;
+      RealPoint mySumP;
+      RealPoint mySumN;
+      double mySumDotPN;
+      double mySumDotPP;
+
+    }; // end of class OrientedSphereFittingEstimator
+  }
+} // namespace DGtal
+
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined OrientedSphereFittingEstimator_h
+
+#undef OrientedSphereFittingEstimator_RECURSES
+#endif // else defined(OrientedSphereFittingEstimator_RECURSES)
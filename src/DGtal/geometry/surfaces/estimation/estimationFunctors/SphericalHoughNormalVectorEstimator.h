@@ -155,6 +155,7 @@ namespace DGtal
         std::uniform_int_distribution<int> distribution(0, myPoints.size() - 1 );
         double aspect;
         
+        myNormals.clear();
         for(auto t = 0u; t < myNbTrials ; ++t)
         {
           unsigned int i,j,k;
@@ -167,15 +168,20 @@ namespace DGtal
           
           RealPoint vector = getNormal(i,j,k,aspect);
           if ((vector.norm() > 0.00001) && (aspect > myAspectRatio))
+            myNormals.push_back( vector );
+        }
+        //For each admissible triangle, we push both normal vectors
+        //in each accumulator, binned in one batch.
+        for(auto acc = 0u; acc < myNbAccumulators; ++acc)
+        {
+          myDirections.clear();
+          for(auto it = myNormals.begin(); it != myNormals.end(); ++it)
           {
-            //we have an admissible triangle, we push both normal vectors
-            for(auto acc = 0u; acc < myNbAccumulators; ++acc)
-            {
-              RealPoint shifted = myRotations[acc]*vector;
-              myAccumulators[acc].addDirection( shifted );
-              myAccumulators[acc].addDirection( -shifted );
-            }
+            RealPoint shifted = myRotations[acc]*(*it);
+            myDirections.push_back( shifted );
+            myDirections.push_back( -shifted );
           }
+          myAccumulators[acc].addDirections( myDirections.begin(), myDirections.end() );
         }
         //We return the max bin orientation summing up all accumulators vote
         typename SphericalAccumulator<RealPoint>::Size posPhi,posTheta;
@@ -306,6 +312,12 @@ namespace DGtal
       
       ///vector of embedded surfels
       std::vector<RealPoint> myPoints;
+
+      ///Normal vectors of the admissible triangles (buffer used in eval)
+      std::vector<RealPoint> myNormals;
+
+      ///Directions to add to an accumulator (buffer used in eval)
+      std::vector<RealPoint> myDirections;
       
       ///Spherical Accumulators
       std::vector< SphericalAccumulator<RealPoint> > myAccumulators;
@@ -46,6 +46,7 @@
 #include <list>
 #include <vector>
 #include "boost/utility.hpp"
+#include "boost/next_prior.hpp"
 
 #include "DGtal/base/Common.h"
 #include "DGtal/base/IteratorCirculatorTraits.h"
@@ -57,6 +58,7 @@
 #include "DGtal/geometry/tools/determinant/COrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
 #include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
 #include "DGtal/geometry/tools/determinant/Simple2x2DetComputer.h"
 //////////////////////////////////////////////////////////////////////////////
 
@@ -325,13 +327,53 @@ namespace DGtal
 				   OutputIterator res, 
 				   const Predicate& aPredicate); 
 
+    /**
+     * @brief Procedure that splits a set of points by the line passing
+     * through two given points @a aFirst and @a aLast, with batched
+     * orientation tests (see InHalfPlaneBy2x2DetComputer::signs). 
+     * The points lying strictly on the side of the chain that a
+     * Graham scan from @a aFirst to @a aLast retrieves with the
+     * predicate @a aPredicate, or on the line, are copied into 
+     * @a aFirstChainPoints; the points lying strictly on the other
+     * side, or on the line, are copied into @a aSecondChainPoints. 
+     * If @a aFirst and @a aLast are the extremal points of the set
+     * along the horizontal axis, the two chains of the hull may then
+     * be computed from these two subsets only. 
+     * @see Hull2D::andrewConvexHullAlgorithm
+     * 
+     * @param aPoints any set of points
+     * @param aFirst first point of the line
+     * @param aLast last point of the line
+     * @param aPredicate any ternary predicate  
+     * @param aFirstChainPoints (returns) the candidate points of the first chain
+     * @param aSecondChainPoints (returns) the candidate points of the second chain
+     * @return the side (1 or -1) of the first chain, or 0 if the points
+     * have not been split (points all on one side of the line,
+     * predicate that does not discriminate between the two sides, or
+     * coordinates that are not bounded integers, for which
+     * AvnaimEtAl2x2DetSignComputer does not apply).
+     * 
+     * @tparam Point a model of point    
+     * @tparam Predicate a model of ternary predicate
+     */
+    template <typename Point, 
+	      typename Predicate>
+    int splitPointsByChord(const std::vector<Point>& aPoints,
+                           const Point& aFirst, const Point& aLast, 
+                           const Predicate& aPredicate,
+                           std::vector<Point>& aFirstChainPoints,
+                           std::vector<Point>& aSecondChainPoints); 
+
     /**
      * @brief Procedure that retrieves the vertices
      * of the hull of a set of 2D points given by 
      * the range [ @a itb , @a ite ). 
      * This procedure follows the well-known monotone-chain algorithm
      * due to [Andrew, 1979 : \cite Andrew1979]
-     * - first, points are sorted along the horizontal axis. 
+     * - first, the points are split by the line passing through the
+     * first and last points along the horizontal axis 
+     * (see Hull2D::splitPointsByChord). 
+     * - then, each part is sorted along the horizontal axis. 
      * - then, the lower and upper convex hull are computed by a simple
      * Graham scan. 
      * @see Hull2D::openGrahamScan
@@ -357,6 +399,165 @@ namespace DGtal
 				   OutputIterator res, 
 				   const Predicate& aPredicate ); 
 
+    /**
+     * @brief Procedure that computes the octagon of 
+     * [Akl and Toussaint, 1978 : \cite AklToussaint1978] of a set of 
+     * 2D points given by the range [ @a itb , @a ite ), ie. the polygon 
+     * whose vertices are the points of the set that are extremal along 
+     * the directions \f$ (0,-1), (1,-1), (1,0), (1,1), (0,1), (-1,1), 
+     * (-1,0), (-1,-1) \f$. 
+     * 
+     * @post The vertices are counter-clockwise oriented and two 
+     * consecutive vertices are distinct. 
+     * The octagon is included in the convex hull of the set. 
+     * 
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param aOctagon (returns) the vertices of the octagon (cleared first)
+     * 
+     * @note The extremal points are selected from the sums and 
+     * differences of their coordinates in double precision, which is
+     * exact for coordinates lower than 2^52. 
+     *
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam Point a model of point    
+     */
+    template <typename ForwardIterator, 
+	      typename Point>
+    void computeAklToussaintOctagon(const ForwardIterator& itb, 
+                                    const ForwardIterator& ite,  
+                                    std::vector<Point>& aOctagon ); 
+
+    /**
+     * @brief Procedure that copies the points of the range 
+     * [ @a itb , @a ite ) that do not lie strictly inside a given
+     * convex polygon (see Hull2D::computeAklToussaintOctagon). 
+     * The points are tested against each edge of the polygon by 
+     * blocks, with batched orientation tests (see 
+     * InHalfPlaneBy2x2DetComputer::signs). 
+     * 
+     * @note These tests use AvnaimEtAl2x2DetSignComputer, which only
+     * applies to bounded integer coordinates. For other coordinates
+     * (eg. BigInteger or double), all the points are copied.
+     * 
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param aPolygon counter-clockwise oriented convex polygon
+     * whose consecutive vertices are distinct
+     * @param res output iterator used to export the remaining points
+     * @return the output iterator after the last written point.
+     * 
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam Point a model of point    
+     * @tparam OutputIterator a model of incrementable and writable iterator   
+     */
+    template <typename ForwardIterator, 
+	      typename Point, 
+	      typename OutputIterator>
+    OutputIterator aklToussaintFilter(const ForwardIterator& itb, 
+                                      const ForwardIterator& ite,  
+                                      const std::vector<Point>& aPolygon, 
+                                      OutputIterator res ); 
+
+    /**
+     * @brief Procedure that copies the points of the range 
+     * [ @a itb , @a ite ) that do not lie strictly inside their 
+     * octagon of [Akl and Toussaint, 1978 : \cite AklToussaint1978]. 
+     * Since the octagon is included in the convex hull, the removed
+     * points lie strictly inside the convex hull: computing the 
+     * convex hull of the remaining points, whatever the predicate,
+     * gives the same result as computing the convex hull of the
+     * whole range. For uniformly distributed points, most points
+     * are removed. 
+     * 
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param res output iterator used to export the remaining points
+     * @return the output iterator after the last written point.
+     * 
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator   
+     */
+    template <typename ForwardIterator, 
+	      typename OutputIterator>
+    OutputIterator aklToussaintFilter(const ForwardIterator& itb, 
+                                      const ForwardIterator& ite,  
+                                      OutputIterator res ); 
+
+    /**
+     * @brief Procedure that retrieves the vertices
+     * of the hull of a set of 2D points given by 
+     * the range [ @a itb , @a ite ), in parallel (with OpenMP if 
+     * available). 
+     * - first, the octagon of [Akl and Toussaint, 1978 : \cite AklToussaint1978] 
+     * of the whole set is computed. 
+     * - then, the points are split into chunks. In each chunk, the points
+     * lying strictly inside the octagon are removed and the convex hull of 
+     * the remaining points is computed by Hull2D::andrewConvexHullAlgorithm. 
+     * - finally, the convex hull of the union of the hulls of the chunks 
+     * is computed by Hull2D::andrewConvexHullAlgorithm.
+     *
+     * Since the removed points lie strictly inside the convex hull, the 
+     * result is exactly the one of Hull2D::andrewConvexHullAlgorithm, 
+     * provided that the predicate returns 'false' for collinear points, 
+     * like PredicateFromOrientationFunctor2 with its default parameters. 
+     * @see Hull2D::andrewConvexHullAlgorithm
+     * 
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param res output iterator used to export the retrieved points
+     * @param aPredicate any ternary predicate  
+     * @param aNbChunks the number of chunks, or 0 to get one chunk
+     * per 65536 points (at most 256 chunks).
+     * 
+     * @tparam ForwardIterator a model of forward and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator   
+     * @tparam Predicate a model of ternary predicate
+     */
+    template <typename ForwardIterator, 
+	      typename OutputIterator, 
+	      typename Predicate >
+    void andrewConvexHullAlgorithmParallel(const ForwardIterator& itb, 
+                                           const ForwardIterator& ite,  
+                                           OutputIterator res, 
+                                           const Predicate& aPredicate,
+                                           unsigned int aNbChunks = 0 ); 
+
+    /**
+     * @brief Procedure that retrieves the vertices
+     * of the hull of a set of 2D points given by 
+     * the range [ @a itb , @a ite ), which is read only once, 
+     * in bounded memory. 
+     * The points are gathered into a buffer. When it is full, 
+     * it is replaced by the convex hull of its points, computed by 
+     * Hull2D::andrewConvexHullAlgorithm. The capacity of the buffer
+     * is doubled only if this hull fills more than half of it. The
+     * memory used is thus in O( max(@a aBufferSize, h) ), where h
+     * is the number of vertices of the convex hull. 
+     *
+     * The result is exactly the one of Hull2D::andrewConvexHullAlgorithm, 
+     * provided that the predicate returns 'false' for collinear points. 
+     * @see Hull2D::andrewConvexHullAlgorithm
+     * 
+     * @param itb begin iterator
+     * @param ite end iterator 
+     * @param res output iterator used to export the retrieved points
+     * @param aPredicate any ternary predicate  
+     * @param aBufferSize initial capacity of the buffer (at least 16)
+     * 
+     * @tparam InputIterator a model of single pass and readable iterator
+     * @tparam OutputIterator a model of incrementable and writable iterator   
+     * @tparam Predicate a model of ternary predicate
+     */
+    template <typename InputIterator, 
+	      typename OutputIterator, 
+	      typename Predicate >
+    void streamingConvexHullAlgorithm(const InputIterator& itb, 
+                                      const InputIterator& ite,  
+                                      OutputIterator res, 
+                                      const Predicate& aPredicate,
+                                      std::size_t aBufferSize = 65536 ); 
+
 
     /**
      *  @brief Procedure to compute the convex hull thickness given
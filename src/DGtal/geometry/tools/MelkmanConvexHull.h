@@ -41,6 +41,7 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/Alias.h"
 #include "DGtal/base/CountedConstPtrOrConstPtr.h"
@@ -139,6 +140,36 @@ namespace DGtal
      */
     void add ( const Point& aPoint );
 
+    /**
+     * Computes, without any update, the points of the container
+     * that would be kept by add(): add() keeps the points of 
+     * indices @a aFirst to @a aLast (see operator[]) and inserts 
+     * the new point before and after them. 
+     * Only the points that would be removed are scanned. 
+     * @param aPoint an extra point
+     * @param aFirst (returns) the index of the first kept point
+     * @param aLast (returns) the index of the last kept point
+     * @return 'false' if the kept points are not computed, ie. for 
+     * the first three points or if add() would keep only one point, 
+     * 'true' otherwise. If @a aPoint lies inside the current convex 
+     * hull, @a aFirst is 0 and @a aLast is size(). 
+     */
+    bool pointsKeptByAdding ( const Point& aPoint, std::size_t& aFirst, std::size_t& aLast ) const;
+
+    /**
+     * Computes, without any update, the vertices of the convex hull
+     * that would be obtained by adding a new point. They are given 
+     * in the order of begin() and end() after a call to add(), ie.
+     * from the first kept vertex (see pointsKeptByAdding) to the 
+     * new point, which comes last. 
+     * @param aPoint an extra point
+     * @param aVertices (returns) the resulting vertices (cleared first), 
+     * left unchanged if 'false' is returned. 
+     * @return 'false' if @a aPoint lies inside the current convex hull, 
+     * which would thus not be changed by add(), 'true' otherwise. 
+     */
+    bool hullAfterAdding ( const Point& aPoint, std::vector<Point>& aVertices ) const;
+
     /**
      * Begin iterator
      * @return either a const iterator pointing past-the-end
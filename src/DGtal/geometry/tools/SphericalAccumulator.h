@@ -42,6 +42,7 @@
 // Inclusions
 #include <iostream>
 #include <algorithm>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 #include "DGtal/kernel/NumberTraits.h"
@@ -148,6 +149,30 @@ namespace DGtal
      */
     void addDirection(const Vector &aDir);
 
+    /**
+     * Add a range of directions into the accumulator, with the same
+     * result as calling addDirection on each of them in turn. Bin
+     * coordinates of the directions are first computed in one pass,
+     * in parallel with OpenMP for large ranges, then the bins are
+     * updated sequentially.
+     *
+     * @param itb an iterator on the first direction.
+     * @param ite an iterator after the last direction.
+     * @tparam DirectionConstIterator a model of forward iterator on Vector.
+     */
+    template <typename DirectionConstIterator>
+    void addDirections(DirectionConstIterator itb,
+                       DirectionConstIterator ite);
+
+    /**
+     * Add the samples of another accumulator with the same number of
+     * bins, e.g. one filled by another thread. The bin with maximum
+     * count is updated if a bin has now a greater count.
+     *
+     * @param other an accumulator built with the same number of slices.
+     */
+    void merge(const SphericalAccumulator &other);
+
     /**
      * Given a normalized direction, this method computes the bin
      * coordinates.
@@ -227,7 +252,8 @@ namespace DGtal
     void maxCountBin(Size &posPhi, Size &posTheta) const;
 
     /**
-     * Clear the current accumulator.
+     * Clear the current accumulator. Bins are reset in place, without
+     * any reallocation.
      *
      */
     void clear();
@@ -345,6 +371,9 @@ namespace DGtal
       myBinNumber = other.myBinNumber;
       myMaxBinPhi = other.myMaxBinPhi;
       myMaxBinTheta = other.myMaxBinTheta;
+      myRingSizes = other.myRingSizes;
+      myRingSteps = other.myRingSteps;
+      myPhiThresholds = other.myPhiThresholds;
     }
 
     /**
@@ -355,7 +384,7 @@ namespace DGtal
      */
     SphericalAccumulator & operator= ( const SphericalAccumulator & other )
     {
-      if (this!=other)
+      if (this != &other)
       {
         myNphi = other.myNphi;
         myNtheta = other.myNtheta;
@@ -365,6 +394,9 @@ namespace DGtal
         myBinNumber = other.myBinNumber;
         myMaxBinPhi = other.myMaxBinPhi;
         myMaxBinTheta = other.myMaxBinTheta; 
+        myRingSizes = other.myRingSizes;
+        myRingSteps = other.myRingSteps;
+        myPhiThresholds = other.myPhiThresholds;
       }
       return *this;
     }
@@ -398,6 +430,51 @@ namespace DGtal
     ///Theta coordinate of the max bin
     Size myMaxBinTheta;
 
+    ///Number of bins of each slice along the theta axis (as computed
+    ///in binCoordinates, 1 for the poles)
+    std::vector<double> myRingSizes;
+
+    ///Angular size of the bins of each slice along the theta axis
+    std::vector<double> myRingSteps;
+
+    ///Cosines of the boundaries between consecutive slices (decreasing)
+    std::vector<double> myPhiThresholds;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Computes the number and the size of the bins of each slice.
+     */
+    void computeRings();
+
+    /**
+     * Computes the bin coordinates of a direction with acos and
+     * atan2, used by binCoordinates for directions close to a bin
+     * boundary.
+     *
+     * @param aDir a direction.
+     * @param posPhi position according to the first direction.
+     * @param posTheta position according to the second direction.
+     */
+    void exactBinCoordinates(const Vector &aDir,
+                             Size &posPhi,
+                             Size &posTheta) const;
+
+    /**
+     * @param aDir a direction.
+     * @return the index in the accumulator containers of the bin of @a aDir.
+     */
+    Size binIndex(const Vector &aDir) const;
+
+    /**
+     * Adds a direction to a bin and updates the bin with maximum count.
+     *
+     * @param index the index of the bin in the accumulator containers.
+     * @param aDir the direction.
+     */
+    void accumulate(const Size index, const Vector &aDir);
+
 
     // ------------------------- Hidden services ------------------------------
   protected:
@@ -85,6 +85,22 @@ namespace DGtal
    * the chosen determinant computer can safely deal with integers coded with b+1 bits 
    * if the points coordinates are coded with b bits. 
    * 
+   * Many points may be tested against the same line in one call with
+   * the method signs(). Points are processed by blocks of
+   * BatchSize points: a floating-point filter, written as simple
+   * loops on arrays that the compiler vectorizes, certifies the sign
+   * of most determinants, and the determinant computer is only called
+   * for the points that are too close to the line for the filter to
+   * conclude (and for coordinates that are not exactly representable
+   * by a double).
+   @code
+   std::vector<Point> points; 
+   ...
+   std::vector<int> s( points.size() ); 
+   orientationTest.signs( points.begin(), points.end(), s.begin() ); 
+   //s[i] is 1, 0 or -1 according to the orientation of (0,0) (5,2) points[i]
+   @endcode
+   *
    * @see Simple2x2DetComputer SimpleIncremental2x2DetComputer 
    * AvnaimEtAl2x2DetComputer FilteredDetComputer
    */
@@ -131,6 +147,11 @@ namespace DGtal
      */
     typedef typename TDetComputer::ResultInteger Value; 
 
+    /**
+     * Number of points processed together by signs().
+     */
+    static const unsigned int BatchSize = 16;
+
     // ----------------------- Standard services ------------------------------
   public:
 
@@ -163,6 +184,28 @@ namespace DGtal
      */
     Value operator()(const Point& aR) const;
 
+    /**
+     * Batched operator: computes the orientation of the points
+     * @a aP @a aQ given at initialization and of each point of the
+     * range [ @a itb , @a ite ).
+     * The result is exact, whatever the determinant computer is, as
+     * soon as operator() is exact.
+     * @warning InHalfPlaneBy2x2DetComputer::init() should be called before
+     * @param itb begin iterator on the points to test
+     * @param ite end iterator on the points to test
+     * @param out output iterator on values convertible from int, 
+     * receiving for each point 1, 0 or -1 if the three points are
+     * respectively counter-clockwise oriented, collinear, or
+     * clockwise oriented.
+     * @return the output iterator after the last written value.
+     *
+     * @tparam ConstIterator a model of forward and readable iterator on points
+     * @tparam OutputIterator a model of incrementable and writable iterator
+     */
+    template <typename ConstIterator, typename OutputIterator>
+    OutputIterator signs(const ConstIterator& itb, const ConstIterator& ite,
+                         OutputIterator out) const;
+
     /**
      * Writes/Displays the object on an output stream.
      * @param out the output stream where the object is written.
@@ -191,6 +234,17 @@ namespace DGtal
      * A 2x2 determinant computer
      */
     mutable DetComputer myDetComputer; 
+    /**
+     * Coordinates of the two points given at initialization, as
+     * doubles, used by the floating-point filter of signs()
+     */
+    double myPx, myPy, myQx, myQy; 
+    /**
+     * 'true' if the coordinates of the two points given at
+     * initialization are exactly represented by doubles, ie. if
+     * the floating-point filter of signs() may be used
+     */
+    bool myIsFilterable; 
 
   }; // end of class InHalfPlaneBy2x2DetComputer
 
@@ -0,0 +1,394 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfaceCSRGraphBoostGraphInterface.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalSurfaceCSRGraphBoostGraphInterface.cpp
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSurfaceCSRGraphBoostGraphInterface_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfaceCSRGraphBoostGraphInterface.h
+#else // defined(DigitalSurfaceCSRGraphBoostGraphInterface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfaceCSRGraphBoostGraphInterface_RECURSES
+
+#if !defined DigitalSurfaceCSRGraphBoostGraphInterface_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfaceCSRGraphBoostGraphInterface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <limits>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/graph/graph_traits.hpp>
+#include <boost/graph/properties.hpp>
+#include <boost/property_map/property_map.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/topology/DigitalSurfaceCSRGraph.h"
+//////////////////////////////////////////////////////////////////////////////
+
+
+// The interface to the Boost Graph should be defined in namespace boost.
+namespace boost
+{
+
+  /**
+     Defines the boost graph traits for the CSR graph of a digital
+     surface (see DGtal::DigitalSurfaceCSRGraph). With these
+     definitions, a DGtal::DigitalSurfaceCSRGraph is a model of
+     VertexListGraphConcept, AdjacencyGraphConcept,
+     IncidenceGraphConcept, EdgeListGraphConcept. Contrary to
+     DGtal::DigitalSurface, vertices are indices and the adjacent
+     vertices are stored in the graph: adjacency and edge iterators
+     point directly into its neighbors array, without any allocation,
+     and the vertex_index property map is the identity, so that vertex
+     properties may be stored in vectors (e.g. with
+     boost::make_iterator_property_map).
+
+     @tparam TDigitalSurfaceContainer the container chosen for the
+     digital surface.
+     @tparam TIndex the type of the vertices.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  struct graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >
+  {
+    /// the adapted DGtal graph class.
+    typedef DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > Adapted;
+    /// the graph is undirected.
+    typedef undirected_tag directed_category;
+    /// the graph satisfies AdjacencyListGraph and VertexListGraph concepts.
+    typedef DigitalSurface_graph_traversal_category traversal_category;
+    /// the graph does not allow parallel edges.
+    typedef disallow_parallel_edge_tag edge_parallel_category;
+
+    /// the type for counting vertices
+    typedef typename Adapted::Size vertices_size_type;
+    /// the type for counting edges
+    typedef typename Adapted::Offset edges_size_type;
+    /// the type for counting out or in edges
+    typedef typename Adapted::Size degree_size_type;
+
+    /// Vertex type
+    typedef typename Adapted::Vertex Vertex;
+    /// Vertex type
+    typedef Vertex vertex_descriptor;
+    /// (oriented) edge type
+    typedef typename Adapted::Arc Arc;
+    /// (oriented) edge type
+    typedef Arc edge_descriptor;
+    /// Iterator for visiting vertices.
+    typedef typename Adapted::ConstIterator vertex_iterator;
+    /// Iterator for visiting adjacent vertices.
+    typedef typename Adapted::NeighborConstIterator adjacency_iterator;
+
+    /**
+       @return the invalid vertex.
+    */
+    static
+    inline
+    vertex_descriptor null_vertex()
+    {
+      return (std::numeric_limits<vertex_descriptor>::max)();
+    }
+
+    /**
+       Iterator for visiting the out edges of a vertex, built on the
+       iterator on its adjacent vertices.
+    */
+    class out_edge_iterator
+      : public iterator_facade< out_edge_iterator,
+                                Arc,
+                                random_access_traversal_tag,
+                                Arc >
+    {
+    public:
+      inline
+      out_edge_iterator()
+        : myBase( 0 ), myIterator( 0 ) {}
+      inline
+      out_edge_iterator( Vertex base, adjacency_iterator it )
+        : myBase( base ), myIterator( it ) {}
+    private:
+      inline
+      Arc dereference() const
+      {
+        return Arc( myBase, *myIterator );
+      }
+      inline
+      bool equal( const out_edge_iterator & other ) const
+      {
+        return myIterator == other.myIterator;
+      }
+      inline
+      void increment() { ++myIterator; }
+      inline
+      void decrement() { --myIterator; }
+      inline
+      void advance( std::ptrdiff_t n ) { myIterator += n; }
+      inline
+      std::ptrdiff_t distance_to( const out_edge_iterator & other ) const
+      {
+        return other.myIterator - myIterator;
+      }
+
+      /// The base vertex of the out edges.
+      Vertex myBase;
+      /// The iterator pointing in the neighbors of the base vertex.
+      adjacency_iterator myIterator;
+
+      friend class iterator_core_access;
+    }; // end class out_edge_iterator
+
+    /**
+       Iterator for visiting all the (oriented) edges of the graph, in
+       the order of their base vertex.
+    */
+    class edge_iterator
+      : public iterator_facade< edge_iterator,
+                                Arc,
+                                forward_traversal_tag,
+                                Arc >
+    {
+    public:
+      inline
+      edge_iterator()
+        : myGraph( 0 ), myBase( 0 ), myPosition( 0 ) {}
+      inline
+      edge_iterator( const Adapted & graph, edges_size_type position )
+        : myGraph( &graph ), myBase( 0 ), myPosition( position )
+      {
+        skipEmptyVertices();
+      }
+    private:
+      inline
+      Arc dereference() const
+      {
+        return Arc( myBase, myGraph->neighbors()[ myPosition ] );
+      }
+      inline
+      bool equal( const edge_iterator & other ) const
+      {
+        return myPosition == other.myPosition;
+      }
+      inline
+      void increment()
+      {
+        ++myPosition;
+        skipEmptyVertices();
+      }
+      /// Moves myBase to the vertex of the edge at myPosition.
+      inline
+      void skipEmptyVertices()
+      {
+        const vertices_size_type n = myGraph->size();
+        while ( myBase < n && myGraph->offsets()[ myBase + 1 ] <= myPosition )
+          ++myBase;
+      }
+
+      /// The visited graph.
+      const Adapted* myGraph;
+      /// The base vertex of the current edge.
+      Vertex myBase;
+      /// The position of the current edge in the neighbors array.
+      edges_size_type myPosition;
+
+      friend class iterator_core_access;
+    }; // end class edge_iterator
+  };
+
+  /**
+     The vertex_index property map of the CSR graph of a digital
+     surface is the identity.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  struct property_map< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex >, vertex_index_t >
+  {
+    typedef typed_identity_property_map< TIndex > type;
+    typedef typed_identity_property_map< TIndex > const_type;
+  };
+
+  /**
+     @param g a CSR graph of a digital surface.
+     @return the vertex_index property map of \a g.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  typed_identity_property_map< TIndex >
+  get( vertex_index_t,
+       const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & /* g */ )
+  {
+    return typed_identity_property_map< TIndex >();
+  }
+
+  /**
+     @param edge an edge (s,t) on \a g.
+     @param g a CSR graph of a digital surface.
+     @return the vertex s.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::vertex_descriptor
+  source( typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::edge_descriptor edge,
+          const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & /* g */ )
+  {
+    return edge.base;
+  }
+
+  /**
+     @param edge an edge (s,t) on \a g.
+     @param g a CSR graph of a digital surface.
+     @return the vertex t.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::vertex_descriptor
+  target( typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::edge_descriptor edge,
+          const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & g )
+  {
+    return g.head( edge );
+  }
+
+  /**
+     @param g a CSR graph of a digital surface.
+     @return a pair< vertex_iterator, vertex_iterator > that
+     represents a range to visit all the vertices of \a g.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  std::pair<
+    typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::vertex_iterator,
+    typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::vertex_iterator
+    >
+  vertices( const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & g )
+  {
+    return std::make_pair( g.begin(), g.end() );
+  }
+
+  /**
+     @param g a CSR graph of a digital surface.
+     @return the number of vertices of \a g.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::vertices_size_type
+  num_vertices( const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & g )
+  {
+    return g.size();
+  }
+
+  /**
+     @param u a vertex belonging to \a g.
+     @param g a CSR graph of a digital surface.
+     @return a pair< adjacency_iterator, adjacency_iterator > that
+     represents a range to visit the adjacent vertices of vertex \a
+     u.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  std::pair<
+    typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::adjacency_iterator,
+    typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::adjacency_iterator
+    >
+  adjacent_vertices( typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::vertex_descriptor u,
+                     const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & g )
+  {
+    return std::make_pair( g.neighborsBegin( u ), g.neighborsEnd( u ) );
+  }
+
+  /**
+     @param u a vertex belonging to \a g.
+     @param g a CSR graph of a digital surface.
+     @return a pair< out_edge_iterator, out_edge_iterator > that
+     represents a range to visit the out edges of vertex \a u. Each
+     out edge is a tuple (u,t) of vertices, where t != u.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  std::pair<
+    typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::out_edge_iterator,
+    typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::out_edge_iterator
+    >
+  out_edges( typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::vertex_descriptor u,
+             const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & g )
+  {
+    typedef typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >
+      ::out_edge_iterator Iterator;
+    return std::make_pair( Iterator( u, g.neighborsBegin( u ) ),
+                           Iterator( u, g.neighborsEnd( u ) ) );
+  }
+
+  /**
+     @param u a vertex belonging to \a g.
+     @param g a CSR graph of a digital surface.
+     @return the number of out edges at vertex \a u.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::degree_size_type
+  out_degree( typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::vertex_descriptor u,
+              const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & g )
+  {
+    return g.degree( u );
+  }
+
+  /**
+     @param g a CSR graph of a digital surface.
+     @return a pair< edge_iterator, edge_iterator > that represents a
+     range to visit all the (oriented) edges of \a g.
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  std::pair<
+    typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::edge_iterator,
+    typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::edge_iterator
+    >
+  edges( const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & g )
+  {
+    typedef typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >
+      ::edge_iterator Iterator;
+    return std::make_pair( Iterator( g, 0 ), Iterator( g, g.nbArcs() ) );
+  }
+
+  /**
+     @param g a CSR graph of a digital surface.
+     @return the number of (oriented) edges of \a g (constant time).
+  */
+  template < class TDigitalSurfaceContainer, class TIndex >
+  inline
+  typename graph_traits< DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > >::edges_size_type
+  num_edges( const DGtal::DigitalSurfaceCSRGraph< TDigitalSurfaceContainer, TIndex > & g )
+  {
+    return g.nbArcs();
+  }
+
+} // namespace Boost
+
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfaceCSRGraphBoostGraphInterface_h
+
+#undef DigitalSurfaceCSRGraphBoostGraphInterface_RECURSES
+#endif // else defined(DigitalSurfaceCSRGraphBoostGraphInterface_RECURSES)
@@ -63,10 +63,12 @@ namespace DGtal
    *
    * @tparam TArrayIterator Type of a random-access iterator over the datas (can be a T* pointer).
    * @tparam TDomain  Type of the domain (must be an HyperRectDomain).
+   * @tparam TStorageOrder  Storage order of the datas (see Linearizer).
    */
   template <
     typename TArrayIterator,
-    typename TDomain
+    typename TDomain,
+    typename TStorageOrder = ColMajorStorage
   >
   class ArrayImageAdapter;
   /// @endcond
@@ -99,11 +101,16 @@ namespace DGtal
    *
    * @remark The given random-access iterator can be either mutable or constant.
    *
-   * @warning The array must be column-major ordered (but row-major order could be later accepted via template parameter, if needed ?)
+   * @remark The array is column-major ordered by default. Another storage order
+   * (RowMajorStorage, BlockedStorage) can be given as template parameter: the
+   * iterators still scan the viewable domain in the column-major order.
+   * @warning With BlockedStorage, the array must span the padded storage of the
+   * full domain (see Linearizer::getStorageSize).
    * @warning The domain must be an HyperRectDomain.
    *
    * @tparam TArrayIterator Type of a random-access iterator over the datas (can be a T* pointer).
    * @tparam TSpace Type of the space associated to the HyperRectDomain (auto-deduced from TDomain template, see ArrayImageAdapter).
+   * @tparam TStorageOrder Storage order of the datas (default is ColMajorStorage).
    *
    * @see makeArrayImageAdapterFromIterator
    * @see makeArrayImageAdapterFromImage
@@ -111,10 +118,11 @@ namespace DGtal
    */
   template <
     typename TArrayIterator,
-    typename TSpace
+    typename TSpace,
+    typename TStorageOrder
   >
-  class ArrayImageAdapter< TArrayIterator, HyperRectDomain<TSpace> >
-      : public IteratorCompletion< ArrayImageAdapter< TArrayIterator, HyperRectDomain<TSpace> > >
+  class ArrayImageAdapter< TArrayIterator, HyperRectDomain<TSpace>, TStorageOrder >
+      : public IteratorCompletion< ArrayImageAdapter< TArrayIterator, HyperRectDomain<TSpace>, TStorageOrder > >
     {
 
     // Checks Random-access iterator concept on TArrayIterator
@@ -122,7 +130,7 @@ namespace DGtal
 
     public:
       // Aliases
-      using Self = ArrayImageAdapter<TArrayIterator, HyperRectDomain<TSpace> >;           ///< Self type.
+      using Self = ArrayImageAdapter<TArrayIterator, HyperRectDomain<TSpace>, TStorageOrder >; ///< Self type.
       using ArrayIterator   = TArrayIterator;                                             ///< The given random-access iterator's type.
       using Value           = typename std::iterator_traits<ArrayIterator>::value_type;   ///< The value type stored in the image.
       using Reference       = typename std::iterator_traits<ArrayIterator>::reference;    ///< Mutable reference type.
@@ -138,7 +146,7 @@ namespace DGtal
       using Integer   = typename Domain::Integer;     ///< Integer type.
       BOOST_STATIC_CONSTANT( Dimension, dimension = Domain::dimension );  ///< Rank of the space.
 
-      using Linearizer = DGtal::Linearizer<Domain, ColMajorStorage>; ///< Linearization of the points.
+      using Linearizer = DGtal::Linearizer<Domain, TStorageOrder>; ///< Linearization of the points in the array.
 
       // Iterators & Ranges
       template <class> friend class ArrayImageIterator;
@@ -382,12 +390,13 @@ namespace DGtal
    */
   template <
     typename TArrayIterator,
-    typename TDomain
+    typename TDomain,
+    typename TStorageOrder
   >
-  class IteratorCompletionTraits< ArrayImageAdapter<TArrayIterator, TDomain> >
+  class IteratorCompletionTraits< ArrayImageAdapter<TArrayIterator, TDomain, TStorageOrder> >
     {
     public:
-      using Self = ArrayImageAdapter<TArrayIterator, TDomain>;  ///< Self type.
+      using Self = ArrayImageAdapter<TArrayIterator, TDomain, TStorageOrder>;  ///< Self type.
       using Iterator = ArrayImageIterator<Self>; ///< Mutable iterator.
       using ConstIterator = ArrayImageIterator<const Self>; ///< Constant iterator.
 
@@ -438,10 +447,11 @@ namespace DGtal
    */
   template <
     typename TArrayIterator,
-    typename TDomain
+    typename TDomain,
+    typename TStorageOrder
   >
   std::ostream&
-  operator<< ( std::ostream & out, const ArrayImageAdapter<TArrayIterator, TDomain> & object )
+  operator<< ( std::ostream & out, const ArrayImageAdapter<TArrayIterator, TDomain, TStorageOrder> & object )
     {
       object.selfDisplay( out );
       return out;
@@ -450,6 +460,28 @@ namespace DGtal
 
   // ------------------ ArrayImageAdapter construction helpers ----------------
 
+  /// @cond
+  namespace detail
+  {
+    /** Storage order of the values scanned by the begin() iterator of an image.
+     *
+     * It is the column-major order unless the image defines a StorageOrder type
+     * (like ImageContainerBySTLVector).
+     */
+    template < typename TImage, typename = void >
+    struct ArrayImageStorageOrder
+      {
+        using Type = ColMajorStorage;
+      };
+
+    template < typename TImage >
+    struct ArrayImageStorageOrder< TImage, typename std::conditional< true, void, typename TImage::StorageOrder >::type >
+      {
+        using Type = typename TImage::StorageOrder;
+      };
+  } // namespace detail
+  /// @endcond
+
   /** Returns an ArrayImageAdapter from an iterator, a full domain and a viewable domain.
    *
    * @param anArrayIterator   A random-access iterator on the datas.
@@ -496,7 +528,7 @@ namespace DGtal
   >
   // We use decltype on begin() iterator because it returns the constant iterator
   //  if the image is constant while ::Iterator typedef returns the mutable iterator.
-  ArrayImageAdapter< decltype( ((TImage*)nullptr)->begin() ), TDomain >
+  ArrayImageAdapter< decltype( ((TImage*)nullptr)->begin() ), TDomain, typename detail::ArrayImageStorageOrder< typename std::remove_const<TImage>::type >::Type >
   makeArrayImageAdapterFromImage( TImage & anImage, TDomain const& aViewDomain )
     {
       // Remove constness because CConstImage requires assignability.
@@ -517,7 +549,7 @@ namespace DGtal
   >
   // We use decltype on begin() iterator because it returns the constant iterator
   //  if the image is constant while ::Iterator typedef returns the mutable iterator.
-  ArrayImageAdapter< decltype( ((TImage*)nullptr)->begin() ), TDomain >
+  ArrayImageAdapter< decltype( ((TImage*)nullptr)->begin() ), TDomain, typename detail::ArrayImageStorageOrder< typename std::remove_const<TImage>::type >::Type >
   makeArrayImageAdapterFromImage( TImage & anImage )
     {
       // Remove constness because CConstImage requires assignability.
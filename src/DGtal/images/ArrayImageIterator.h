@@ -88,7 +88,8 @@ namespace DGtal
       using IterableClass = TIterableClass;             ///< Iterable class type.
       using Domain = typename IterableClass::Domain;    ///< Domain type. \todo or in template with default value ?
       using Point = typename Domain::Point;             ///< Point type.
-      using Linearizer = DGtal::Linearizer<Domain, ColMajorStorage>; ///< Linearizer type. \todo hard-coded, but must be later set as template.
+      using Linearizer = DGtal::Linearizer<Domain, ColMajorStorage>; ///< Linearizer of the viewable domain (scanning order).
+      using FullLinearizer = typename std::remove_const<IterableClass>::type::Linearizer; ///< Linearizer of the iterable class storage.
       using Reference = decltype( ((IterableClass*)nullptr)->dereference( Point::diagonal(0), typename Point::Coordinate(0) ) ); ///< Return type when dereferencing this iterator.
 
       /// Default constructor.
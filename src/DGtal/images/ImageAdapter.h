@@ -49,6 +49,7 @@
 
 #include "DGtal/images/DefaultConstImageRange.h"
 #include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/ImageSpanEvaluation.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -239,6 +240,32 @@ public:
       else
 	return defaultValue;
     }
+
+    /**
+     * Writes the values of the span of @a aLength points starting at
+     * @a aStart along the axis @a aDim (see ImageSpanEvaluation.h).
+     *
+     * When the domain functor is functors::Identity and the span lies
+     * in the underlying image domain, the values are read with the
+     * span evaluation of the underlying image and transformed with the
+     * span form of the value functor, if any. Otherwise, the values
+     * are computed point by point as in operator().
+     *
+     * @pre the span must be in the domain.
+     *
+     * @param aStart the first point of the span.
+     * @param aDim the axis of the span.
+     * @param aLength the number of points of the span.
+     * @param out output iterator on values.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator evalSpan(const Point & aStart, Dimension aDim, std::size_t aLength,
+                             TOutputIterator out) const
+    {
+      return detail::adapterEvalSpan( *myImagePtr, *myFD, *myFV, defaultValue,
+                                      aStart, aDim, aLength, out );
+    }
     
 
 
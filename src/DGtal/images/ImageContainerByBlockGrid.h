@@ -0,0 +1,446 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageContainerByBlockGrid.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageContainerByBlockGrid.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageContainerByBlockGrid_RECURSES)
+#error Recursive header files inclusion detected in ImageContainerByBlockGrid.h
+#else // defined(ImageContainerByBlockGrid_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageContainerByBlockGrid_RECURSES
+
+#if !defined ImageContainerByBlockGrid_h
+/** Prevents repeated inclusion of headers. */
+#define ImageContainerByBlockGrid_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <boost/iterator/iterator_facade.hpp>
+
+#include "DGtal/base/Common.h"
+#include "DGtal/base/CowPtr.h"
+#include "DGtal/base/Clone.h"
+#include "DGtal/base/CLabel.h"
+#include "DGtal/kernel/domains/CDomain.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
+#include "DGtal/images/SetValueIterator.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // class ImageContainerByBlockGrid
+  /**
+   * Description of class 'ImageContainerByBlockGrid' <p>
+   * Aim: Model of CImage implementing a sparse image as a two-level
+   * grid of dense blocks (leaves), in the spirit of VDB-like
+   * structures.
+   *
+   * The domain is partitioned into blocks of \f$ 2^L \f$ points
+   * along each axis (\f$ L \f$ being @a TLog2BlockSize, so that the
+   * default blocks are \f$ 8^d \f$). Only the blocks that have been
+   * written to are allocated. Their values are stored contiguously
+   * in a single STL vector (one slice of @ref blockVolume values per
+   * block), and the root level is a compact open-addressing hash
+   * table mapping block coordinates to block indices. No node of the
+   * structure is allocated individually and no pointer is stored.
+   *
+   * Once constructed, the image is valid, i.e. every point of the
+   * image domain has a value, which can be read and overwritten.
+   * Points lying in unallocated blocks have the default value given
+   * at construction. Writing a point in such a block allocates it and
+   * fills it with the default value.
+   *
+   * Each access (`operator()` or `setValue`) is in \f$ O(1) \f$
+   * expected time. The last accessed block is cached so that
+   * coherent accesses (scans along the domain, neighbourhood
+   * queries) skip the hash table lookup. Since this cache is updated
+   * by `operator()`, concurrent reads of the same instance from
+   * several threads are not allowed.
+   *
+   * Besides the CImage services (whose ranges adapt the domain
+   * iterators as in ImageContainerBySTLMap), allocated blocks can be
+   * traversed efficiently with the leaf iterators (leafBegin(),
+   * leafEnd()) which give access to the dense array of values of each
+   * block.
+   *
+   * @tparam TDomain a model of HyperRectDomain.
+   * @tparam TValue a model of CLabel.
+   * @tparam TLog2BlockSize the base-2 logarithm of the block width
+   * (default 3, i.e. blocks of width 8).
+   *
+   * @see testImageContainerByBlockGrid.cpp
+   */
+  template <typename TDomain, typename TValue,
+            unsigned int TLog2BlockSize = 3>
+  class ImageContainerByBlockGrid
+  {
+
+  public:
+
+    typedef ImageContainerByBlockGrid<TDomain,TValue,TLog2BlockSize> Self;
+
+    /// domain
+    BOOST_CONCEPT_ASSERT(( concepts::CDomain<TDomain> ));
+    typedef TDomain Domain;
+    typedef typename Domain::Point Point;
+    typedef typename Domain::Vector Vector;
+    typedef typename Domain::Integer Integer;
+    typedef typename Domain::Size Size;
+    typedef typename Domain::Dimension Dimension;
+    typedef Point Vertex;
+
+    /// Pointer to the (const) Domain given at construction.
+    typedef CowPtr< const Domain >  DomainPtr;
+
+    /// static constants
+    static const typename Domain::Dimension dimension = Domain::Space::dimension;
+
+    /// range of values
+    BOOST_CONCEPT_ASSERT(( concepts::CLabel<TValue> ));
+    typedef TValue Value;
+    typedef DefaultConstImageRange<Self> ConstRange;
+    typedef DefaultImageRange<Self> Range;
+
+    /// output iterator
+    typedef SetValueIterator<Self> OutputIterator;
+
+    /// Index of an allocated block.
+    typedef DGtal::uint32_t BlockIndex;
+
+    /// Base-2 logarithm of the block width.
+    static const unsigned int log2BlockSize = TLog2BlockSize;
+    /// Width of a block along each axis.
+    static const Size blockSize = Size(1) << TLog2BlockSize;
+    /// Number of values stored in a block.
+    static const Size blockVolume = Size(1) << ( TLog2BlockSize * dimension );
+
+    /**
+     * Read-only view on an allocated block: its lower corner in the
+     * domain and its dense array of @ref blockVolume values.
+     *
+     * The value associated to the point origin() + v, with \f$ 0 \le
+     * v_i < 2^L \f$, is stored at index \f$ \sum_i v_i 2^{iL} \f$
+     * (i.e. the first coordinate varies first).
+     */
+    class Leaf
+    {
+    public:
+      /**
+       * Constructor.
+       * @param anOrigin the lower corner of the block.
+       * @param aData a pointer to the first value of the block.
+       */
+      Leaf( const Point & anOrigin, const Value* aData )
+        : myOrigin( anOrigin ), myData( aData )
+      {}
+
+      /// @return the lower corner of the block.
+      const Point & origin() const { return myOrigin; }
+
+      /// @return a pointer to the first value of the block.
+      const Value* begin() const { return myData; }
+
+      /// @return a pointer past the last value of the block.
+      const Value* end() const { return myData + blockVolume; }
+
+      /**
+       * @param anIndex an index in [0, blockVolume).
+       * @return the value at this index.
+       */
+      const Value & operator[]( Size anIndex ) const { return myData[ anIndex ]; }
+
+      /**
+       * @param anIndex an index in [0, blockVolume).
+       * @return the point associated to this index (it may lie
+       * outside the image domain when the block straddles the domain
+       * upper bound).
+       */
+      Point getPoint( Size anIndex ) const
+      {
+        Point p = myOrigin;
+        for ( Dimension k = 0; k < dimension; ++k )
+          {
+            p[ k ] += static_cast<Integer>( anIndex & ( blockSize - 1 ) );
+            anIndex >>= TLog2BlockSize;
+          }
+        return p;
+      }
+
+    private:
+      /// Lower corner of the block.
+      Point myOrigin;
+      /// Values of the block.
+      const Value* myData;
+    };
+
+    /**
+     * Forward iterator over the allocated blocks of the image.
+     */
+    class LeafConstIterator
+      : public boost::iterator_facade< LeafConstIterator, Leaf,
+                                       boost::forward_traversal_tag, Leaf >
+    {
+    public:
+      /// Default constructor.
+      LeafConstIterator() : myImage( 0 ), myIndex( 0 ) {}
+
+      /**
+       * Constructor.
+       * @param anImage the image.
+       * @param anIndex the index of the pointed block.
+       */
+      LeafConstIterator( const Self & anImage, BlockIndex anIndex )
+        : myImage( &anImage ), myIndex( anIndex ) {}
+
+    private:
+      friend class boost::iterator_core_access;
+
+      void increment() { ++myIndex; }
+
+      bool equal( const LeafConstIterator & other ) const
+      { return myIndex == other.myIndex; }
+
+      Leaf dereference() const
+      { return myImage->leaf( myIndex ); }
+
+      /// Pointer to the image.
+      const Self* myImage;
+      /// Index of the current block.
+      BlockIndex myIndex;
+    };
+
+    /////////////////// Data members //////////////////
+  private:
+
+    /// Shared pointer on the image domain,
+    /// Since the domain is not mutable, not assignable,
+    /// it is shared by all the copies of *this
+    DomainPtr myDomainPtr;
+
+    /// Default value
+    Value myDefaultValue;
+
+    /// Lower bound of the domain (origin of the block grid).
+    Point myLowerBound;
+
+    /// Values of all the allocated blocks, block after block.
+    std::vector<Value> myValues;
+
+    /// Block coordinates of each allocated block.
+    std::vector<Point> myBlockKeys;
+
+    /// Open-addressing hash table: block index or invalidIndex per slot.
+    std::vector<BlockIndex> myTable;
+
+    /// Block coordinates of the last accessed block.
+    mutable Point myCachedKey;
+
+    /// Index of the last accessed block (invalidIndex if none).
+    mutable BlockIndex myCachedIndex;
+
+    /// Marker of an empty slot / missing block.
+    static const BlockIndex invalidIndex = static_cast<BlockIndex>( -1 );
+
+    /////////////////// standard services //////////////////
+
+  public:
+
+    /**
+     * Constructor from a pointer to a domain.
+     *
+     * If Domain is a heavy type, consider giving instead a smart pointer on the domain (like CountedPtr).
+     *
+     * @param aDomain the image domain.
+     * @param aValue a default value associated to the domain points
+     * that are not contained in an allocated block.
+     */
+    ImageContainerByBlockGrid( Clone<const Domain> aDomain, const Value& aValue = 0 );
+
+    /////////////////// Interface //////////////////
+
+    /**
+     * Get the value of an image at a given position given
+     * by a Point.
+     *
+     * @pre the point must be in the domain
+     *
+     * @param aPoint the point.
+     * @return the value at aPoint.
+     */
+    Value operator()( const Point & aPoint ) const;
+
+    /**
+     * Set a value on an Image at a position specified by a Point.
+     * Allocates the block containing the point if needed.
+     *
+     * @pre @c aPoint must be a point in the image domain.
+     *
+     * @param aPoint the point.
+     * @param aValue the value.
+     */
+    void setValue( const Point & aPoint, const Value & aValue );
+
+    /**
+     * @return the domain associated to the image.
+     */
+    const Domain &domain() const;
+
+    /**
+     * @return the const range providing constant
+     * iterators to iterate over the values of the image.
+     */
+    ConstRange constRange() const;
+
+    /**
+     * @return the range providing constant iterators
+     * and output iterators on the values of the image.
+     */
+    Range range();
+
+    /**
+     * @return an output iterator on the image (calling setValue).
+     */
+    OutputIterator outputIterator();
+
+    /**
+     * @return the default value of the image.
+     */
+    const Value & defaultValue() const;
+
+    /**
+     * Removes all the allocated blocks (every point gets back the
+     * default value). The memory of the containers is kept for reuse.
+     */
+    void clear();
+
+    /**
+     * @return the number of allocated blocks.
+     */
+    Size nbBlocks() const;
+
+    /**
+     * @param anIndex the index of an allocated block.
+     * @return a read-only view on this block.
+     */
+    Leaf leaf( BlockIndex anIndex ) const;
+
+    /**
+     * @return an iterator on the first allocated block.
+     */
+    LeafConstIterator leafBegin() const;
+
+    /**
+     * @return an iterator past the last allocated block.
+     */
+    LeafConstIterator leafEnd() const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * @return the validity of the Image
+     */
+    bool isValid() const;
+
+    /**
+     * @return the style name used for drawing this object.
+     */
+    std::string className() const;
+
+    /////////////////// Internals //////////////////
+  private:
+
+    /**
+     * Splits a point into its block coordinates and its index
+     * inside the block.
+     * @param aPoint a point of the domain.
+     * @param[out] aKey the block coordinates of @a aPoint.
+     * @return the index of @a aPoint inside its block.
+     */
+    Size split( const Point & aPoint, Point & aKey ) const;
+
+    /**
+     * @param aKey some block coordinates.
+     * @return the slot of the hash table where @a aKey should be
+     * stored when probing starts.
+     */
+    Size hashSlot( const Point & aKey ) const;
+
+    /**
+     * @param aKey some block coordinates.
+     * @return the index of the block with coordinates @a aKey, or
+     * invalidIndex if it is not allocated.
+     */
+    BlockIndex findBlock( const Point & aKey ) const;
+
+    /**
+     * @param aKey some block coordinates.
+     * @return the index of the block with coordinates @a aKey, which
+     * is allocated if needed.
+     */
+    BlockIndex findOrCreateBlock( const Point & aKey );
+
+    /**
+     * Reallocates the hash table with the given number of slots and
+     * reinserts all the allocated blocks.
+     * @param aCapacity the new number of slots (a power of two).
+     */
+    void rehash( Size aCapacity );
+
+  }; // end of class ImageContainerByBlockGrid
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageContainerByBlockGrid'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageContainerByBlockGrid' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDomain, typename TValue, unsigned int TLog2BlockSize>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const ImageContainerByBlockGrid<TDomain,TValue,TLog2BlockSize> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageContainerByBlockGrid.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageContainerByBlockGrid_h
+
+#undef ImageContainerByBlockGrid_RECURSES
+#endif // else defined(ImageContainerByBlockGrid_RECURSES)
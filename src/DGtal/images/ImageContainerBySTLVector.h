@@ -47,6 +47,7 @@
 // Inclusions
 #include <iostream>
 #include <vector>
+#include <type_traits>
 #include "DGtal/base/Common.h"
 #include "DGtal/base/SimpleRandomAccessConstRangeFromPoint.h"
 #include "DGtal/base/SimpleRandomAccessRangeFromPoint.h"
@@ -55,6 +56,9 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/kernel/NumberTraits.h"
+#include "DGtal/kernel/domains/Linearizer.h"
+#include "DGtal/images/DefaultConstImageRange.h"
+#include "DGtal/images/DefaultImageRange.h"
 
 //////////////////////////////////////////////////////////////////////////////
 
@@ -92,6 +96,63 @@ namespace DGtal
 
   };
 
+  namespace detail
+  {
+    /**
+     * Ranges of an ImageContainerBySTLVector, depending on its storage
+     * order.
+     *
+     * In the general case, the values are not stored in the order
+     * given by the domain iterators: the ranges adapt the domain
+     * iterators and use the image accessors (as
+     * ImageContainerBySTLMap does).
+     *
+     * @tparam TImage the image type.
+     * @tparam TConstIterator the type of the built-in constant iterators.
+     * @tparam TIterator the type of the built-in mutable iterators.
+     * @tparam TStorageOrder the storage order of the image.
+     */
+    template <typename TImage, typename TConstIterator, typename TIterator,
+              typename TStorageOrder>
+    struct ImageContainerBySTLVectorRanges
+    {
+      typedef DefaultConstImageRange<TImage> ConstRange;
+      typedef DefaultImageRange<TImage> Range;
+
+      static ConstRange constRange( const TImage & anImage )
+      {
+        return ConstRange( anImage );
+      }
+
+      static Range range( TImage & anImage )
+      {
+        return Range( anImage );
+      }
+    };
+
+    /**
+     * Ranges of an ImageContainerBySTLVector with column-major
+     * storage: the built-in iterators of the vector scan the values
+     * in the domain order.
+     */
+    template <typename TImage, typename TConstIterator, typename TIterator>
+    struct ImageContainerBySTLVectorRanges<TImage, TConstIterator, TIterator, ColMajorStorage>
+    {
+      typedef SimpleRandomAccessConstRangeFromPoint<TConstIterator,DistanceFunctorFromPoint<TImage> > ConstRange;
+      typedef SimpleRandomAccessRangeFromPoint<TConstIterator,TIterator,DistanceFunctorFromPoint<TImage> > Range;
+
+      static ConstRange constRange( const TImage & anImage )
+      {
+        return ConstRange( anImage.begin(), anImage.end(), DistanceFunctorFromPoint<TImage>( &anImage ) );
+      }
+
+      static Range range( TImage & anImage )
+      {
+        return Range( anImage.begin(), anImage.end(), DistanceFunctorFromPoint<TImage>( &anImage ) );
+      }
+    };
+  } // namespace detail
+
   /////////////////////////////////////////////////////////////////////////////
   // class ImageContainerBySTLVector
 
@@ -114,21 +175,33 @@ namespace DGtal
    * Lastly, built-in iterators and a fast span iterator to perform 1D scans
    * are also provided.
    *
+   * The storage order of the values is given by the Linearizer
+   * associated to @a TStorageOrder. With the default column-major
+   * order, the built-in iterators scan the values in the domain
+   * order and the ranges rely on them. With another order (for
+   * instance BlockedStorage, which keeps the neighbourhood of a point
+   * in the same cache lines in 3D), the built-in iterators scan the
+   * underlying storage (including the padding of the blocks) whereas
+   * the ranges follow the domain order through the image accessors.
+   *
    * @tparam TDomain a HyperRectDomain.
    * @tparam TValue at least a model of CLabel.
+   * @tparam TStorageOrder storage order of the values (ColMajorStorage,
+   * RowMajorStorage or BlockedStorage, default ColMajorStorage).
    *
    * @see testImage.cpp
    * @see testImageContainerBenchmark.cpp
    */
 
-  template <typename TDomain, typename TValue>
+  template <typename TDomain, typename TValue,
+            typename TStorageOrder = ColMajorStorage>
 
   class ImageContainerBySTLVector: public std::vector<TValue>
   {
 
   public:
 
-    typedef ImageContainerBySTLVector<TDomain, TValue> Self;
+    typedef ImageContainerBySTLVector<TDomain, TValue, TStorageOrder> Self;
 
     /// domain
     BOOST_CONCEPT_ASSERT ( ( concepts::CDomain<TDomain> ) );
@@ -150,6 +223,10 @@ namespace DGtal
     BOOST_CONCEPT_ASSERT ( ( concepts::CLabel<TValue> ) );
     typedef TValue Value;
 
+    /// storage order
+    typedef TStorageOrder StorageOrder;
+    typedef DGtal::Linearizer<Domain, StorageOrder> Linearizer;
+
     /////////////////// Data members //////////////////
 
   private:
@@ -210,6 +287,25 @@ namespace DGtal
      */
     Value operator() ( const Point & aPoint ) const;
 
+    /**
+     * Writes the values of the span of @a aLength points starting at
+     * @a aStart along the axis @a aDim (see ImageSpanEvaluation.h).
+     * For the column-major storage order, the values are read with a
+     * constant stride in the underlying vector, except for bool values
+     * whose vector is bit-packed.
+     *
+     * @pre the span must be in the domain.
+     *
+     * @param aStart the first point of the span.
+     * @param aDim the axis of the span.
+     * @param aLength the number of points of the span.
+     * @param out output iterator on values.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator evalSpan ( const Point & aStart, Dimension aDim, Size aLength,
+                               TOutputIterator out ) const;
+
     /**
      * Set a value on an Image at a position specified by a Point.
      *
@@ -269,8 +365,9 @@ namespace DGtal
     typedef typename std::vector<Value>::reverse_iterator ReverseOutputIterator;
 
     /////////////////////////// Ranges  /////////////////////
-    typedef SimpleRandomAccessConstRangeFromPoint<ConstIterator,DistanceFunctorFromPoint<Self> > ConstRange;
-    typedef SimpleRandomAccessRangeFromPoint<ConstIterator,Iterator,DistanceFunctorFromPoint<Self> > Range;
+    typedef detail::ImageContainerBySTLVectorRanges<Self, ConstIterator, Iterator, StorageOrder> RangesTraits;
+    typedef typename RangesTraits::ConstRange ConstRange;
+    typedef typename RangesTraits::Range Range;
 
     /**
      * @return the range providing begin and end
@@ -294,7 +391,7 @@ namespace DGtal
     class SpanIterator
     {
 
-      friend class ImageContainerBySTLVector<Domain, Value>;
+      friend class ImageContainerBySTLVector<Domain, Value, StorageOrder>;
 
     public:
 
@@ -314,7 +411,7 @@ namespace DGtal
        */
       SpanIterator ( const Point & p ,
                      const Dimension aDim ,
-                     ImageContainerBySTLVector<Domain, Value> *aMap ) :  myMap ( aMap ), myDimension ( aDim )
+                     ImageContainerBySTLVector<Domain, Value, StorageOrder> *aMap ) :  myPoint ( p ), myMap ( aMap ), myDimension ( aDim )
       {
         myPos = aMap->linearized ( p );
 
@@ -377,7 +474,13 @@ namespace DGtal
       inline
       void next()
       {
-        myPos += myShift;
+        if ( boost::is_same<StorageOrder, ColMajorStorage>::value )
+          myPos += myShift;
+        else
+          {
+            ++myPoint[ myDimension ];
+            myPos = myMap->linearized ( myPoint );
+          }
       }
 
       /**
@@ -387,8 +490,16 @@ namespace DGtal
       inline
       void prev()
       {
-        ASSERT ( ( long int ) myPos - myShift > 0 );
-        myPos -= myShift;
+        if ( boost::is_same<StorageOrder, ColMajorStorage>::value )
+          {
+            ASSERT ( ( long int ) myPos - myShift > 0 );
+            myPos -= myShift;
+          }
+        else
+          {
+            --myPoint[ myDimension ];
+            myPos = myMap->linearized ( myPoint );
+          }
       }
 
       /**
@@ -438,11 +549,14 @@ namespace DGtal
       }
 
     private:
-      ///Current Point in the domain
+      ///Current position in the underlying vector
       Size myPos;
 
+      ///Current Point in the domain (only used with non column-major storage)
+      Point myPoint;
+
       /// Copy of the underlying images
-      ImageContainerBySTLVector<Domain, Value> *myMap;
+      ImageContainerBySTLVector<Domain, Value, StorageOrder> *myMap;
 
       ///Dimension on which the iterator must iterate
       Dimension  myDimension;
@@ -516,6 +630,24 @@ namespace DGtal
      */
     Size linearized ( const Point &aPoint ) const;
 
+  private:
+
+    /**
+     * evalSpan for the column-major storage order of non bit-packed
+     * values: reads the values with a constant stride.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator evalSpan ( const Point & aStart, Dimension aDim, Size aLength,
+                               TOutputIterator out, std::true_type ) const;
+
+    /**
+     * evalSpan for other storage orders and for std::vector<bool>,
+     * which has no data(): reads the values point by point.
+     */
+    template <typename TOutputIterator>
+    TOutputIterator evalSpan ( const Point & aStart, Dimension aDim, Size aLength,
+                               TOutputIterator out, std::false_type ) const;
+
 
 
   };
@@ -526,10 +658,10 @@ namespace DGtal
    * @param object the object of class 'Image' to write.
    * @return the output stream after the writing.
    */
-  template <typename Domain, typename V>
+  template <typename Domain, typename V, typename S>
   inline
   std::ostream&
-  operator<< ( std::ostream & out, const ImageContainerBySTLVector<Domain, V> & object )
+  operator<< ( std::ostream & out, const ImageContainerBySTLVector<Domain, V, S> & object )
   {
     object.selfDisplay ( out );
     return out;
@@ -43,6 +43,7 @@
 #include <iostream>
 #include <algorithm>
 #include <functional>
+#include <type_traits>
 
 #include "DGtal/base/Common.h"
 #include "DGtal/base/BasicFunctors.h"
@@ -53,6 +54,7 @@
 #include "DGtal/kernel/domains/CDomain.h"
 #include "DGtal/images/CConstImage.h"
 #include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageSpanEvaluation.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/base/CQuantity.h"
 #include "DGtal/images/ImageContainerBySTLMap.h"
@@ -204,6 +206,109 @@ namespace DGtal
   template<typename I1, typename I2>
   void imageFromImage(I1& aImg1, const I2& aImg2); 
 
+  /**
+   * @name Parallel variants
+   *
+   * If DGtal has been built with OpenMP support (WITH_OPENMP flag),
+   * the following functions split their work between threads: image
+   * domains are split into slabs orthogonal to the last axis, random
+   * access ranges into chunks. Without OpenMP, they are sequential.
+   * Outputs are the same as the sequential versions (same points in
+   * the same order).
+   *
+   * The images must allow concurrent reads (resp. concurrent writes
+   * at distinct points for output images), which is the case of dense
+   * images such as ImageContainerBySTLVector, and their domain must be
+   * a HyperRectDomain. Output images of bool values are written
+   * sequentially, since they may be bit-packed (as
+   * ImageContainerBySTLVector, based on std::vector<bool>), so that
+   * distinct points share a word.
+   */
+  /// @{
+
+  /**
+   * Parallel version of setFromImage( aImg, ito, aThreshold ).
+   *
+   * @param aImg any image
+   * @param ito set inserter
+   * @param aThreshold any value (default: 0)
+   *
+   * @tparam I any model of CConstImage
+   * @tparam O any model of output iterator
+   */
+  template<typename I, typename O>
+  void setFromImageParallel(const I& aImg, 
+			    const O& ito, 
+			    const typename I::Value& aThreshold = 0); 
+
+  /**
+   * Parallel version of setFromImage( aImg, ito, low, up ).
+   *
+   * @param aImg any image
+   * @param ito set inserter
+   * @param low lower value
+   * @param up upper value
+   *
+   * @tparam I any model of CConstImage
+   * @tparam O any model of output iterator
+   */
+  template<typename I, typename O>
+  void setFromImageParallel(const I& aImg, 
+			    const O& ito, 
+			    const typename I::Value& low,
+			    const typename I::Value& up); 
+
+  /**
+   * Parallel version of setFromPointsRangeAndPredicate for random
+   * access ranges of points. The range is split into chunks, whose
+   * selected points are then copied in order through @a ito.
+   *
+   * @param itb begin iterator on points
+   * @param ite end iterator on points
+   * @param ito set inserter
+   * @param aPred point predicate, whose concurrent calls are allowed
+   *
+   * @tparam I any model of random access iterator
+   * @tparam O any model of output iterator
+   * @tparam P any model of CPointPredicate
+   */
+  template<typename I, typename O, typename P>
+  void setFromPointsRangeAndPredicateParallel(const I& itb, const I& ite, 
+					      const O& ito, const P& aPred); 
+
+  /**
+   * Parallel version of imageFromRangeAndValue for random access
+   * ranges of points. Values are written in place in @a aImg.
+   *
+   * @pre the points of the range are pairwise distinct.
+   *
+   * @param itb begin iterator on points
+   * @param ite end iterator on points
+   * @param aImg (returned) image
+   * @param aValue any value (default: 0)
+   *
+   * @tparam It any model of random access iterator
+   * @tparam Im any model of CImage
+   */
+  template<typename It, typename Im>
+  void imageFromRangeAndValueParallel(const It& itb, const It& ite, Im& aImg, 
+				      const typename Im::Value& aValue = 0); 
+
+  /**
+   * Parallel version of imageFromFunctor: the values of @a aFun are
+   * written in place in @a aImg, slab by slab.
+   *
+   * @param aImg (returned) image
+   * @param aFun a unary functor, copied for each slab
+   *
+   * @tparam I any model of CImage
+   * @tparam F any model of CPointFunctor
+   */
+  template<typename I, typename F>
+  void imageFromFunctorParallel(I& aImg, const F& aFun); 
+
+  /// @}
+
   /**
    * Insert @a aPoint in @a aSet and if (and only if)
    * @a aPoint is a newly inserted point. 
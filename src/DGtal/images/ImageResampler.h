@@ -0,0 +1,557 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageResampler.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageResampler.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageResampler_RECURSES)
+#error Recursive header files inclusion detected in ImageResampler.h
+#else // defined(ImageResampler_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageResampler_RECURSES
+
+#if !defined ImageResampler_h
+/** Prevents repeated inclusion of headers. */
+#define ImageResampler_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  namespace detail
+  {
+    /**
+     * Description of template class 'ResamplingInput' <p>
+     * \brief Aim: Read access to the input image of ImageResampler.
+     *
+     * The generic version uses the domain and `operator()` of the
+     * image. It is specialized for ImageContainerBySTLVector with
+     * column-major storage, whose values are read through a raw
+     * pointer and precomputed strides.
+     *
+     * @tparam TImage the type of the input image.
+     */
+    template <typename TImage, typename TEnable = void>
+    struct ResamplingInput
+    {
+      typedef typename TImage::Point Point;
+      typedef typename TImage::Value Value;
+
+      /// @param anImage the input image.
+      ResamplingInput( const TImage & anImage )
+        : myImage( &anImage )
+      {}
+
+      /// @return 'true' if @a aPoint is in the image domain.
+      bool isInside( const Point & aPoint ) const
+      {
+        return myImage->domain().isInside( aPoint );
+      }
+
+      /// @return 'true' if the unit cell of lower corner @a aPoint is in the image domain.
+      bool isCellInside( const Point & aPoint ) const
+      {
+        return myImage->domain().isInside( aPoint )
+          && myImage->domain().isInside( aPoint + Point::diagonal( 1 ) );
+      }
+
+      /// @return the value at @a aPoint (in the image domain).
+      Value operator()( const Point & aPoint ) const
+      {
+        return ( *myImage )( aPoint );
+      }
+
+      /**
+       * Reads the values at the corners of the unit cell of lower
+       * corner @a aPoint, corner @a c being \f$ aPoint + \sum_i
+       * ((c >> i) \& 1) e_i \f$.
+       * @pre isCellInside( aPoint )
+       */
+      template <typename TOutputIterator>
+      void cellValues( const Point & aPoint, TOutputIterator out ) const
+      {
+        for ( unsigned int c = 0; c < ( 1u << Point::dimension ); ++c, ++out )
+          {
+            Point p = aPoint;
+            for ( Dimension i = 0; i < Point::dimension; ++i )
+              p[ i ] += ( c >> i ) & 1;
+            *out = ( *myImage )( p );
+          }
+      }
+
+      /// The input image.
+      const TImage * myImage;
+    };
+
+    /**
+     * Specialization of ResamplingInput for ImageContainerBySTLVector
+     * with column-major storage.
+     */
+    template <typename TSpace, typename TValue>
+    struct ResamplingInput< ImageContainerBySTLVector< HyperRectDomain<TSpace>, TValue, ColMajorStorage >,
+                            typename std::enable_if< ! std::is_same<TValue, bool>::value >::type >
+    {
+      typedef ImageContainerBySTLVector< HyperRectDomain<TSpace>, TValue, ColMajorStorage > Image;
+      typedef typename Image::Point Point;
+      typedef typename Image::Value Value;
+      typedef std::ptrdiff_t Offset;
+
+      /// @param anImage the input image.
+      ResamplingInput( const Image & anImage )
+        : myData( static_cast< const std::vector<TValue> & >( anImage ).data() ),
+          myLower( anImage.domain().lowerBound() ),
+          myUpper( anImage.domain().upperBound() )
+      {
+        Offset stride = 1;
+        for ( Dimension i = 0; i < Point::dimension; ++i )
+          {
+            myStrides[ i ] = stride;
+            stride *= static_cast<Offset>( myUpper[ i ] - myLower[ i ] + 1 );
+          }
+        for ( unsigned int c = 0; c < ( 1u << Point::dimension ); ++c )
+          {
+            myCorners[ c ] = 0;
+            for ( Dimension i = 0; i < Point::dimension; ++i )
+              if ( ( c >> i ) & 1 ) myCorners[ c ] += myStrides[ i ];
+          }
+      }
+
+      bool isInside( const Point & aPoint ) const
+      {
+        for ( Dimension i = 0; i < Point::dimension; ++i )
+          if ( aPoint[ i ] < myLower[ i ] || aPoint[ i ] > myUpper[ i ] )
+            return false;
+        return true;
+      }
+
+      bool isCellInside( const Point & aPoint ) const
+      {
+        for ( Dimension i = 0; i < Point::dimension; ++i )
+          if ( aPoint[ i ] < myLower[ i ] || aPoint[ i ] >= myUpper[ i ] )
+            return false;
+        return true;
+      }
+
+      /// @return the offset of @a aPoint in the storage.
+      Offset offset( const Point & aPoint ) const
+      {
+        Offset o = 0;
+        for ( Dimension i = 0; i < Point::dimension; ++i )
+          o += static_cast<Offset>( aPoint[ i ] - myLower[ i ] ) * myStrides[ i ];
+        return o;
+      }
+
+      Value operator()( const Point & aPoint ) const
+      {
+        return myData[ offset( aPoint ) ];
+      }
+
+      template <typename TOutputIterator>
+      void cellValues( const Point & aPoint, TOutputIterator out ) const
+      {
+        const TValue * base = myData + offset( aPoint );
+        for ( unsigned int c = 0; c < ( 1u << Point::dimension ); ++c, ++out )
+          *out = base[ myCorners[ c ] ];
+      }
+
+      /// Pointer to the first value.
+      const TValue * myData;
+      /// Bounds of the image domain.
+      Point myLower, myUpper;
+      /// Offsets between consecutive points along each axis.
+      Offset myStrides[ Point::dimension ];
+      /// Offsets of the corners of a unit cell.
+      Offset myCorners[ 1u << Point::dimension ];
+    };
+
+    /**
+     * Description of template class 'ResamplingOutput' <p>
+     * \brief Aim: Write access to the output image of ImageResampler,
+     * row by row.
+     *
+     * The generic version uses `setValue`. It is specialized for
+     * ImageContainerBySTLVector with column-major storage, whose rows
+     * along the first axis are contiguous.
+     *
+     * @tparam TImage the type of the output image.
+     */
+    template <typename TImage, typename TEnable = void>
+    struct ResamplingOutput
+    {
+      typedef typename TImage::Point Point;
+
+      /// @param anImage the output image.
+      ResamplingOutput( TImage & anImage )
+        : myImage( &anImage )
+      {}
+
+      /**
+       * Writes the values [ @a first, @a last ) on the row starting
+       * at @a aStart along the first axis.
+       */
+      template <typename TInputIterator>
+      void setRow( Point aStart, TInputIterator first, TInputIterator last )
+      {
+        for ( ; first != last; ++first, ++aStart[ 0 ] )
+          myImage->setValue( aStart, *first );
+      }
+
+      /// The output image.
+      TImage * myImage;
+    };
+
+    /**
+     * Specialization of ResamplingOutput for ImageContainerBySTLVector
+     * with column-major storage.
+     */
+    template <typename TSpace, typename TValue>
+    struct ResamplingOutput< ImageContainerBySTLVector< HyperRectDomain<TSpace>, TValue, ColMajorStorage >,
+                             typename std::enable_if< ! std::is_same<TValue, bool>::value >::type >
+    {
+      typedef ImageContainerBySTLVector< HyperRectDomain<TSpace>, TValue, ColMajorStorage > Image;
+      typedef typename Image::Point Point;
+
+      /// @param anImage the output image.
+      ResamplingOutput( Image & anImage )
+        : myImage( &anImage ),
+          myData( static_cast< std::vector<TValue> & >( anImage ).data() )
+      {}
+
+      template <typename TInputIterator>
+      void setRow( const Point & aStart, TInputIterator first, TInputIterator last )
+      {
+        TValue * row = myData + myImage->linearized( aStart );
+        for ( ; first != last; ++first, ++row )
+          *row = *first;
+      }
+
+      /// The output image.
+      Image * myImage;
+      /// Pointer to the first value.
+      TValue * myData;
+    };
+  } // namespace detail
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class ImageResampler
+  /**
+   * Description of template class 'ImageResampler' <p>
+   * \brief Aim: Resamples an image through an affine map of its space
+   * (e.g. a rigid transformation) or extracts arbitrary oblique slices
+   * of it, with nearest-neighbor or (multi)linear interpolation.
+   *
+   * The resampler stores a backward affine map \f$ x \mapsto b + A x
+   * \f$ from the output space to the input space, given either
+   * explicitly (setAffineMap()) or sampled from any backward
+   * transformation functor on real points, such as
+   * functors::BackwardRigidTransformation2D or
+   * functors::BackwardRigidTransformation3D (setBackwardTransform()).
+   *
+   * Unlike ConstImageAdapter combined with a transformation functor,
+   * which maps each output point independently (trigonometry and
+   * rounding included), the output domain is scanned row by row along
+   * its first axis: the input position of the first point of a row is
+   * computed once, then a single vector addition per point gives the
+   * next position. Rows are independent and, if DGtal has been built
+   * with OpenMP support (WITH_OPENMP flag), the parallel methods
+   * process them concurrently.
+   *
+   * Positions falling outside the input domain get the default value
+   * given at construction. In linear mode, the value at a position is
+   * the multilinear interpolation of the \f$ 2^d \f$ surrounding
+   * values (corners outside the domain having the default value);
+   * integral values are rounded to the nearest integer. Values which
+   * are not arithmetic types are not interpolated (nearest-neighbor
+   * sampling is used instead).
+   *
+   * Reading and writing ImageContainerBySTLVector (column-major
+   * storage) images bypasses `operator()` and `setValue` and uses raw
+   * offsets (see detail::ResamplingInput and detail::ResamplingOutput).
+   *
+   * @code
+   * typedef functors::BackwardRigidTransformation3D<Z3i::Space> Backward;
+   * Backward backward( origin, axis, angle, translation );
+   * ImageResampler<Image> resampler( image, ImageResampler<Image>::Linear );
+   * resampler.setBackwardTransform( backward );
+   * resampler.resample( transformedImage );
+   *
+   * // Slice of the volume through center, spanned by u and v.
+   * resampler.reslice( slice, center, u, v );
+   * @endcode
+   *
+   * @tparam TImage a model of concepts::CConstImage whose domain is a
+   * HyperRectDomain.
+   *
+   * @see testImageResampler.cpp
+   */
+  template <typename TImage>
+  class ImageResampler
+  {
+    // ----------------------- Types ------------------------------
+  public:
+    typedef ImageResampler<TImage> Self;
+    typedef TImage Image;
+    typedef typename Image::Domain Domain;
+    typedef typename Image::Point Point;
+    typedef typename Image::Value Value;
+    typedef typename Domain::Space Space;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+
+    /// Dimension of the input image.
+    static const Dimension dimension = Space::dimension;
+
+    /// Interpolation modes.
+    enum Interpolation { NearestNeighbor, Linear };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+     * Constructor. The backward map is the identity.
+     * @param anImage the input image (aliased).
+     * @param anInterpolation the interpolation mode.
+     * @param aDefaultValue the value of the positions outside the
+     * input domain.
+     */
+    ImageResampler( ConstAlias<Image> anImage,
+                    Interpolation anInterpolation = NearestNeighbor,
+                    const Value & aDefaultValue = Value() );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Sets the backward map from the affine functor @a aTransform,
+     * which is evaluated at the origin and at the unit vectors.
+     *
+     * @tparam TBackwardTransform a functor mapping the output real
+     * points to the input real points, assumed affine (e.g.
+     * functors::BackwardRigidTransformation3D).
+     * @param aTransform the backward transformation.
+     */
+    template <typename TBackwardTransform>
+    void setBackwardTransform( const TBackwardTransform & aTransform );
+
+    /**
+     * Sets the backward map \f$ x \mapsto b + A x \f$.
+     * @param anOffset the vector \f$ b \f$.
+     * @param someColumns the columns of \f$ A \f$ (@a dimension vectors).
+     */
+    void setAffineMap( const RealPoint & anOffset,
+                       const std::vector<RealVector> & someColumns );
+
+    /**
+     * @return the interpolation mode.
+     */
+    Interpolation interpolation() const;
+
+    /**
+     * @param anInterpolation the new interpolation mode.
+     */
+    void setInterpolation( Interpolation anInterpolation );
+
+    /**
+     * @param aPoint any real point of the input space.
+     * @return the (interpolated) input value at @a aPoint.
+     */
+    Value sample( const RealPoint & aPoint ) const;
+
+    /**
+     * Sets every point @a p of the domain of @a anOutput to the input
+     * value at the image of @a p by the backward map.
+     *
+     * @tparam TOutputImage a model of concepts::CImage whose domain
+     * is a HyperRectDomain of the same dimension.
+     * @param anOutput the output image.
+     */
+    template <typename TOutputImage>
+    void resample( TOutputImage & anOutput ) const;
+
+    /**
+     * Extracts an oblique slice (or subvolume) of the input image: the
+     * point \f$ q \f$ of the domain of @a anOutput, whose lower bound
+     * is \f$ l \f$, gets the input value at \f$ anOrigin + \sum_i (q_i
+     * - l_i) someDirections[i] \f$. The backward map is not used.
+     *
+     * @tparam TOutputImage a model of concepts::CImage whose domain
+     * is a HyperRectDomain of any dimension \f$ m \f$.
+     * @param anOutput the output image.
+     * @param anOrigin the input position of the lower bound of the
+     * output domain.
+     * @param someDirections the input displacements along the output
+     * axes (\f$ m \f$ vectors, usually orthonormal).
+     */
+    template <typename TOutputImage>
+    void reslice( TOutputImage & anOutput,
+                  const RealPoint & anOrigin,
+                  const std::vector<RealVector> & someDirections ) const;
+
+    /**
+     * Extracts the 2D slice of the input image through @a aCenter
+     * spanned by @a anU and @a aV: the center of the domain of
+     * @a anOutput is mapped to @a aCenter.
+     *
+     * @tparam TOutputImage a model of concepts::CImage whose domain
+     * is a 2D HyperRectDomain.
+     * @param anOutput the output image.
+     * @param aCenter the center of the slice in the input space.
+     * @param anU the input displacement along the first output axis.
+     * @param aV the input displacement along the second output axis.
+     */
+    template <typename TOutputImage>
+    void reslice( TOutputImage & anOutput,
+                  const RealPoint & aCenter,
+                  const RealVector & anU, const RealVector & aV ) const;
+
+    /**
+     * Same as resample, the rows of the output domain being processed
+     * in parallel.
+     * @pre concurrent calls to `setValue` of @a anOutput on distinct
+     * points and concurrent reads of the input image are allowed
+     * (e.g. ImageContainerBySTLVector with non-bool values).
+     * @param anOutput the output image.
+     */
+    template <typename TOutputImage>
+    void resampleParallel( TOutputImage & anOutput ) const;
+
+    /**
+     * Same as reslice, the rows of the output domain being processed
+     * in parallel (see resampleParallel for the preconditions).
+     * @param anOutput the output image.
+     * @param anOrigin the input position of the lower bound of the
+     * output domain.
+     * @param someDirections the input displacements along the output
+     * axes.
+     */
+    template <typename TOutputImage>
+    void resliceParallel( TOutputImage & anOutput,
+                          const RealPoint & anOrigin,
+                          const std::vector<RealVector> & someDirections ) const;
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// Read access to the input image.
+    detail::ResamplingInput<Image> myInput;
+    /// The input image.
+    const Image * myImage;
+    /// The interpolation mode.
+    Interpolation myInterpolation;
+    /// The value outside the input domain.
+    Value myDefaultValue;
+    /// Bounds of the input domain.
+    Point myLower, myUpper;
+    /// The offset of the backward map.
+    RealPoint myOffset;
+    /// The columns of the linear part of the backward map.
+    std::vector<RealVector> myColumns;
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+     * Nearest-neighbor sampling.
+     * @param aPoint any real point of the input space.
+     * @return the value of the nearest point or the default value.
+     */
+    Value sampleNearest( const RealPoint & aPoint ) const;
+
+    /**
+     * Linear sampling (arithmetic values).
+     * @param aPoint any real point of the input space.
+     * @param isArithmetic tag selecting the arithmetic version.
+     * @return the interpolated value.
+     */
+    Value sampleLinear( const RealPoint & aPoint, std::true_type isArithmetic ) const;
+
+    /**
+     * Linear sampling of non arithmetic values: nearest-neighbor.
+     * @param aPoint any real point of the input space.
+     * @param isArithmetic tag selecting the non arithmetic version.
+     * @return the value of the nearest point or the default value.
+     */
+    Value sampleLinear( const RealPoint & aPoint, std::false_type isArithmetic ) const;
+
+    /**
+     * Row-by-row scan shared by reslice and resliceParallel.
+     * @param anOutput the output image.
+     * @param anOrigin the input position of the lower bound of the
+     * output domain.
+     * @param someDirections the input displacements along the output
+     * axes.
+     * @param isParallel if 'true', rows are processed in parallel.
+     */
+    template <typename TOutputImage>
+    void scanRows( TOutputImage & anOutput,
+                   const RealPoint & anOrigin,
+                   const std::vector<RealVector> & someDirections,
+                   bool isParallel ) const;
+
+  }; // end of class ImageResampler
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'ImageResampler'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'ImageResampler' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TImage>
+  std::ostream&
+  operator<< ( std::ostream & out, const ImageResampler<TImage> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageResampler.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageResampler_h
+
+#undef ImageResampler_RECURSES
+#endif // else defined(ImageResampler_RECURSES)
@@ -0,0 +1,292 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file ImageSpanEvaluation.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module ImageSpanEvaluation.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(ImageSpanEvaluation_RECURSES)
+#error Recursive header files inclusion detected in ImageSpanEvaluation.h
+#else // defined(ImageSpanEvaluation_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define ImageSpanEvaluation_RECURSES
+
+#if !defined ImageSpanEvaluation_h
+/** Prevents repeated inclusion of headers. */
+#define ImageSpanEvaluation_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <type_traits>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+  /**
+   * @name Span evaluation of images and functors
+   *
+   * A span is a sequence of @a length consecutive points starting at
+   * a point @a start along the axis @a dim, i.e. the points
+   * \f$ start + k e_{dim} \f$ for \f$ 0 \le k < length \f$.
+   *
+   * Images may provide a member
+   * @code
+   * template <typename TOutputIterator>
+   * TOutputIterator evalSpan( const Point & start, Dimension dim, Size length, TOutputIterator out ) const;
+   * @endcode
+   * writing the values of the span into @a out without the per-point
+   * domain check and linearization of `operator()`
+   * (see ImageContainerBySTLVector, ConstImageAdapter, ImageAdapter).
+   *
+   * Value functors may provide a span form
+   * @code
+   * template <typename TInputIterator, typename TOutputIterator>
+   * TOutputIterator transform( TInputIterator first, TInputIterator last, TOutputIterator out ) const;
+   * @endcode
+   * which behaves like `std::transform` with the functor itself. It
+   * is written as a plain loop without aliasing nor function-pointer
+   * indirection so that the compiler can vectorize it (see
+   * functors::Identity, functors::Cast, functors::Thresholder,
+   * functors::IntervalThresholder).
+   *
+   * The following helpers select the span form when available and
+   * fall back to per-point (resp. per-value) evaluation otherwise.
+   */
+  /// @{
+
+  namespace functors
+  {
+    /**
+     * Description of template class 'HasSpanForm' <p>
+     * \brief Aim: Checks whether the functor @a TFunctor provides
+     * the span form `transform( first, last, out )` for the given
+     * iterator types.
+     *
+     * @tparam TFunctor the functor type.
+     * @tparam TInputIterator the input iterator type.
+     * @tparam TOutputIterator the output iterator type.
+     */
+    template <typename TFunctor, typename TInputIterator, typename TOutputIterator>
+    struct HasSpanForm
+    {
+    private:
+      template <typename F>
+      static char test( decltype( std::declval<const F&>().transform( std::declval<TInputIterator>(),
+                                                                       std::declval<TInputIterator>(),
+                                                                       std::declval<TOutputIterator>() ) ) * );
+      template <typename F>
+      static long test( ... );
+
+    public:
+      /// True if the span form is available.
+      static const bool value = sizeof( test<TFunctor>( 0 ) ) == 1;
+    };
+
+    /**
+     * Applies @a aFunctor on the values of [ @a first, @a last ) and
+     * writes the results into @a out. Uses the span form of the
+     * functor if any.
+     *
+     * @param aFunctor any unary functor.
+     * @param first begin iterator on the input values.
+     * @param last end iterator on the input values.
+     * @param out output iterator.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TFunctor, typename TInputIterator, typename TOutputIterator>
+    TOutputIterator
+    transformSpan( const TFunctor & aFunctor,
+                   TInputIterator first, TInputIterator last,
+                   TOutputIterator out );
+  } // namespace functors
+
+  namespace functions
+  {
+    /**
+     * Description of template class 'HasEvalSpan' <p>
+     * \brief Aim: Checks whether the image @a TImage provides the
+     * member `evalSpan( start, dim, length, out )`.
+     *
+     * @tparam TImage the image type.
+     * @tparam TOutputIterator the output iterator type.
+     */
+    template <typename TImage, typename TOutputIterator>
+    struct HasEvalSpan
+    {
+    private:
+      template <typename I>
+      static char test( decltype( std::declval<const I&>().evalSpan( std::declval<typename I::Point>(),
+                                                                     Dimension(0), std::size_t(0),
+                                                                     std::declval<TOutputIterator>() ) ) * );
+      template <typename I>
+      static long test( ... );
+
+    public:
+      /// True if the image provides evalSpan.
+      static const bool value = sizeof( test<TImage>( 0 ) ) == 1;
+    };
+
+    /**
+     * Writes into @a out the values of @a anImage on the span of
+     * @a aLength points starting at @a aStart along the axis @a aDim.
+     * Uses the member evalSpan of the image if any, `operator()`
+     * otherwise.
+     *
+     * @pre the span lies in the image domain.
+     *
+     * @param anImage any model of concepts::CConstImage.
+     * @param aStart the first point of the span.
+     * @param aDim the axis of the span.
+     * @param aLength the number of points of the span.
+     * @param out output iterator on values.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TImage, typename TOutputIterator>
+    TOutputIterator
+    evalSpan( const TImage & anImage,
+              const typename TImage::Point & aStart,
+              Dimension aDim, std::size_t aLength,
+              TOutputIterator out );
+
+    /**
+     * Checks whether the span of @a aLength points starting at
+     * @a aStart along the axis @a aDim lies in @a aDomain. Only the
+     * extremities are checked for hyper-rectangular domains.
+     *
+     * @param aDomain any model of concepts::CDomain.
+     * @param aStart the first point of the span.
+     * @param aDim the axis of the span.
+     * @param aLength the number of points of the span.
+     * @return 'true' if every point of the span is in @a aDomain.
+     */
+    template <typename TDomain>
+    bool
+    isSpanInside( const TDomain & aDomain,
+                  const typename TDomain::Point & aStart,
+                  Dimension aDim, std::size_t aLength );
+
+    /**
+     * Writes into @a out the points of the domain of @a anImage
+     * whose value satisfies @a aValuePredicate, in the order of the
+     * domain.
+     *
+     * For hyper-rectangular domains, the values are read row by row
+     * along the first axis with evalSpan and tested with
+     * functors::transformSpan, so that images and predicates
+     * providing span forms are processed without per-point overhead.
+     * Other domains are scanned point by point.
+     *
+     * @param anImage any model of concepts::CConstImage.
+     * @param aValuePredicate a predicate on the image values.
+     * @param out output iterator on points.
+     * @return the output iterator past the last written point.
+     */
+    template <typename TImage, typename TValuePredicate, typename TOutputIterator>
+    TOutputIterator
+    selectPointsByValue( const TImage & anImage,
+                         const TValuePredicate & aValuePredicate,
+                         TOutputIterator out );
+
+    /**
+     * Parallel version of selectPointsByValue: the points of the
+     * domain of @a anImage whose value satisfies @a aValuePredicate
+     * are stored in @a aPoints (cleared first), in the order of the
+     * domain.
+     *
+     * The domain is split into slabs orthogonal to its last axis. If
+     * DGtal has been built with OpenMP support (WITH_OPENMP flag), the
+     * slabs are scanned in parallel, each into its own vector, and the
+     * vectors are then concatenated in slab order. The result is
+     * therefore the same as the sequential version.
+     *
+     * @pre the domain of @a anImage is a HyperRectDomain, and
+     * concurrent reads of @a anImage and calls to @a aValuePredicate
+     * are allowed (e.g. not ImageContainerByBlockGrid whose cache is
+     * updated on read).
+     *
+     * @param anImage any model of concepts::CConstImage.
+     * @param aValuePredicate a predicate on the image values.
+     * @param[out] aPoints the selected points.
+     */
+    template <typename TImage, typename TValuePredicate>
+    void
+    selectPointsByValueParallel( const TImage & anImage,
+                                 const TValuePredicate & aValuePredicate,
+                                 std::vector<typename TImage::Point> & aPoints );
+  } // namespace functions
+
+  namespace detail
+  {
+    /**
+     * Span evaluation shared by ConstImageAdapter and ImageAdapter:
+     * writes into @a out the values \f$ f(img(g(p))) \f$ (or
+     * @a aDefaultValue when \f$ g(p) \f$ is outside the image domain)
+     * for the points @a p of the span.
+     *
+     * When @a g is functors::Identity and the span lies in the image
+     * domain, the values are read with functions::evalSpan and
+     * transformed with functors::transformSpan, by chunks of 64 values
+     * stored on the stack.
+     *
+     * @param anImage the adapted image.
+     * @param aFD the domain functor g.
+     * @param aFV the value functor f.
+     * @param aDefaultValue the value outside the image domain.
+     * @param aStart the first point of the span.
+     * @param aDim the axis of the span.
+     * @param aLength the number of points of the span.
+     * @param out output iterator on values.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TImage, typename TFunctorD, typename TFunctorV,
+              typename TValue, typename TPoint, typename TOutputIterator>
+    TOutputIterator
+    adapterEvalSpan( const TImage & anImage,
+                     const TFunctorD & aFD, const TFunctorV & aFV,
+                     const TValue & aDefaultValue,
+                     const TPoint & aStart, Dimension aDim, std::size_t aLength,
+                     TOutputIterator out );
+  } // namespace detail
+
+  /// @}
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions
+#include "DGtal/images/ImageSpanEvaluation.ih"
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined ImageSpanEvaluation_h
+
+#undef ImageSpanEvaluation_RECURSES
+#endif // else defined(ImageSpanEvaluation_RECURSES)
@@ -98,6 +98,22 @@ namespace DGtal {
       return ((*it) > myMinVal) && ((*it) <= myMaxVal);
     }
 
+    /**
+     * Span form: tests each value of [ @a first, @a last ) against the interval,
+     * as operator() does for a single point.
+     * @param first begin iterator on image values.
+     * @param last end iterator on image values.
+     * @param out output iterator on booleans.
+     * @return the output iterator past the last written value.
+     */
+    template <typename TInputIterator, typename TOutputIterator>
+    TOutputIterator transform(TInputIterator first, TInputIterator last, TOutputIterator out) const
+    {
+      for ( ; first != last; ++first, ++out )
+        *out = ( *first > myMinVal ) && ( *first <= myMaxVal );
+      return out;
+    }
+
   
   private:
     const Image* myImage;
@@ -100,12 +100,24 @@ public:
     inline
     Point operator()( const Point& aInput ) const
     {
-        Point p;
-        p[0] = std::floor ( ( ( t_cos * ( aInput[0] - origin[0] ) -
-               t_sin * ( aInput[1] - origin[1] ) ) + translation[0] ) + origin[0] + 0.5 );
+        const RealPoint r = this->operator()( RealPoint ( aInput[0], aInput[1] ) );
+        return Point ( std::floor ( r[0] + 0.5 ), std::floor ( r[1] + 0.5 ) );
+    }
+
+    /**
+       * Operator on real points (no rounding).
+       *
+       * @return the transformed real point.
+       */
+    inline
+    RealPoint operator()( const RealPoint& aInput ) const
+    {
+        RealPoint p;
+        p[0] = ( ( t_cos * ( aInput[0] - origin[0] ) -
+               t_sin * ( aInput[1] - origin[1] ) ) + translation[0] ) + origin[0];
 
-        p[1] = std::floor ( ( ( t_sin * ( aInput[0] - origin[0] ) +
-               t_cos * ( aInput[1] - origin[1] ) ) + translation[1] ) + origin[1] + 0.5 );
+        p[1] = ( ( t_sin * ( aInput[0] - origin[0] ) +
+               t_cos * ( aInput[1] - origin[1] ) ) + translation[1] ) + origin[1];
         return p;
     }
 
@@ -164,12 +176,24 @@ public:
     inline
     Point operator()( const Point& aInput ) const
     {
-        Point p;
-        p[0] = std::floor ( ( t_cos * (aInput[0] - translation[0] - origin[0] ) +
-               t_sin * ( aInput[1] - translation[1] - origin[1] ) ) + origin[0] + 0.5 );
+        const RealPoint r = this->operator()( RealPoint ( aInput[0], aInput[1] ) );
+        return Point ( std::floor ( r[0] + 0.5 ), std::floor ( r[1] + 0.5 ) );
+    }
+
+    /**
+       * Operator on real points (no rounding).
+       *
+       * @return the transformed real point.
+       */
+    inline
+    RealPoint operator()( const RealPoint& aInput ) const
+    {
+        RealPoint p;
+        p[0] = ( t_cos * (aInput[0] - translation[0] - origin[0] ) +
+               t_sin * ( aInput[1] - translation[1] - origin[1] ) ) + origin[0];
 
-        p[1] = std::floor ( ( -t_sin * ( aInput[0] - translation[0] - origin[0] ) +
-               t_cos * ( aInput[1] - translation[1] - origin[1] ) ) + origin[1] + 0.5 );
+        p[1] = ( -t_sin * ( aInput[0] - translation[0] - origin[0] ) +
+               t_cos * ( aInput[1] - translation[1] - origin[1] ) ) + origin[1];
         return p;
     }
 
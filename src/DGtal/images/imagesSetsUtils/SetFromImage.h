@@ -41,10 +41,14 @@
 //////////////////////////////////////////////////////////////////////////////
 // Inclusions
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/images/CImage.h"
 #include "DGtal/kernel/sets/CDigitalSet.h"
+#include "DGtal/kernel/sets/DigitalSetInserter.h"
 #include "DGtal/images/IntervalForegroundPredicate.h"
+#include "DGtal/images/SimpleThresholdForegroundPredicate.h"
+#include "DGtal/images/ImageSpanEvaluation.h"
 //////////////////////////////////////////////////////////////////////////////
 
 namespace DGtal
@@ -129,6 +133,46 @@ namespace DGtal
       append<Image,ForegroundPredicate>(aSet,isForeground,domain.begin(),domain.end());
     }
 
+    /** 
+     * Append an Image value set  to an existing Set (maybe empty).
+     * Specialization for IntervalForegroundPredicate: the image values
+     * are read and tested by spans along the first axis (see
+     * functions::selectPointsByValue).
+     * @pre the predicate instance must have been created on
+     * the image @a aImage.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param isForeground the foreground predicate.
+     */
+    template<typename Image>
+    static
+    void append(Set &aSet, const Image &aImage,
+                const functors::IntervalForegroundPredicate<Image> &isForeground)
+    {
+      functions::selectPointsByValue( aImage, isForeground, DigitalSetInserter<Set>( aSet ) );
+    }
+
+    /** 
+     * Append an Image value set  to an existing Set (maybe empty).
+     * Specialization for SimpleThresholdForegroundPredicate: the image
+     * values are read and tested by spans along the first axis (see
+     * functions::selectPointsByValue).
+     * @pre the predicate instance must have been created on
+     * the image @a aImage.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param isForeground the foreground predicate.
+     */
+    template<typename Image>
+    static
+    void append(Set &aSet, const Image &aImage,
+                const functors::SimpleThresholdForegroundPredicate<Image> &isForeground)
+    {
+      functions::selectPointsByValue( aImage, isForeground, DigitalSetInserter<Set>( aSet ) );
+    }
+
     /** 
      * Append an Image value set  to an existing Set (maybe empty).
      * This method will construct a default ForegroundPredicate
@@ -151,6 +195,55 @@ namespace DGtal
       append(aSet,aImage,isForeground);
     }
 
+
+    /** 
+     * Parallel version of append( aSet, aImage, isForeground ) for
+     * predicates on image values such as IntervalForegroundPredicate
+     * and SimpleThresholdForegroundPredicate (see
+     * functions::selectPointsByValueParallel). The domain is split
+     * into slabs scanned in parallel if DGtal has been built with
+     * OpenMP support; the selected points are then inserted with
+     * insertNew, in the order of the domain. With
+     * DigitalSetBySTLVector, the resulting vector is thus sorted in
+     * the domain order.
+     * @pre the predicate instance must have been created on
+     * the image @a aImage, the points of the domain of @a aImage are
+     * not in @a aSet, and concurrent reads of @a aImage are allowed.
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param isForeground the foreground predicate.
+     */
+    template<typename Image, typename ForegroundPredicate>
+    static
+    void appendParallel(Set &aSet, const Image &aImage,
+                        const ForegroundPredicate &isForeground)
+    {
+      std::vector<typename Image::Point> points;
+      functions::selectPointsByValueParallel( aImage, isForeground, points );
+      for ( typename std::vector<typename Image::Point>::const_iterator it = points.begin(),
+              itEnd = points.end(); it != itEnd; ++it )
+        aSet.insertNew( *it );
+    }
+
+    /** 
+     * Parallel version of append( aSet, aImage, minVal, maxVal ),
+     * thresholding values in ]minVal,maxVal].
+     *
+     * @param aSet the set (maybe empty) to which points are added.
+     * @param aImage image to convert to a Set.
+     * @param minVal minimum value of the thresholding
+     * @param maxVal maximum value of the thresholding
+     */
+    template<typename Image>
+    static
+    void appendParallel(Set &aSet, const Image &aImage, 
+                        const typename Image::Value minVal,
+                        const typename Image::Value maxVal)
+    {
+      functors::IntervalForegroundPredicate<Image> isForeground(aImage,minVal,maxVal);
+      appendParallel(aSet,aImage,isForeground);
+    }
   };
 } // namespace DGtal
 
@@ -261,6 +261,13 @@ namespace DGtal
      */
     PointVector( const Self & other );
 
+    /**
+     * Move constructor. Components holding resources (e.g. BigInteger)
+     * are moved instead of copied.
+     * @param other the object to move, left in a valid unspecified state.
+     */
+    PointVector( Self && other );
+
     /**
      * Copy constructor from another component PointVector.
      * A static cast is used to cast the values during the copy.
@@ -277,6 +284,14 @@ namespace DGtal
      */
     Self & operator= ( const Self & pv );
 
+    /**
+     * Move assignment operator.
+     *
+     * @param pv the object to move, left in a valid unspecified state.
+     * @return a reference on 'this'.
+     */
+    Self & operator= ( Self && pv );
+
     /**
      * Partial copy of a given PointVector. Only coordinates in dimensions
      * are copied.
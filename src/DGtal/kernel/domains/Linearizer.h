@@ -60,6 +60,29 @@ namespace DGtal
    */
   struct ColMajorStorage {};
 
+  /**
+   * @brief Tag (empty structure) specifying a blocked (bricked) storage order.
+   *
+   * The domain is split into blocks of \f$ 2^L \f$ points along each
+   * axis (\f$ L \f$ being @a TLog2BlockSize). The blocks are stored
+   * one after the other in column-major order and the values inside a
+   * block are also stored in column-major order. Thus, the neighbours
+   * of a point are most likely stored in the same block, which
+   * improves the memory locality of neighbourhood operations in
+   * dimension 3 and above.
+   *
+   * Since every block is complete, the storage is padded when the
+   * domain extent is not a multiple of the block width (see
+   * Linearizer::getStorageSize).
+   *
+   * @tparam TLog2BlockSize base-2 logarithm of the block width
+   * (default is 2, i.e. blocks of \f$ 4^d \f$ points).
+   *
+   * @see Linearizer
+   */
+  template < unsigned int TLog2BlockSize = 2 >
+  struct BlockedStorage {};
+
   /////////////////////////////////////////////////////////////////////////////
   /**
    * @brief Aim: Linearization and de-linearization interface for domains.
@@ -68,7 +91,7 @@ namespace DGtal
    * This class is empty but there is a specialization for HyperRectDomain.
    *
    * @tparam  TDomain       Type of the domain.
-   * @tparam  TStorageOrder Storage Order (RowMajorStorage of ColMajorStorage).
+   * @tparam  TStorageOrder Storage Order (RowMajorStorage, ColMajorStorage or BlockedStorage).
    *
    */
   template <
@@ -172,6 +195,129 @@ namespace DGtal
       static inline
       Point getPoint( Size anIndex, Domain const& aDomain );
 
+      /** Number of values needed to store a domain of given extent.
+       *
+       * @param[in] anExtent  The domain extent.
+       * @return  the size of the storage (the number of points of the domain).
+       */
+      static inline
+      Size getStorageSize( Extent const& anExtent );
+
+  }; // end of class Linearizer
+
+  /**
+   * @brief Aim: Linearization and de-linearization interface for HyperRectDomain with blocked storage.
+   *
+   * Same interface as the row-major and column-major linearizers, the
+   * index of a point being the index of its block times the block
+   * volume plus the index of the point inside its block (see
+   * BlockedStorage).
+   *
+   * Example:
+   * @code
+   * typedef SpaceND<3>             Space;
+   * tydedef HyperRectDomain<Space> Domain;
+   * typedef typename Space::Point  Point;
+   * typedef Linearizer<Domain, BlockedStorage<2> > BlockedLinearizer;
+   *
+   * const Domain domain( Point(0, 0, 0), Point(9, 9, 9) );
+   *
+   * BlockedLinearizer::getIndex( Point(5, 1, 0), domain );  // returns 69 (second block).
+   * BlockedLinearizer::getStorageSize( domain.upperBound() - domain.lowerBound() + Point::diagonal(1) ); // returns 12*12*12.
+   * @endcode
+   *
+   * @tparam  TSpace          Type of the space of the HyperRectDomain.
+   * @tparam  TLog2BlockSize  Base-2 logarithm of the block width.
+   */
+  template <
+      typename TSpace,
+      unsigned int TLog2BlockSize
+    >
+  struct Linearizer< HyperRectDomain<TSpace>, BlockedStorage<TLog2BlockSize> >
+    {
+      // Usefull typedefs
+      typedef HyperRectDomain<TSpace> Domain; ///< The domain type.
+      typedef typename TSpace::Point Point;   ///< The point type.
+      typedef Point Extent;                   ///< The domain's extent type.
+      typedef typename TSpace::Size  Size;    ///< The space's size type.
+
+      /** Linearized index of a point, given the domain lower-bound and extent.
+       *
+       * @param[in] aPoint      The point to be linearized.
+       * @param[in] aLowerBound The lower-bound of the domain.
+       * @param[in] anExtent    The extent of the domain.
+       * @return the linearized index of the point.
+       */
+      static inline
+      Size getIndex( Point aPoint, Point const& aLowerBound, Extent const& anExtent );
+
+      /** Linearized index of a point, given the domain extent.
+       *
+       * The lower-bound of the domain is defined to the origin.
+       *
+       * @param[in] aPoint    The Point to be linearized.
+       * @param[in] anExtent  The extent of the domain.
+       * @return the linearized index of the point.
+       */
+      static inline
+      Size getIndex( Point aPoint, Extent const& anExtent );
+
+      /** Linearized index of a point, given a domain.
+       *
+       * @param[in] aPoint    The Point to be linearized.
+       * @param[in] aDomain   The domain.
+       * @return the linearized index of the point.
+       */
+      static inline
+      Size getIndex( Point aPoint, Domain const& aDomain );
+
+      /** De-linearization of an index, given the domain lower-bound and extent.
+       *
+       * @param[in] anIndex     The linearized index.
+       * @param[in] aLowerBound The lower-bound of the domain.
+       * @param[in] anExtent    The domain extent.
+       * @return  the point whose linearized index is anIndex.
+       */
+      static inline
+      Point getPoint( Size anIndex, Point const& aLowerBound, Extent const& anExtent );
+
+      /** De-linearization of an index, given the domain extent.
+       *
+       * The lower-bound of the domain is set to the origin.
+       *
+       * @param[in] anIndex   The linearized index.
+       * @param[in] anExtent  The domain extent.
+       * @return  the point whose linearized index is anIndex.
+       */
+      static inline
+      Point getPoint( Size anIndex, Extent const& anExtent );
+
+      /** De-linearization of an index, given a domain.
+       *
+       * @param[in] anIndex   The linearized index.
+       * @param[in] aDomain   The domain.
+       * @return  the point whose linearized index is anIndex.
+       */
+      static inline
+      Point getPoint( Size anIndex, Domain const& aDomain );
+
+      /** Number of values needed to store a domain of given extent.
+       *
+       * @param[in] anExtent  The domain extent.
+       * @return  the size of the storage, including the padding of the
+       * blocks that straddle the domain upper bound.
+       */
+      static inline
+      Size getStorageSize( Extent const& anExtent );
+
+      /** Extent of the grid of blocks covering a domain of given extent.
+       *
+       * @param[in] anExtent  The domain extent.
+       * @return  the number of blocks along each axis.
+       */
+      static inline
+      Extent getBlockExtent( Extent const& anExtent );
+
   }; // end of class Linearizer
 
 } // namespace DGtal
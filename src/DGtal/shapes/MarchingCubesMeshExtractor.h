@@ -0,0 +1,334 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file MarchingCubesMeshExtractor.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module MarchingCubesMeshExtractor.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(MarchingCubesMeshExtractor_RECURSES)
+#error Recursive header files inclusion detected in MarchingCubesMeshExtractor.h
+#else // defined(MarchingCubesMeshExtractor_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define MarchingCubesMeshExtractor_RECURSES
+
+#if !defined MarchingCubesMeshExtractor_h
+/** Prevents repeated inclusion of headers. */
+#define MarchingCubesMeshExtractor_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/CPointEmbedder.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/shapes/Mesh.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class MarchingCubesMeshExtractor
+  /**
+     Description of template class 'MarchingCubesMeshExtractor' <p>
+     \brief Aim: Extracts the isosurface of a scalar function sampled
+     on the points of a 3D digital domain as an indexed Mesh, with
+     vertices shared by all the faces around them.
+
+     Each grid edge joining an interior point to an exterior point
+     gives one mesh vertex, placed by linear interpolation of the
+     function values. Each cube of 8 neighboring points gives one
+     polygon per loop of such edges around it. The result is the
+     same surface as the one obtained by tracking the boundary
+     surfels of the interior points and embedding them with
+     ImageLinearCellEmbedder (see volMarchingCubes.cpp): one vertex
+     per surfel and one face per umbrella around a pointel. Cross
+     configurations on cube faces are resolved as SurfelAdjacency
+     does, with the interior or the exterior adjacency. Faces are
+     counterclockwise when seen from the exterior.
+
+     The domain is split into slabs of cubes along the last axis,
+     which are processed in parallel with OpenMP. A slab only keeps
+     two slices of function values and of edge vertex indices, so
+     that vertices are shared without any global edge map. Vertices
+     are numbered slice by slice, hence the output mesh does not
+     depend on the number of threads. Surfaces reaching the border
+     of the domain are left open there.
+
+     @code
+     typedef functors::Composer< RegularPointEmbedder<Z3i::Space>, ImplicitBall<Z3i::Space>, double > Function;
+     Function f( embedder, ball );
+     MarchingCubesMeshExtractor< Z3i::Space, Function, RegularPointEmbedder<Z3i::Space> >
+       extractor( f, embedder, 0.0, false );
+     Mesh<Z3i::RealPoint> mesh;
+     extractor.extract( mesh, domain );
+     @endcode
+
+     @tparam TSpace the digital space, of dimension 3.
+     @tparam TPointFunctor the type of the scalar function, a functor
+     Point -> Value where Value is convertible to double (e.g. an
+     image, or an implicit function composed with a point
+     embedder). Its const operator() is called from several threads.
+     @tparam TEmbedder the type of point embedder used to place the
+     vertices, a model of concepts::CPointEmbedder.
+  */
+  template <typename TSpace, typename TPointFunctor, typename TEmbedder>
+  class MarchingCubesMeshExtractor
+  {
+    BOOST_STATIC_ASSERT(( TSpace::dimension == 3 ));
+    BOOST_CONCEPT_ASSERT(( concepts::CPointEmbedder<TEmbedder> ));
+
+  public:
+    typedef TSpace Space;
+    typedef TPointFunctor PointFunctor;
+    typedef TEmbedder Embedder;
+    typedef typename Space::Integer Integer;
+    typedef typename Space::Point Point;
+    typedef typename Space::RealPoint RealPoint;
+    typedef typename Space::RealVector RealVector;
+    typedef HyperRectDomain<Space> Domain;
+    /// The type of the output mesh.
+    typedef DGtal::Mesh<RealPoint> OutputMesh;
+    /// The type of vertex index in the output mesh.
+    typedef unsigned int Index;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor.
+
+       @param f the scalar function, evaluated at the points of the domain.
+       @param e the point embedder, which places the points in the Euclidean space.
+       @param isovalue the value of the isosurface.
+       @param interiorIsBelow when 'true', a point is interior iff
+       its value is lower than \a isovalue (e.g. implicit
+       polynomials), otherwise iff its value is greater than \a
+       isovalue (e.g. images or ImplicitBall).
+       @param interiorAdjacency when 'true', the polygons separate
+       interior points that are only diagonally adjacent on a cube
+       face (interior adjacency of SurfelAdjacency), otherwise they
+       separate such exterior points (exterior adjacency).
+    */
+    MarchingCubesMeshExtractor( ConstAlias<PointFunctor> f,
+                                ConstAlias<Embedder> e,
+                                double isovalue,
+                                bool interiorIsBelow = true,
+                                bool interiorAdjacency = true );
+
+    /**
+     * Destructor.
+     */
+    ~MarchingCubesMeshExtractor();
+
+    // ----------------------- Extraction services ----------------------------
+  public:
+
+    /**
+       Appends the isosurface within \a domain to \a mesh. Vertex
+       indices of the new faces are shifted by the number of vertices
+       already in \a mesh.
+
+       @param[in,out] mesh the mesh where vertices and faces are added.
+       @param domain the domain of the sampling points.
+    */
+    void extract( OutputMesh & mesh, const Domain & domain ) const;
+
+    /**
+       Appends the isosurface within \a domain to \a mesh, and the
+       outward unit normal vector at each new vertex to \a normals.
+       Normals are the gradient of the function, estimated by
+       centered differences at the two ends of the edge of the vertex
+       and linearly interpolated.
+
+       @param[in,out] mesh the mesh where vertices and faces are added.
+       @param domain the domain of the sampling points.
+       @param[in,out] normals the vector where normals are added, one per new vertex.
+    */
+    void extract( OutputMesh & mesh, const Domain & domain,
+                  std::vector<RealVector> & normals ) const;
+
+    /// @return the value of the isosurface.
+    double isovalue() const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The maximal length of the encoded polygons of one cube configuration.
+    static const unsigned int CaseLength = 20;
+    /// Flags a vertex index that is local to the next slab.
+    static const Index NextSlabFlag = 0x80000000u;
+
+    /// Vertices and faces produced by one slab of cubes.
+    struct Slab
+    {
+      /// The positions of the vertices owned by the slab.
+      std::vector<RealPoint> vertices;
+      /// Their normals, when requested.
+      std::vector<RealVector> normals;
+      /// The number of vertices of each face.
+      std::vector<unsigned char> faceSizes;
+      /// The vertices of the faces, local to this slab or to the next one.
+      std::vector<Index> faceVertices;
+    };
+
+    /// A pointer on the scalar function.
+    const PointFunctor* myFunctor;
+    /// A pointer on the point embedder.
+    const Embedder* myEmbedder;
+    /// The value of the isosurface.
+    double myIsovalue;
+    /// When 'true', interior points are below the isovalue.
+    bool myInteriorIsBelow;
+    /// For each of the 256 cube configurations, the number of
+    /// vertices of each polygon followed by its cube edges, ended by 0.
+    unsigned char myCases[ 256 ][ CaseLength ];
+
+    // ------------------------- Hidden services ------------------------------
+  protected:
+
+    /**
+     * Constructor.
+     * Forbidden by default (protected to avoid g++ warnings).
+     */
+    MarchingCubesMeshExtractor();
+
+  private:
+
+    /**
+     * Copy constructor.
+     * @param other the object to clone.
+     * Forbidden by default.
+     */
+    MarchingCubesMeshExtractor ( const MarchingCubesMeshExtractor & other );
+
+    /**
+     * Assignment.
+     * @param other the object to copy.
+     * @return a reference on 'this'.
+     * Forbidden by default.
+     */
+    MarchingCubesMeshExtractor & operator= ( const MarchingCubesMeshExtractor & other );
+
+    // ------------------------- Internals ------------------------------------
+  private:
+
+    /**
+       Computes the polygons of every cube configuration.
+       @param interiorAdjacency the adjacency used on cross configurations.
+    */
+    void computeCases( bool interiorAdjacency );
+
+    /**
+       Appends the isosurface and, if \a normals is not null, the normals.
+    */
+    void extract( OutputMesh & mesh, const Domain & domain,
+                  std::vector<RealVector>* normals ) const;
+
+    /**
+       Extracts the vertices and faces of the cubes between slices \a
+       k0 and \a k1 of the domain.
+       @param[out] slab the produced vertices and faces.
+       @param domain the domain of the sampling points.
+       @param k0 the index of the first slice of the slab.
+       @param k1 the index of the last slice of the slab, which is
+       the first one of the next slab.
+       @param withNormals when 'true', normals are computed.
+    */
+    void extractSlab( Slab & slab, const Domain & domain,
+                      Integer k0, Integer k1, bool withNormals ) const;
+
+    /**
+       @param v any value of the function.
+       @return 'true' iff a point of value \a v is interior.
+    */
+    bool isInterior( double v ) const;
+
+    /**
+       Adds to \a slab the vertex on the edge from \a p to \a q.
+       @param slab the slab owning the vertex.
+       @param domain the domain of the sampling points.
+       @param p the interior or exterior end of the edge.
+       @param q the other end of the edge, p plus a unit vector.
+       @param fp the function value at p.
+       @param fq the function value at q.
+       @param withNormals when 'true', the normal is computed.
+       @return the index of the vertex in \a slab.
+    */
+    Index addVertex( Slab & slab, const Domain & domain,
+                     const Point & p, const Point & q,
+                     double fp, double fq, bool withNormals ) const;
+
+    /**
+       @param domain the domain of the sampling points.
+       @param p any point of the domain.
+       @return the gradient of the function at \a p, by centered
+       differences (one-sided on the border of the domain).
+    */
+    RealVector gradient( const Domain & domain, const Point & p ) const;
+
+  }; // end of class MarchingCubesMeshExtractor
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'MarchingCubesMeshExtractor'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'MarchingCubesMeshExtractor' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TSpace, typename TPointFunctor, typename TEmbedder>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const MarchingCubesMeshExtractor<TSpace, TPointFunctor, TEmbedder> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/shapes/MarchingCubesMeshExtractor.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined MarchingCubesMeshExtractor_h
+
+#undef MarchingCubesMeshExtractor_RECURSES
+#endif // else defined(MarchingCubesMeshExtractor_RECURSES)
@@ -0,0 +1,400 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file DigitalSurfaceCSRGraph.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module DigitalSurfaceCSRGraph.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(DigitalSurfaceCSRGraph_RECURSES)
+#error Recursive header files inclusion detected in DigitalSurfaceCSRGraph.h
+#else // defined(DigitalSurfaceCSRGraph_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define DigitalSurfaceCSRGraph_RECURSES
+
+#if !defined DigitalSurfaceCSRGraph_h
+/** Prevents repeated inclusion of headers. */
+#define DigitalSurfaceCSRGraph_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include <set>
+#include <map>
+#include <algorithm>
+#include <boost/iterator/counting_iterator.hpp>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/topology/DigitalSurface.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class DigitalSurfaceCSRGraph
+  /**
+     Description of template class 'DigitalSurfaceCSRGraph' <p>
+     \brief Aim: Represents the graph of a digital surface with
+     vertices numbered from 0 to size()-1 and a precomputed adjacency
+     stored in compressed sparse row (CSR) format.
+
+     The surfels of the digital surface are indexed once, in
+     increasing order, and their neighbors are computed once with the
+     tracker of the surface: the neighbors of vertex i are the entries
+     offsets()[i] to offsets()[i+1]-1 of neighbors(), in the order of
+     DigitalSurface::writeNeighbors. The construction is done in
+     parallel when OpenMP is available, each thread using its own copy
+     of the surface (hence of its tracker).
+
+     Afterwards, degree() is constant time and writeNeighbors() copies
+     a contiguous range of indices, without any Khalimsky space lookup
+     nor predicate evaluation. This is useful for algorithms that visit
+     the surface many times (e.g. many breadth-first traversals).
+     Vertex data can be stored in arrays indexed by vertices.
+
+     The graph is a model of concepts::CUndirectedSimpleGraph, so that
+     BreadthFirstVisitor, DepthFirstVisitor or
+     DistanceBreadthFirstVisitor can visit it directly, and it is a
+     boost graph when DigitalSurfaceCSRGraphBoostGraphInterface.h is
+     included.
+
+     @code
+     typedef DigitalSurfaceCSRGraph< MyContainer > Graph;
+     Graph graph( surface );
+     BreadthFirstVisitor< Graph > visitor( graph, graph.index( bel ) );
+     while ( ! visitor.finished() )
+       {
+         trace.info() << graph.surfel( visitor.current().first ) << std::endl;
+         visitor.expand();
+       }
+     @endcode
+
+     @tparam TDigitalSurfaceContainer any model of
+     concepts::CDigitalSurfaceContainer.
+
+     @tparam TIndex the unsigned integral type of the vertices.
+
+     @see testDigitalSurfaceCSRGraph.cpp
+   */
+  template <typename TDigitalSurfaceContainer, typename TIndex = DGtal::uint32_t>
+  class DigitalSurfaceCSRGraph
+  {
+  public:
+    typedef TDigitalSurfaceContainer DigitalSurfaceContainer;
+    typedef TIndex Index;
+    BOOST_CONCEPT_ASSERT(( concepts::CUnsignedNumber<Index> ));
+    BOOST_CONCEPT_ASSERT(( concepts::CIntegralNumber<Index> ));
+
+    // ----------------------- boost graph tags ------------------------------
+  public:
+    /// the graph is undirected.
+    typedef boost::undirected_tag directed_category;
+    /// the graph satisfies AdjacencyListGraph and VertexListGraph concepts.
+    typedef boost::DigitalSurface_graph_traversal_category traversal_category;
+    /// the graph does not allow parallel edges.
+    typedef boost::disallow_parallel_edge_tag edge_parallel_category;
+
+    // ----------------------- types ------------------------------
+  public:
+    typedef DigitalSurfaceCSRGraph<TDigitalSurfaceContainer, TIndex> Self;
+    typedef DigitalSurface<DigitalSurfaceContainer> Surface;
+    typedef typename Surface::KSpace KSpace;
+    typedef typename Surface::Surfel Surfel;
+    /// Type of the positions in the neighbors array.
+    typedef DGtal::uint64_t Offset;
+
+    // ----------------------- UndirectedSimpleGraph --------------------------
+  public:
+    /// Defines the type for a vertex.
+    typedef Index Vertex;
+    /// Defines how to represent a size (unsigned integral type).
+    typedef typename KSpace::Size Size;
+    /// Defines how to represent a set of vertex.
+    typedef std::set<Vertex> VertexSet;
+    /// Template rebinding for defining the type that is a mapping
+    /// Vertex -> Value.
+    template <typename Value> struct VertexMap {
+      typedef typename std::map<Vertex, Value> Type;
+    };
+    /**
+       An edge is a unordered pair of vertices. To make comparisons
+       easier, the smallest vertex is stored before the greatest
+       vertex.
+    */
+    struct Edge {
+      /// The two vertices.
+      Vertex vertices[ 2 ];
+      /**
+          Constructor from vertices.
+          @param v1 the first vertex.
+          @param v2 the second vertex.
+      */
+      Edge( const Vertex & v1, const Vertex & v2 )
+      {
+        vertices[ 0 ] = std::min( v1, v2 );
+        vertices[ 1 ] = std::max( v1, v2 );
+      }
+      bool operator==( const Edge & other ) const
+      {
+        return ( vertices[ 0 ] == other.vertices[ 0 ] )
+          && ( vertices[ 1 ] == other.vertices[ 1 ] );
+      }
+      bool operator<( const Edge & other ) const
+      {
+        return ( vertices[ 0 ] < other.vertices[ 0 ] )
+          || ( ( vertices[ 0 ] == other.vertices[ 0 ] )
+               && ( vertices[ 1 ] < other.vertices[ 1 ] ) );
+      }
+    };
+    /// Iterator over the vertices.
+    typedef boost::counting_iterator<Vertex> ConstIterator;
+    /// Iterator over the neighbors of a vertex.
+    typedef const Vertex* NeighborConstIterator;
+
+    /// Defines an arc of the graph, i.e. an arrow between two
+    /// adjacent vertices.
+    struct Arc {
+      Vertex base; ///< base vertex
+      Vertex head; ///< head vertex
+      /**
+         Default constructor. The arc is invalid.
+      */
+      inline Arc()
+        : base( 0 ), head( 0 ) {}
+      inline Arc( Vertex theBase, Vertex theHead )
+        : base( theBase ), head( theHead ) {}
+      inline bool operator==( const Arc & other ) const
+      {
+        return ( base == other.base ) && ( head == other.head );
+      }
+      inline bool operator!=( const Arc & other ) const
+      {
+        return ( base != other.base ) || ( head != other.head );
+      }
+      inline bool operator<( const Arc & other ) const
+      {
+        return ( base < other.base )
+          || ( ( base == other.base ) && ( head < other.head ) );
+      }
+    };
+    /// The range of arcs is defined as a vector.
+    typedef std::vector<Arc> ArcRange;
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. Indexes the surfels of @a aSurface and computes
+       their neighbors.
+
+       @param aSurface the digital surface, which is referenced.
+    */
+    DigitalSurfaceCSRGraph( ConstAlias<Surface> aSurface );
+
+    /**
+     * Destructor.
+     */
+    ~DigitalSurfaceCSRGraph();
+
+    // ----------------------- Services --------------------------------------
+  public:
+
+    /// @return the digital surface.
+    const Surface & surface() const;
+
+    /// @return the surfels, sorted, such that surfel(i) == surfels()[ i ].
+    const std::vector<Surfel> & surfels() const;
+
+    /// @return the positions of the neighbors of each vertex in
+    /// neighbors() (size()+1 values).
+    const std::vector<Offset> & offsets() const;
+
+    /// @return the neighbors of all the vertices.
+    const std::vector<Vertex> & neighbors() const;
+
+    /**
+       @param v any vertex.
+       @return the surfel of vertex @a v.
+    */
+    const Surfel & surfel( const Vertex & v ) const;
+
+    /**
+       @param s any surfel.
+       @return the vertex of surfel @a s, or size() if @a s does not
+       belong to the surface (logarithmic time).
+    */
+    Vertex index( const Surfel & s ) const;
+
+    /// @return the number of arcs of the graph, i.e. twice its number of edges.
+    Offset nbArcs() const;
+
+    /**
+       @param v any vertex.
+       @return an iterator on the first neighbor of @a v.
+    */
+    NeighborConstIterator neighborsBegin( const Vertex & v ) const;
+
+    /**
+       @param v any vertex.
+       @return an iterator after the last neighbor of @a v.
+    */
+    NeighborConstIterator neighborsEnd( const Vertex & v ) const;
+
+    /**
+       @param v any vertex.
+       @return the arcs starting from @a v.
+    */
+    ArcRange outArcs( const Vertex & v ) const;
+
+    /**
+       @param a any arc.
+       @return the head of @a a.
+    */
+    Vertex head( const Arc & a ) const;
+
+    // ----------------------- Undirected simple graph services -------------------------
+  public:
+
+    /// @return an iterator on the first vertex.
+    ConstIterator begin() const;
+
+    /// @return an iterator after the last vertex.
+    ConstIterator end() const;
+
+    /// @return the number of vertices of the graph.
+    Size size() const;
+
+    /**
+       @return the maximal number of neighbors for a vertex.
+    */
+    Size bestCapacity() const;
+
+    /**
+       @param v any vertex.
+       @return the number of neighbors of this vertex (constant time).
+    */
+    Size degree( const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of @a v in the output iterator @a it.
+
+       @tparam OutputIterator the type for the output iterator.
+       @param[in,out] it any output iterator on vertices.
+       @param[in] v any vertex.
+    */
+    template <typename OutputIterator>
+    void writeNeighbors( OutputIterator & it,
+                         const Vertex & v ) const;
+
+    /**
+       Writes the neighbors of @a v satisfying @a pred in the output
+       iterator @a it.
+
+       @tparam OutputIterator the type for the output iterator.
+       @tparam VertexPredicate any type of predicate taking a Vertex as input.
+       @param[in,out] it any output iterator on vertices.
+       @param[in] v any vertex.
+       @param[in] pred the predicate for selecting neighbors.
+    */
+    template <typename OutputIterator, typename VertexPredicate>
+    void writeNeighbors( OutputIterator & it,
+                         const Vertex & v,
+                         const VertexPredicate & pred ) const;
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The digital surface.
+    const Surface* mySurface;
+    /// The sorted surfels.
+    std::vector<Surfel> mySurfels;
+    /// The positions of the neighbors of each vertex in myNeighbors.
+    std::vector<Offset> myOffsets;
+    /// The neighbors of all the vertices.
+    std::vector<Vertex> myNeighbors;
+    /// The maximal degree.
+    Size myMaxDegree;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+       Computes the neighbors of all the vertices.
+    */
+    void computeNeighbors();
+
+    /**
+       Computes the degrees and neighbors of a range of vertices.
+
+       @param[in] surface the digital surface, with its own tracker.
+       @param[in] first the first vertex.
+       @param[in] last the vertex after the last vertex.
+       @param[out] neighbors the neighbors of the vertices of the range.
+    */
+    void computeNeighbors( const Surface & surface, Vertex first, Vertex last,
+                           std::vector<Vertex> & neighbors );
+
+  }; // end of class DigitalSurfaceCSRGraph
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'DigitalSurfaceCSRGraph'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'DigitalSurfaceCSRGraph' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TDigitalSurfaceContainer, typename TIndex>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const DigitalSurfaceCSRGraph<TDigitalSurfaceContainer, TIndex> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/DigitalSurfaceCSRGraph.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined DigitalSurfaceCSRGraph_h
+
+#undef DigitalSurfaceCSRGraph_RECURSES
+#endif // else defined(DigitalSurfaceCSRGraph_RECURSES)
@@ -0,0 +1,358 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+#pragma once
+
+/**
+ * @file StreamingDigitalSurface.h
+ *
+ * @date 2026/10/18
+ *
+ * Header file for module StreamingDigitalSurface.ih
+ *
+ * This file is part of the DGtal library.
+ */
+
+#if defined(StreamingDigitalSurface_RECURSES)
+#error Recursive header files inclusion detected in StreamingDigitalSurface.h
+#else // defined(StreamingDigitalSurface_RECURSES)
+/** Prevents recursive inclusion of headers. */
+#define StreamingDigitalSurface_RECURSES
+
+#if !defined StreamingDigitalSurface_h
+/** Prevents repeated inclusion of headers. */
+#define StreamingDigitalSurface_h
+
+//////////////////////////////////////////////////////////////////////////////
+// Inclusions
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/ConstAlias.h"
+#include "DGtal/kernel/domains/HyperRectDomain.h"
+#include "DGtal/topology/CCellularGridSpaceND.h"
+//////////////////////////////////////////////////////////////////////////////
+
+namespace DGtal
+{
+
+  /////////////////////////////////////////////////////////////////////////////
+  // template class StreamingDigitalSurface
+  /**
+     Description of template class 'StreamingDigitalSurface' <p>
+     \brief Aim: Produces the boundary surfels of a shape given by a
+     point predicate slice by slice along the last axis, keeping only
+     a bounded window of slices of the predicate in memory.
+
+     The surfels are the ones of Surfaces::sMakeBoundary in the bounds
+     of the cellular grid space, with the same orientation. The
+     surfels of slice z are the ones between two points of slice z,
+     and the ones between slice z and slice z+1. When slice z is
+     current, the predicate values of slices z-halo to z+halo+1 are
+     cached in a ring buffer: the memory is O(slice size * halo), and
+     the predicate is evaluated once per point, in the order of the
+     slices. This is well suited to large chunked or out-of-core
+     images (e.g. TiledImage thresholded by a PointFunctorPredicate).
+
+     Contrary to the models of CDigitalSurfaceContainer, the surface
+     is not randomly accessible: it is visited once with start() and
+     next(), or with scan(), or evaluated with eval(). Windowed
+     estimators, whose neighborhoods lie within halo slices of their
+     surfel, evaluate the cached predicate through window(), and
+     their results are written to an output iterator (e.g. a
+     std::ostream_iterator) slice by slice.
+
+     @code
+     typedef StreamingDigitalSurface<Z3i::KSpace, Predicate> Streaming;
+     Streaming streaming( K, predicate, 2 );
+     for ( streaming.start(); streaming.next(); )
+       for ( Streaming::SurfelConstIterator it = streaming.surfels().begin(),
+             itE = streaming.surfels().end(); it != itE; ++it )
+         trace.info() << *it << " " << streaming.window()( K.sCoords( K.sDirectIncident( *it, K.sOrthDir( *it ) ) ) ) << std::endl;
+     @endcode
+
+     @tparam TKSpace a model of CCellularGridSpaceND: the type chosen
+     for the cellular grid space.
+
+     @tparam TPointPredicate a model of CPointPredicate: the type
+     chosen for the predicate defining the shape, evaluated from a
+     single thread.
+   */
+  template <typename TKSpace, typename TPointPredicate>
+  class StreamingDigitalSurface
+  {
+    BOOST_CONCEPT_ASSERT(( concepts::CCellularGridSpaceND<TKSpace> ));
+
+  public:
+    typedef StreamingDigitalSurface<TKSpace, TPointPredicate> Self;
+    typedef TKSpace KSpace;
+    typedef TPointPredicate PointPredicate;
+    typedef typename KSpace::Integer Integer;
+    typedef typename KSpace::Size Size;
+    typedef typename KSpace::Point Point;
+    typedef typename KSpace::Space Space;
+    typedef typename KSpace::SCell SCell;
+    typedef typename KSpace::SCell Surfel;
+    typedef std::vector<Surfel> SurfelRange;
+    typedef typename SurfelRange::const_iterator SurfelConstIterator;
+    typedef HyperRectDomain<Space> Domain;
+
+    BOOST_STATIC_ASSERT(( KSpace::dimension >= 2 ));
+
+    /// Axis along which slices are streamed.
+    static const Dimension sliceAxis = KSpace::dimension - 1;
+
+    /**
+       A model of CPointPredicate giving the cached values of the
+       predicate in the current window of slices, and false outside
+       the bounds of the space.
+    */
+    class Window
+    {
+    public:
+      typedef typename StreamingDigitalSurface::Point Point;
+
+      /**
+         @param p any point whose last coordinate is between
+         lowerSlice() and upperSlice().
+         @return the value of the predicate at @a p.
+      */
+      bool operator()( const Point & p ) const;
+
+      /// @return the first slice of the window.
+      Integer lowerSlice() const;
+
+      /// @return the last slice of the window.
+      Integer upperSlice() const;
+
+    private:
+      friend class StreamingDigitalSurface;
+      /// The streamed surface.
+      const StreamingDigitalSurface* mySurface;
+    };
+
+    // ----------------------- Standard services ------------------------------
+  public:
+
+    /**
+       Constructor. The surface is positioned before its first slice.
+
+       @param aKSpace the cellular grid space whose bounds are scanned.
+       @param aPP the predicate defining the shape.
+       @param aHalo number of slices cached on each side of the current one.
+    */
+    StreamingDigitalSurface( ConstAlias<KSpace> aKSpace,
+                             ConstAlias<PointPredicate> aPP,
+                             const Integer aHalo = 0 );
+
+    /**
+       Copy constructor.
+       @param other the object to clone.
+    */
+    StreamingDigitalSurface( const StreamingDigitalSurface & other );
+
+    /**
+       Destructor.
+     */
+    ~StreamingDigitalSurface();
+
+  private:
+    /**
+       Assignment.
+       @param other the object to copy.
+       @return a reference on 'this'.
+       Forbidden by default.
+     */
+    StreamingDigitalSurface & operator= ( const StreamingDigitalSurface & other );
+
+    // ----------------------- Services --------------------------------------
+  public:
+
+    /// @return the cellular grid space.
+    const KSpace & space() const;
+
+    /// @return the point predicate.
+    const PointPredicate & pointPredicate() const;
+
+    /// @return the number of slices cached on each side of the current one.
+    Integer halo() const;
+
+    /// @return the first slice of the space.
+    Integer firstSlice() const;
+
+    /// @return the last slice of the space.
+    Integer lastSlice() const;
+
+    /// @return the number of points of a slice.
+    Size sliceSize() const;
+
+    /// @return the number of cached predicate values.
+    Size windowSize() const;
+
+    /**
+       Positions the surface before its first slice.
+    */
+    void start();
+
+    /**
+       Moves to the next slice, loading the slices of its window and
+       computing its surfels.
+
+       @return 'false' when the last slice has already been visited.
+    */
+    bool next();
+
+    /// @return the current slice.
+    Integer currentSlice() const;
+
+    /// @return the surfels of the current slice.
+    const SurfelRange & surfels() const;
+
+    /// @return the predicate values in the window of the current slice.
+    const Window & window() const;
+
+    /**
+       Visits all the slices, calling @a aFunctor( surfels(), window() )
+       for each of them.
+
+       @tparam SliceFunctor the type of the functor.
+       @param aFunctor a functor called for each slice.
+    */
+    template <typename SliceFunctor>
+    void scan( SliceFunctor & aFunctor );
+
+    /**
+       Writes all the surfels, slice by slice.
+
+       @tparam OutputIterator an output iterator on Surfel.
+       @param out the output iterator.
+       @return the output iterator after the last surfel.
+    */
+    template <typename OutputIterator>
+    OutputIterator writeSurfels( OutputIterator out );
+
+    /**
+       Evaluates a windowed estimator at all the surfels, slice by
+       slice, and writes its results in the order of surfels(). The
+       surfels of a slice are evaluated in parallel with OpenMP: the
+       estimator must be callable concurrently.
+
+       @tparam WindowFunctor the type of an estimator with a Quantity
+       type and a const call operator taking a surfel and a Window,
+       which only evaluates the window within halo() slices of the
+       surfel.
+       @tparam OutputIterator an output iterator on WindowFunctor::Quantity.
+
+       @param aFunctor the estimator.
+       @param out the output iterator.
+       @return the output iterator after the last result.
+    */
+    template <typename WindowFunctor, typename OutputIterator>
+    OutputIterator eval( const WindowFunctor & aFunctor, OutputIterator out );
+
+    // ----------------------- Interface --------------------------------------
+  public:
+
+    /**
+     * Writes/Displays the object on an output stream.
+     * @param out the output stream where the object is written.
+     */
+    void selfDisplay ( std::ostream & out ) const;
+
+    /**
+     * Checks the validity/consistency of the object.
+     * @return 'true' if the object is valid, 'false' otherwise.
+     */
+    bool isValid() const;
+
+    // ------------------------- Protected Datas ------------------------------
+  private:
+    // ------------------------- Private Datas --------------------------------
+  private:
+    /// The cellular grid space.
+    const KSpace* myKSpace;
+    /// The shape.
+    const PointPredicate* myPointPredicate;
+    /// Number of slices cached on each side of the current one.
+    Integer myHalo;
+    /// Bounds of the space.
+    Point myLowerBound;
+    Point myUpperBound;
+    /// Linear index steps of the axes of a slice.
+    std::vector<Size> mySteps;
+    /// Number of points of a slice.
+    Size mySliceSize;
+    /// Number of slices of the ring buffer.
+    Size myNbSlots;
+    /// Ring buffer of predicate values.
+    std::vector<char> myValues;
+    /// Current slice.
+    Integer myCurrentSlice;
+    /// Last loaded slice.
+    Integer myLastLoadedSlice;
+    /// Surfels of the current slice.
+    SurfelRange mySurfels;
+    /// Window on the ring buffer.
+    Window myWindow;
+
+    // ------------------------- Hidden services ------------------------------
+  private:
+
+    /**
+       @param aSlice a cached slice.
+       @return the offset of @a aSlice in the ring buffer.
+    */
+    Size sliceOffset( const Integer aSlice ) const;
+
+    /**
+       Evaluates the predicate on a slice and stores it in the ring buffer.
+       @param aSlice the slice to load.
+    */
+    void loadSlice( const Integer aSlice );
+
+    /**
+       Computes the surfels of the current slice.
+    */
+    void computeSurfels();
+
+  }; // end of class StreamingDigitalSurface
+
+
+  /**
+   * Overloads 'operator<<' for displaying objects of class 'StreamingDigitalSurface'.
+   * @param out the output stream where the object is written.
+   * @param object the object of class 'StreamingDigitalSurface' to write.
+   * @return the output stream after the writing.
+   */
+  template <typename TKSpace, typename TPointPredicate>
+  std::ostream&
+  operator<< ( std::ostream & out,
+               const StreamingDigitalSurface<TKSpace, TPointPredicate> & object );
+
+} // namespace DGtal
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Includes inline functions.
+#include "DGtal/topology/StreamingDigitalSurface.ih"
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
+
+#endif // !defined StreamingDigitalSurface_h
+
+#undef StreamingDigitalSurface_RECURSES
+#endif // else defined(StreamingDigitalSurface_RECURSES)
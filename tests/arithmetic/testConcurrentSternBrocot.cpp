@@ -0,0 +1,237 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testConcurrentSternBrocot.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ConcurrentSternBrocot.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/arithmetic/CPositiveIrreducibleFraction.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/SternBrocot.h"
+#include "DGtal/arithmetic/ConcurrentSternBrocot.h"
+#include "DGtal/arithmetic/StandardDSLQ0.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ConcurrentSternBrocot.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Pseudo-random numerators and denominators, reproducible.
+void randomPairs( std::vector<DGtal::int64_t> & ps, std::vector<DGtal::int64_t> & qs,
+                  unsigned int nb, unsigned int seed )
+{
+  srand( seed );
+  ps.resize( nb );
+  qs.resize( nb );
+  for ( unsigned int i = 0; i < nb; ++i )
+    {
+      ps[ i ] = rand() % 10000;
+      qs[ i ] = 1 + rand() % 10000;
+    }
+}
+
+/**
+ * Compares the fractions of the concurrent tree with the ones of
+ * SternBrocot (continued fractions, splits, inverses).
+ */
+template <typename CSB>
+bool testSequential()
+{
+  typedef typename CSB::Fraction Fraction;
+  typedef SternBrocot<DGtal::int64_t, DGtal::int32_t> SB;
+  BOOST_CONCEPT_ASSERT(( concepts::CPositiveIrreducibleFraction< Fraction > ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: sequential fractions against SternBrocot." );
+  std::vector<DGtal::int64_t> ps, qs;
+  randomPairs( ps, qs, 500, 7 );
+  for ( unsigned int i = 0; i < ps.size(); ++i )
+    {
+      Fraction f = CSB::fraction( ps[ i ], qs[ i ] );
+      SB::Fraction g = SB::fraction( ps[ i ], qs[ i ] );
+      std::vector<DGtal::int32_t> cf, cg;
+      f.getCFrac( cf );
+      g.getCFrac( cg );
+      bool ok = ( f.p() == g.p() ) && ( f.q() == g.q() ) && ( f.u() == g.u() )
+        && ( f.k() == g.k() ) && ( cf == cg );
+      ok = ok && ( f.inverse().inverse() == f )
+        && ( f.inverse().p() == f.q() ) && ( f.inverse().q() == f.p() );
+      if ( f.k() > 0 )
+        {
+          Fraction f1, f2;
+          f.getSplit( f1, f2 );
+          ok = ok && ( f1.p() + f2.p() == f.p() ) && ( f1.q() + f2.q() == f.q() );
+        }
+      ok = ok && ( f.left().father() == f ) && ( f.right().father() == f );
+      ok = ok && ( CSB::fraction( ps[ i ], qs[ i ] ) == f );
+      ++nb, nbok += ok ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") fractions, "
+               << CSB::instance().nbFractions() << " nodes in "
+               << CSB::instance().nbChunks() << " chunks." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Builds fractions from several threads at once, then checks that
+ * each fraction is correct and unique.
+ */
+bool testParallel()
+{
+  typedef ConcurrentSternBrocot<DGtal::int64_t, DGtal::int32_t> CSB;
+  typedef CSB::Fraction Fraction;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: parallel creation of fractions." );
+  std::vector<DGtal::int64_t> ps, qs;
+  randomPairs( ps, qs, 4000, 11 );
+  const int n = static_cast<int>( ps.size() );
+  std::vector<Fraction> fractions( n );
+  std::vector<Fraction> lefts( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for ( int i = 0; i < n; ++i )
+    {
+      fractions[ i ] = CSB::fraction( ps[ i ], qs[ i ] );
+      lefts[ i ] = fractions[ i ].left().right().left();
+    }
+
+  IntegerComputer<DGtal::int64_t> ic;
+  for ( int i = 0; i < n; ++i )
+    {
+      const DGtal::int64_t g = ic.gcd( ps[ i ], qs[ i ] );
+      const Fraction & f = fractions[ i ];
+      bool ok = ( f.p() == ps[ i ] / g ) && ( f.q() == qs[ i ] / g );
+      // unique node per fraction
+      ok = ok && ( CSB::fraction( ps[ i ], qs[ i ] ) == f );
+      ok = ok && ( f.left().right().left() == lefts[ i ] );
+      ok = ok && ( lefts[ i ].inverse().inverse() == lefts[ i ] );
+      ++nb, nbok += ok ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") fractions, "
+               << CSB::instance().nbFractions() << " nodes." << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Each thread uses its own tree.
+ */
+bool testPerThread()
+{
+  typedef ConcurrentSternBrocot<DGtal::int64_t, DGtal::int32_t, true> CSB;
+  typedef CSB::Fraction Fraction;
+  trace.beginBlock ( "Testing block: per-thread trees." );
+  std::vector<DGtal::int64_t> ps, qs;
+  randomPairs( ps, qs, 2000, 13 );
+  const int n = static_cast<int>( ps.size() );
+  std::vector<unsigned char> oks( n, 0 );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for ( int i = 0; i < n; ++i )
+    {
+      IntegerComputer<DGtal::int64_t> ic;
+      const DGtal::int64_t g = ic.gcd( ps[ i ], qs[ i ] );
+      Fraction f = CSB::fraction( ps[ i ], qs[ i ] );
+      oks[ i ] = ( f.p() == ps[ i ] / g ) && ( f.q() == qs[ i ] / g )
+        && ( CSB::fraction( ps[ i ], qs[ i ] ) == f ) ? 1 : 0;
+    }
+  unsigned int nbok = 0;
+  for ( int i = 0; i < n; ++i ) nbok += oks[ i ];
+  trace.info() << "(" << nbok << "/" << n << ") fractions." << std::endl;
+  trace.endBlock();
+  return nbok == static_cast<unsigned int>( n );
+}
+
+/**
+ * Standard DSLs built from several threads: checks that the
+ * computed subsegments of many DSLs are the same as the sequential
+ * ones.
+ */
+bool testParallelDSL()
+{
+  typedef ConcurrentSternBrocot<DGtal::int64_t, DGtal::int32_t> CSB;
+  typedef StandardDSLQ0<CSB::Fraction> DSL;
+  typedef DSL::Point Point;
+  trace.beginBlock ( "Testing block: parallel reversedSmartDSS." );
+  std::vector<DGtal::int64_t> ps, qs;
+  randomPairs( ps, qs, 300, 17 );
+  const int n = static_cast<int>( ps.size() );
+  std::vector<DSL> results( n );
+#ifdef WITH_OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+  for ( int i = 0; i < n; ++i )
+    {
+      const DSL D( ps[ i ] % 500, 1 + qs[ i ] % 500, 0 );
+      const Point A = D.lowestY( 0 );
+      const Point B = D.lowestY( 7 * D.a() + 3 );
+      results[ i ] = D.reversedSmartDSS( A, B );
+    }
+  unsigned int nbok = 0;
+  for ( int i = 0; i < n; ++i )
+    {
+      const DSL D( ps[ i ] % 500, 1 + qs[ i ] % 500, 0 );
+      const Point A = D.lowestY( 0 );
+      const Point B = D.lowestY( 7 * D.a() + 3 );
+      const DSL S = D.reversedSmartDSS( A, B );
+      nbok += ( S.slope() == results[ i ].slope() && S.mu() == results[ i ].mu() ) ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << n << ") subsegments." << std::endl;
+  trace.endBlock();
+  return nbok == static_cast<unsigned int>( n );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class ConcurrentSternBrocot" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testSequential< ConcurrentSternBrocot<DGtal::int64_t, DGtal::int32_t> >()
+    && testSequential< ConcurrentSternBrocot<DGtal::int64_t, DGtal::int32_t, true> >()
+    && testParallel()
+    && testPerThread()
+    && testParallelDSL();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,153 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testHybridInteger.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class HybridInteger against BigInteger.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/CInteger.h"
+#include "DGtal/arithmetic/IntegerComputer.h"
+#include "DGtal/arithmetic/HybridInteger.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class HybridInteger.
+///////////////////////////////////////////////////////////////////////////////
+
+/// @return 'true' if the hybrid integer is equal to the big one.
+bool same( const HybridInteger & h, const BigInteger & b )
+{
+  return h.toBigInteger() == b;
+}
+
+/**
+ * Compares all the operations with the ones of BigInteger, on values
+ * around 0, around the 32-bit and 64-bit limits and beyond.
+ */
+bool testOperations()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: operations against BigInteger." );
+  const DGtal::int64_t max = std::numeric_limits<DGtal::int64_t>::max();
+  const DGtal::int64_t min = std::numeric_limits<DGtal::int64_t>::min();
+  std::vector<HybridInteger> values;
+  const DGtal::int64_t natives[] = { 0, 1, -1, 2, -3, 7, 1000000007, -2147483648LL, 4294967296LL,
+                                     max, max - 1, min, min + 1, max / 2, min / 2, 3037000499LL,
+                                     -3037000500LL };
+  for ( unsigned int i = 0; i < sizeof( natives ) / sizeof( DGtal::int64_t ); ++i )
+    values.push_back( HybridInteger( natives[ i ] ) );
+  values.push_back( HybridInteger( BigInteger( "123456789012345678901234567890" ) ) );
+  values.push_back( HybridInteger( BigInteger( "-98765432109876543210" ) ) );
+  values.push_back( HybridInteger( BigInteger( "9223372036854775808" ) ) );  // max + 1
+  values.push_back( HybridInteger( std::numeric_limits<DGtal::uint64_t>::max() ) );
+
+  for ( unsigned int i = 0; i < values.size(); ++i )
+    for ( unsigned int j = 0; j < values.size(); ++j )
+      {
+        const HybridInteger & a = values[ i ];
+        const HybridInteger & b = values[ j ];
+        const BigInteger ba = a.toBigInteger();
+        const BigInteger bb = b.toBigInteger();
+        bool ok = same( a + b, ba + bb ) && same( a - b, ba - bb ) && same( a * b, ba * bb )
+          && ( ( a == b ) == ( ba == bb ) ) && ( ( a != b ) == ( ba != bb ) )
+          && ( ( a < b ) == ( ba < bb ) ) && ( ( a <= b ) == ( ba <= bb ) )
+          && ( ( a > b ) == ( ba > bb ) ) && ( ( a >= b ) == ( ba >= bb ) );
+        if ( bb != 0 )
+          ok = ok && same( a / b, BigInteger( ba / bb ) ) && same( a % b, BigInteger( ba % bb ) );
+        HybridInteger c( a );
+        c += b; c -= b; c *= b;
+        ok = ok && same( c, ba * bb );
+        // results that fit are stored natively
+        ok = ok && ( ( a + b ).isNative() == ( mpz_fits_slong_p( BigInteger( ba + bb ).get_mpz_t() ) != 0 ) );
+        if ( ! ok )
+          trace.warning() << "Error with " << a << " and " << b << std::endl;
+        nbok += ok ? 1 : 0; ++nb;
+      }
+  HybridInteger m( min );
+  nbok += same( -m, -BigInteger( m.toBigInteger() ) ) && ! ( -m ).isNative()
+    && ( -( -m ) ).isNative() && same( m / -1, -BigInteger( m.toBigInteger() ) )
+    && ( m % -1 == 0 ) && same( m - 1, BigInteger( m.toBigInteger() - 1 ) ) ? 1 : 0; ++nb;
+  HybridInteger i( max );
+  ++i;
+  nbok += ! i.isNative() && ( i - 1 == max ) && ( --i ).isNative() && ( i == max ) ? 1 : 0; ++nb;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks the traits and the use of HybridInteger in IntegerComputer.
+ */
+bool testIntegerComputer()
+{
+  BOOST_CONCEPT_ASSERT(( concepts::CInteger<HybridInteger> ));
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: traits and IntegerComputer." );
+  typedef NumberTraits<HybridInteger> NT;
+  nbok += ( NT::ZERO == 0 ) && ( NT::ONE == 1 ) && NT::even( HybridInteger( -4 ) )
+    && NT::odd( HybridInteger( BigInteger( "100000000000000000001" ) ) )
+    && ( NT::castToInt64_t( HybridInteger( -5 ) ) == -5 )
+    && ( NT::castToDouble( HybridInteger( 12 ) ) == 12.0 ) ? 1 : 0; ++nb;
+
+  IntegerComputer<HybridInteger> ic;
+  const HybridInteger p( BigInteger( "1000000000000000000000000000057" ) );
+  const HybridInteger a = p * 6;
+  const HybridInteger b = p * 35;
+  nbok += ( ic.gcd( a, b ) == p ) && ( ic.gcd( HybridInteger( 12 ), HybridInteger( 18 ) ) == 6 )
+    && ( ic.floorDiv( HybridInteger( -7 ), HybridInteger( 2 ) ) == -4 )
+    && ( ic.ceilDiv( HybridInteger( -7 ), HybridInteger( 2 ) ) == -3 ) ? 1 : 0; ++nb;
+  trace.info() << "gcd(" << a << "," << b << ")=" << ic.gcd( a, b ) << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class HybridInteger" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testOperations() && testIntegerComputer();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -29,6 +29,7 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
 
 //#define DEBUG_LatticePolytope2D
 
@@ -375,6 +376,69 @@ checkOutputConvexHullBorder()
   return true;
 }
 
+/**
+ * Checks that the same cuts give the same vertices whether the
+ * polygon is stored in a list or in a vector, one at a time or by
+ * batches.
+ */
+template <typename Space>
+bool testContiguousLatticePolytope2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing block LatticePolytope2D in a vector" );
+  typedef typename Space::Point Point;
+  typedef typename Space::Vector Vector;
+  typedef LatticePolytope2D<Space> CIP;
+  typedef LatticePolytope2D<Space, std::vector<Point> > VCIP;
+  typedef typename CIP::HalfSpace HalfSpace;
+
+  for ( unsigned int j = 0; j < 200; ++j )
+    {
+      CIP cip;
+      VCIP vcip, vcip2;
+      const Point square[ 4 ] = { Point( -100, -100 ), Point( -100, 100 ),
+                                  Point( 100, 100 ), Point( 100, -100 ) };
+      for ( unsigned int k = 0; k < 4; ++k )
+        {
+          cip.pushBack( square[ k ] );
+          vcip.pushBack( square[ k ] );
+        }
+      vcip2 = vcip;
+      std::vector<HalfSpace> cuts;
+      for ( unsigned int i = 0; i < 12; ++i )
+        {
+          int x = 0;
+          int y = 0;
+          while ( ( x == 0 ) && ( y == 0 ) )
+            {
+              x = myRand( 63 ) - 31;
+              y = myRand( 63 ) - 31;
+            }
+          cuts.push_back( HalfSpace( Vector( x, y ), myRand( 60 * 32 ) ) );
+        }
+      bool ok = true;
+      unsigned int nbCuts = 0;
+      for ( unsigned int i = 0; i < cuts.size(); ++i )
+        {
+          bool changed = cip.cut( cuts[ i ] );
+          ok = ok && ( changed == vcip.cut( cuts[ i ] ) )
+            && ( cip.size() == vcip.size() )
+            && std::equal( cip.begin(), cip.end(), vcip.begin() );
+          if ( changed && ! vcip2.empty() ) ++nbCuts;
+        }
+      ok = ok && ( vcip2.cut( cuts.begin(), cuts.end() ) == nbCuts )
+        && ( vcip2.size() == vcip.size() )
+        && std::equal( vcip.begin(), vcip.end(), vcip2.begin() );
+      ++nb, nbok += ok ? 1 : 0;
+      if ( ! ok ) break;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") sequences of cuts" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -387,7 +451,9 @@ int main( int, char** )
   bool res = testLatticePolytope2D<Z2>()
     && testLatticePolytope2D<Z2I>()
     && exhaustiveTestLatticePolytope2D<Z2>()
-    && checkOutputConvexHullBorder<Z2>();
+    && checkOutputConvexHullBorder<Z2>()
+    && testContiguousLatticePolytope2D<Z2>()
+    && testContiguousLatticePolytope2D<Z2I>();
   //&& specificTestLatticePolytope2D<Z2>();
   //&& exhaustiveTestLatticePolytope2D<Z2I>();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -0,0 +1,159 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkDiscreteExteriorCalculusIndexing.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the operator cache and the cell orderings of
+ * DiscreteExteriorCalculus on 3d boxes.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <benchmark/benchmark.h>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+
+/**
+ * @return the calculus of a box of side @a size with cells indexed in
+ * @a ordering, built once per size and ordering. No operator is ever
+ * requested from it, so its copies start with an empty cache.
+ */
+const Calculus& boxCalculus(const int size, const int ordering)
+{
+  static std::map<std::pair<int, int>, Calculus> calculi;
+  const std::pair<int, int> key(size, ordering);
+  std::map<std::pair<int, int>, Calculus>::iterator it = calculi.find(key);
+  if (it == calculi.end())
+    {
+      const Z3i::Domain domain(Z3i::Point::diagonal(0), Z3i::Point::diagonal(size-1));
+      Z3i::DigitalSet set(domain);
+      set.assignFromComplement(Z3i::DigitalSet(domain));
+      it = calculi.insert(std::make_pair(key, CalculusFactory::createFromDigitalSet(set))).first;
+      it->second.reorderIndexes(static_cast<Calculus::IndexOrdering>(ordering));
+    }
+  return it->second;
+}
+
+/// Assembly of the dual laplace in a calculus with an empty cache.
+static void BM_LaplaceAssembly(benchmark::State& state)
+{
+  while (state.KeepRunning())
+    {
+      state.PauseTiming();
+      const Calculus calculus = boxCalculus(state.range(0), Calculus::HASH_ORDER);
+      state.ResumeTiming();
+      benchmark::DoNotOptimize(calculus.laplace<DUAL>().myContainer.nonZeros());
+    }
+}
+BENCHMARK(BM_LaplaceAssembly)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+
+/// Dual laplace requested from a calculus which already cached it.
+static void BM_LaplaceCached(benchmark::State& state)
+{
+  const Calculus calculus = boxCalculus(state.range(0), Calculus::HASH_ORDER);
+  calculus.laplace<DUAL>();
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(calculus.laplace<DUAL>().myContainer.nonZeros());
+}
+BENCHMARK(BM_LaplaceCached)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+
+/// Reindexing of all cells, the first argument is the box size, the second the ordering.
+static void BM_Reindexing(benchmark::State& state)
+{
+  Calculus calculus = boxCalculus(state.range(0), Calculus::HASH_ORDER);
+  while (state.KeepRunning())
+    {
+      calculus.reorderIndexes(static_cast<Calculus::IndexOrdering>(state.range(1)));
+      benchmark::DoNotOptimize(calculus.kFormLength(0, DUAL));
+    }
+}
+BENCHMARK(BM_Reindexing)->ArgPair(32,1)->ArgPair(32,2)->Unit(benchmark::kMillisecond);
+
+/// Application of the dual laplace, the first argument is the box size, the second the ordering.
+static void BM_LaplaceApply(benchmark::State& state)
+{
+  const Calculus& calculus = boxCalculus(state.range(0), state.range(1));
+  const Calculus::SparseMatrix laplace = Calculus(calculus).laplace<DUAL>().myContainer;
+  const Calculus::DenseVector input = Calculus::DenseVector::Random(laplace.cols());
+  Calculus::DenseVector output(laplace.rows());
+  while (state.KeepRunning())
+    {
+      output.noalias() = laplace * input;
+      benchmark::DoNotOptimize(output.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*laplace.rows());
+}
+BENCHMARK(BM_LaplaceApply)->ArgPair(32,0)->ArgPair(32,1)->ArgPair(32,2)->Unit(benchmark::kMicrosecond);
+
+/// Conjugate gradient solve of a dual poisson problem, the first argument is the box size, the second the ordering.
+static void BM_PoissonConjugateGradient(benchmark::State& state)
+{
+  const Calculus& calculus = boxCalculus(state.range(0), state.range(1));
+  const Calculus::SparseMatrix laplace = Calculus(calculus).laplace<DUAL>().myContainer;
+  const Calculus::DenseVector input = Calculus::DenseVector::Ones(laplace.cols());
+  while (state.KeepRunning())
+    {
+      EigenLinearAlgebraBackend::SolverConjugateGradient solver;
+      solver.compute(laplace);
+      benchmark::DoNotOptimize(solver.solve(input).eval().data());
+    }
+}
+BENCHMARK(BM_PoissonConjugateGradient)->ArgPair(32,0)->ArgPair(32,1)->ArgPair(32,2)->Unit(benchmark::kMillisecond);
+
+/// LDLT factorization of the dual laplace without fill reducing permutation, the first argument is the box size, the second the ordering.
+static void BM_PoissonLDLT(benchmark::State& state)
+{
+  typedef Eigen::SimplicialLDLT<Calculus::SparseMatrix, Eigen::Lower, Eigen::NaturalOrdering<Calculus::SparseMatrix::StorageIndex> > Solver;
+  const Calculus& calculus = boxCalculus(state.range(0), state.range(1));
+  const Calculus::SparseMatrix laplace = Calculus(calculus).laplace<DUAL>().myContainer;
+  while (state.KeepRunning())
+    {
+      Solver solver;
+      solver.compute(laplace);
+      benchmark::DoNotOptimize(solver.info());
+    }
+}
+BENCHMARK(BM_PoissonLDLT)->ArgPair(16,0)->ArgPair(16,1)->ArgPair(16,2)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
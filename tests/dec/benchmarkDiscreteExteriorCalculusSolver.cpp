@@ -0,0 +1,205 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkDiscreteExteriorCalculusSolver.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks implicit heat diffusion time steps with full factorizations,
+ * factorizations sharing one symbolic analysis, block solves and warm
+ * started conjugate gradient.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+typedef Calculus::DualIdentity0 DualIdentity0;
+typedef Calculus::DualForm0 DualForm0;
+typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLLT, 0, DUAL, 0, DUAL> DirectSolver;
+typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverConjugateGradient, 0, DUAL, 0, DUAL> IterativeSolver;
+
+/// Number of time steps of a simulation.
+const int steps = 16;
+
+/// @return the calculus of a square of side @a size, built once per size.
+const Calculus& squareCalculus(const int size)
+{
+  static std::map<int, Calculus> calculi;
+  std::map<int, Calculus>::iterator it = calculi.find(size);
+  if (it == calculi.end())
+    {
+      const Z2i::Domain domain(Z2i::Point::diagonal(0), Z2i::Point::diagonal(size-1));
+      Z2i::DigitalSet set(domain);
+      set.assignFromComplement(Z2i::DigitalSet(domain));
+      it = calculi.insert(std::make_pair(size, CalculusFactory::createFromDigitalSet(set))).first;
+    }
+  return it->second;
+}
+
+/// @return implicit heat diffusion operators of decreasing time steps.
+std::vector<DualIdentity0> heatSteps(const Calculus& calculus)
+{
+  std::vector<DualIdentity0> heat_steps;
+  const DualIdentity0 identity = calculus.identity<0, DUAL>();
+  const DualIdentity0 laplace = calculus.laplace<DUAL>();
+  for (int kk=0; kk<steps; kk++)
+    heat_steps.push_back(identity + (1. / (1 + kk)) * laplace);
+  return heat_steps;
+}
+
+/// @return initial temperature, a hot spot in the middle of the square.
+DualForm0 initialTemperature(const Calculus& calculus, const int size)
+{
+  DualForm0 temperature(calculus);
+  temperature.myContainer(calculus.getCellIndex(calculus.myKSpace.uSpel(Z2i::Point::diagonal(size/2)))) = 1;
+  return temperature;
+}
+
+/// Adaptive time steps, each one fully factorized.
+static void BM_HeatCompute(benchmark::State& state)
+{
+  const Calculus& calculus = squareCalculus(state.range(0));
+  const std::vector<DualIdentity0> heat_steps = heatSteps(calculus);
+  while (state.KeepRunning())
+    {
+      DualForm0 temperature = initialTemperature(calculus, state.range(0));
+      for (int kk=0; kk<steps; kk++)
+        {
+          DirectSolver solver;
+          solver.compute(heat_steps[kk]);
+          temperature = solver.solve(temperature);
+        }
+      benchmark::DoNotOptimize(temperature.myContainer.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*steps);
+}
+BENCHMARK(BM_HeatCompute)->Arg(64)->Arg(128)->Arg(256)->Unit(benchmark::kMillisecond);
+
+/// Adaptive time steps sharing one symbolic analysis.
+static void BM_HeatFactorize(benchmark::State& state)
+{
+  const Calculus& calculus = squareCalculus(state.range(0));
+  const std::vector<DualIdentity0> heat_steps = heatSteps(calculus);
+  while (state.KeepRunning())
+    {
+      DualForm0 temperature = initialTemperature(calculus, state.range(0));
+      DirectSolver solver;
+      solver.analyzePattern(heat_steps.front());
+      for (int kk=0; kk<steps; kk++)
+        {
+          solver.factorize(heat_steps[kk]);
+          temperature = solver.solve(temperature);
+        }
+      benchmark::DoNotOptimize(temperature.myContainer.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*steps);
+}
+BENCHMARK(BM_HeatFactorize)->Arg(64)->Arg(128)->Arg(256)->Unit(benchmark::kMillisecond);
+
+/// Constant time steps, one factorization.
+static void BM_HeatConstantStep(benchmark::State& state)
+{
+  const Calculus& calculus = squareCalculus(state.range(0));
+  const std::vector<DualIdentity0> heat_steps = heatSteps(calculus);
+  while (state.KeepRunning())
+    {
+      DualForm0 temperature = initialTemperature(calculus, state.range(0));
+      DirectSolver solver;
+      solver.compute(heat_steps.front());
+      for (int kk=0; kk<steps; kk++)
+        temperature = solver.solve(temperature);
+      benchmark::DoNotOptimize(temperature.myContainer.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*steps);
+}
+BENCHMARK(BM_HeatConstantStep)->Arg(64)->Arg(128)->Arg(256)->Unit(benchmark::kMillisecond);
+
+/// Independent inputs solved one by one (block size 0) or as one block (block size 1).
+static void BM_HeatBlock(benchmark::State& state)
+{
+  const Calculus& calculus = squareCalculus(state.range(0));
+  const std::vector<DualIdentity0> heat_steps = heatSteps(calculus);
+  const Calculus::DenseMatrix inputs = Calculus::DenseMatrix::Random(calculus.kFormLength(0, DUAL), steps);
+  DirectSolver solver;
+  solver.compute(heat_steps.front());
+  while (state.KeepRunning())
+    {
+      if (state.range(1))
+        benchmark::DoNotOptimize(solver.solve(inputs).data());
+      else
+        for (int kk=0; kk<steps; kk++)
+          benchmark::DoNotOptimize(solver.solve(DualForm0(calculus, inputs.col(kk))).myContainer.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*steps);
+}
+BENCHMARK(BM_HeatBlock)->ArgPair(256, 0)->ArgPair(256, 1)->Unit(benchmark::kMillisecond);
+
+/// Constant time steps with the conjugate gradient, cold (0) or warm (1) started.
+static void BM_HeatConjugateGradient(benchmark::State& state)
+{
+  const Calculus& calculus = squareCalculus(state.range(0));
+  const std::vector<DualIdentity0> heat_steps = heatSteps(calculus);
+  IterativeSolver solver;
+  solver.myLinearAlgebraSolver.setTolerance(1e-8);
+  solver.compute(heat_steps.back());
+  Calculus::Index iterations = 0;
+  while (state.KeepRunning())
+    {
+      DualForm0 temperature = initialTemperature(calculus, state.range(0));
+      iterations = 0;
+      for (int kk=0; kk<steps; kk++)
+        {
+          temperature = state.range(1) ? solver.solve(temperature, temperature) : solver.solve(temperature);
+          iterations += solver.myLinearAlgebraSolver.iterations();
+        }
+      benchmark::DoNotOptimize(temperature.myContainer.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*steps);
+  state.counters["cg_iterations"] = iterations;
+}
+BENCHMARK(BM_HeatConjugateGradient)->ArgPair(256, 0)->ArgPair(256, 1)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,148 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkGeometricMultigridSolver.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the multigrid solver against the direct and conjugate
+ * gradient solvers on the dual poisson problem of 3d boxes.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <benchmark/benchmark.h>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/GeometricMultigridSolver.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+
+/// @return the calculus of a box of side @a size, built once per size.
+const Calculus& boxCalculus(const int size)
+{
+  static std::map<int, Calculus> calculi;
+  std::map<int, Calculus>::iterator it = calculi.find(size);
+  if (it == calculi.end())
+    {
+      const Z3i::Domain domain(Z3i::Point::diagonal(0), Z3i::Point::diagonal(size-1));
+      Z3i::DigitalSet set(domain);
+      set.assignFromComplement(Z3i::DigitalSet(domain));
+      it = calculi.insert(std::make_pair(size, CalculusFactory::createFromDigitalSet(set))).first;
+    }
+  return it->second;
+}
+
+/// Factorization and solve of a dual poisson problem with a direct solver.
+static void BM_PoissonLDLT(benchmark::State& state)
+{
+  typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, DUAL, 0, DUAL> Solver;
+  const Calculus& calculus = boxCalculus(state.range(0));
+  const Calculus::DualIdentity0 laplace = calculus.laplace<DUAL>();
+  const Calculus::DualForm0 input(calculus, Calculus::DenseVector::Ones(calculus.kFormLength(0, DUAL)));
+  while (state.KeepRunning())
+    {
+      Solver solver;
+      solver.compute(laplace);
+      benchmark::DoNotOptimize(solver.solve(input).myContainer.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*input.length());
+}
+BENCHMARK(BM_PoissonLDLT)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+
+/// Solve of a dual poisson problem with the diagonal preconditioned conjugate gradient.
+static void BM_PoissonConjugateGradient(benchmark::State& state)
+{
+  typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverConjugateGradient, 0, DUAL, 0, DUAL> Solver;
+  const Calculus& calculus = boxCalculus(state.range(0));
+  const Calculus::DualIdentity0 laplace = calculus.laplace<DUAL>();
+  const Calculus::DualForm0 input(calculus, Calculus::DenseVector::Ones(calculus.kFormLength(0, DUAL)));
+  Calculus::Index iterations = 0;
+  while (state.KeepRunning())
+    {
+      Solver solver;
+      solver.myLinearAlgebraSolver.setTolerance(1e-8);
+      solver.compute(laplace);
+      benchmark::DoNotOptimize(solver.solve(input).myContainer.data());
+      iterations = solver.myLinearAlgebraSolver.iterations();
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*input.length());
+  state.counters["cg_iterations"] = iterations;
+}
+BENCHMARK(BM_PoissonConjugateGradient)->Arg(16)->Arg(32)->Arg(64)->Unit(benchmark::kMillisecond);
+
+/// Hierarchy construction and solve of a dual poisson problem with the multigrid preconditioned conjugate gradient.
+static void BM_PoissonMultigrid(benchmark::State& state)
+{
+  typedef DiscreteExteriorCalculusSolver<Calculus, GeometricMultigridSolver<Calculus>, 0, DUAL, 0, DUAL> Solver;
+  const Calculus& calculus = boxCalculus(state.range(0));
+  const Calculus::DualIdentity0 laplace = calculus.laplace<DUAL>();
+  const Calculus::DualForm0 input(calculus, Calculus::DenseVector::Ones(calculus.kFormLength(0, DUAL)));
+  Calculus::Index iterations = 0;
+  while (state.KeepRunning())
+    {
+      Solver solver;
+      solver.myLinearAlgebraSolver.setTolerance(1e-8);
+      solver.compute(laplace);
+      benchmark::DoNotOptimize(solver.solve(input).myContainer.data());
+      iterations = solver.myLinearAlgebraSolver.iterations();
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*input.length());
+  state.counters["cg_iterations"] = iterations;
+}
+BENCHMARK(BM_PoissonMultigrid)->Arg(16)->Arg(32)->Arg(64)->Unit(benchmark::kMillisecond);
+
+/// Solve only, with a multigrid hierarchy built once.
+static void BM_PoissonMultigridSolve(benchmark::State& state)
+{
+  typedef DiscreteExteriorCalculusSolver<Calculus, GeometricMultigridSolver<Calculus>, 0, DUAL, 0, DUAL> Solver;
+  const Calculus& calculus = boxCalculus(state.range(0));
+  const Calculus::DualForm0 input(calculus, Calculus::DenseVector::Ones(calculus.kFormLength(0, DUAL)));
+  Solver solver;
+  solver.myLinearAlgebraSolver.setTolerance(1e-8);
+  solver.compute(calculus.laplace<DUAL>());
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(solver.solve(input).myContainer.data());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*input.length());
+}
+BENCHMARK(BM_PoissonMultigridSolve)->Arg(32)->Arg(64)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,160 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkMatrixFreeLinearOperator.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the assembled and matrix free laplace operators of
+ * DiscreteExteriorCalculus on 3d boxes.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <map>
+#include <benchmark/benchmark.h>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/MatrixFreeLinearOperator.h"
+#include "DGtal/dec/EigenMatrixFreeOperator.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus;
+typedef MatrixFreeLinearOperator<Calculus, 0, DUAL, 0, DUAL> MatrixFreeLaplace;
+typedef EigenMatrixFreeOperator<MatrixFreeLaplace> EigenLaplace;
+
+/// @return the calculus of a box of side @a size, built once per size.
+const Calculus& boxCalculus(const int size)
+{
+  static std::map<int, Calculus> calculi;
+  std::map<int, Calculus>::iterator it = calculi.find(size);
+  if (it == calculi.end())
+    {
+      const Z3i::Domain domain(Z3i::Point::diagonal(0), Z3i::Point::diagonal(size-1));
+      Z3i::DigitalSet set(domain);
+      set.assignFromComplement(Z3i::DigitalSet(domain));
+      it = calculi.insert(std::make_pair(size, CalculusFactory::createFromDigitalSet(set))).first;
+    }
+  return it->second;
+}
+
+/// Assembly of the dual laplace sparse matrix.
+static void BM_AssembledLaplace(benchmark::State& state)
+{
+  const Calculus& calculus = boxCalculus(state.range(0));
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(calculus.laplace<DUAL>().myContainer.nonZeros());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*calculus.kFormLength(0, DUAL));
+}
+BENCHMARK(BM_AssembledLaplace)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+
+/// Construction of the dual laplace stencils.
+static void BM_MatrixFreeLaplace(benchmark::State& state)
+{
+  const Calculus& calculus = boxCalculus(state.range(0));
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize(calculus.matrixFreeLaplace<DUAL>().myStencils.size());
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*calculus.kFormLength(0, DUAL));
+}
+BENCHMARK(BM_MatrixFreeLaplace)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+
+/// Application of the assembled dual laplace.
+static void BM_AssembledLaplaceApply(benchmark::State& state)
+{
+  const Calculus& calculus = boxCalculus(state.range(0));
+  const Calculus::SparseMatrix laplace = calculus.laplace<DUAL>().myContainer;
+  const Calculus::DenseVector input = Calculus::DenseVector::Random(laplace.cols());
+  Calculus::DenseVector output(laplace.rows());
+  while (state.KeepRunning())
+    {
+      output.noalias() = laplace * input;
+      benchmark::DoNotOptimize(output.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*laplace.rows());
+}
+BENCHMARK(BM_AssembledLaplaceApply)->Arg(16)->Arg(32)->Unit(benchmark::kMicrosecond);
+
+/// Application of the matrix free dual laplace.
+static void BM_MatrixFreeLaplaceApply(benchmark::State& state)
+{
+  const Calculus& calculus = boxCalculus(state.range(0));
+  const MatrixFreeLaplace laplace = calculus.matrixFreeLaplace<DUAL>();
+  const Calculus::DenseVector input = Calculus::DenseVector::Random(laplace.cols());
+  Calculus::DenseVector output(laplace.rows());
+  while (state.KeepRunning())
+    {
+      laplace.apply(input, output);
+      benchmark::DoNotOptimize(output.data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*laplace.rows());
+}
+BENCHMARK(BM_MatrixFreeLaplaceApply)->Arg(16)->Arg(32)->Unit(benchmark::kMicrosecond);
+
+/// Assembly and conjugate gradient solve of a dual poisson problem.
+static void BM_AssembledPoisson(benchmark::State& state)
+{
+  const Calculus& calculus = boxCalculus(state.range(0));
+  const Calculus::DenseVector input = Calculus::DenseVector::Ones(calculus.kFormLength(0, DUAL));
+  while (state.KeepRunning())
+    {
+      EigenLinearAlgebraBackend::SolverConjugateGradient solver;
+      solver.compute(calculus.laplace<DUAL>().myContainer);
+      benchmark::DoNotOptimize(solver.solve(input).eval().data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*input.size());
+}
+BENCHMARK(BM_AssembledPoisson)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+
+/// Matrix free conjugate gradient solve of a dual poisson problem.
+static void BM_MatrixFreePoisson(benchmark::State& state)
+{
+  const Calculus& calculus = boxCalculus(state.range(0));
+  const Calculus::DenseVector input = Calculus::DenseVector::Ones(calculus.kFormLength(0, DUAL));
+  while (state.KeepRunning())
+    {
+      const MatrixFreeLaplace laplace = calculus.matrixFreeLaplace<DUAL>();
+      const EigenLaplace wrapped_laplace(laplace);
+      EigenLaplace::SolverConjugateGradient solver;
+      solver.compute(wrapped_laplace);
+      benchmark::DoNotOptimize(solver.solve(input).eval().data());
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*input.size());
+}
+BENCHMARK(BM_MatrixFreePoisson)->Arg(16)->Arg(32)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,232 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusIndexing.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the operator cache and the cell reindexing of
+ * DiscreteExteriorCalculus.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <algorithm>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// @return the largest distance between the row and the column of a nonzero coefficient.
+template <typename SparseMatrix>
+typename SparseMatrix::Index
+bandwidth(const SparseMatrix& matrix)
+{
+    typename SparseMatrix::Index band = 0;
+    for (typename SparseMatrix::Index kk=0; kk<matrix.outerSize(); kk++)
+        for (typename SparseMatrix::InnerIterator it(matrix, kk); it; ++it)
+            band = std::max(band, it.row() > it.col() ? it.row()-it.col() : it.col()-it.row());
+    return band;
+}
+
+/// @return a form whose values only depend on the khalimsky coordinates of its cells.
+template <typename Calculus, Order order, Duality duality>
+KForm<Calculus, order, duality>
+coordinatesForm(const Calculus& calculus)
+{
+    KForm<Calculus, order, duality> form(calculus);
+    for (typename Calculus::Index index=0; index<form.length(); index++)
+    {
+        const typename Calculus::SCell signed_cell = form.getSCell(index);
+        const typename Calculus::KSpace::Point coords = calculus.myKSpace.sKCoords(signed_cell);
+        double value = 0;
+        for (Dimension kk=0; kk<Calculus::dimensionAmbient; kk++)
+            value = 31*value + coords[kk];
+        form.myContainer(index) = ( calculus.myKSpace.sSign(signed_cell) == Calculus::KSpace::POS ? 1 : -1 ) * std::cos(value);
+    }
+    return form;
+}
+
+/// @return true when both forms have the same value on each cell.
+template <typename Calculus, Order order, Duality duality>
+bool
+sameCellValues(const KForm<Calculus, order, duality>& form_aa, const KForm<Calculus, order, duality>& form_bb)
+{
+    if (form_aa.length() != form_bb.length()) return false;
+    for (typename Calculus::Index index_aa=0; index_aa<form_aa.length(); index_aa++)
+    {
+        const typename Calculus::SCell signed_cell = form_aa.getSCell(index_aa);
+        const typename Calculus::Index index_bb = form_bb.myCalculus->getCellIndex(form_bb.myCalculus->myKSpace.unsigns(signed_cell));
+        const double sign = ( form_bb.getSCell(index_bb) == signed_cell ? 1 : -1 );
+        if (std::abs(form_aa.myContainer(index_aa) - sign*form_bb.myContainer(index_bb)) > 1e-10) return false;
+    }
+    return true;
+}
+
+/**
+ * Compares the operators of a calculus reindexed with @a ordering with
+ * the operators of the same calculus in hash order, cell by cell.
+ */
+template <typename Calculus>
+bool
+testReindexing(const Calculus& calculus, const typename Calculus::IndexOrdering& ordering)
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+    trace.beginBlock("Testing reindexing");
+
+    Calculus reindexed_calculus = calculus;
+    reindexed_calculus.reorderIndexes(ordering);
+    ++nb, nbok += reindexed_calculus.indexOrdering() == ordering ? 1 : 0;
+    for (Order order=0; order<=Calculus::dimensionEmbedded; order++)
+        ++nb, nbok += reindexed_calculus.kFormLength(order, PRIMAL) == calculus.kFormLength(order, PRIMAL) ? 1 : 0;
+
+    const typename Calculus::PrimalForm0 primal_form(coordinatesForm<Calculus, 0, PRIMAL>(calculus));
+    const typename Calculus::PrimalForm0 reindexed_primal_form(coordinatesForm<Calculus, 0, PRIMAL>(reindexed_calculus));
+    const typename Calculus::DualForm0 dual_form(coordinatesForm<Calculus, 0, DUAL>(calculus));
+    const typename Calculus::DualForm0 reindexed_dual_form(coordinatesForm<Calculus, 0, DUAL>(reindexed_calculus));
+    ++nb, nbok += sameCellValues(primal_form, reindexed_primal_form) ? 1 : 0;
+    ++nb, nbok += sameCellValues(dual_form, reindexed_dual_form) ? 1 : 0;
+
+    ++nb, nbok += sameCellValues(calculus.template derivative<0, PRIMAL>() * primal_form,
+                                 reindexed_calculus.template derivative<0, PRIMAL>() * reindexed_primal_form) ? 1 : 0;
+    ++nb, nbok += sameCellValues(calculus.template derivative<0, DUAL>() * dual_form,
+                                 reindexed_calculus.template derivative<0, DUAL>() * reindexed_dual_form) ? 1 : 0;
+    ++nb, nbok += sameCellValues(calculus.template hodge<0, PRIMAL>() * primal_form,
+                                 reindexed_calculus.template hodge<0, PRIMAL>() * reindexed_primal_form) ? 1 : 0;
+    ++nb, nbok += sameCellValues(calculus.template laplace<PRIMAL>() * primal_form,
+                                 reindexed_calculus.template laplace<PRIMAL>() * reindexed_primal_form) ? 1 : 0;
+    ++nb, nbok += sameCellValues(calculus.template laplace<DUAL>() * dual_form,
+                                 reindexed_calculus.template laplace<DUAL>() * reindexed_dual_form) ? 1 : 0;
+    ++nb, nbok += sameCellValues(calculus.template flatDirectional<PRIMAL>(0) * primal_form,
+                                 reindexed_calculus.template flatDirectional<PRIMAL>(0) * reindexed_primal_form) ? 1 : 0;
+
+    const typename Calculus::SparseMatrix laplace = calculus.template laplace<DUAL>().myContainer;
+    const typename Calculus::SparseMatrix reindexed_laplace = reindexed_calculus.template laplace<DUAL>().myContainer;
+    trace.info() << "dual laplace bandwidth " << bandwidth(laplace) << " -> " << bandwidth(reindexed_laplace) << std::endl;
+    if (ordering == Calculus::REVERSE_CUTHILL_MCKEE_ORDER)
+        ++nb, nbok += bandwidth(reindexed_laplace) < bandwidth(laplace) ? 1 : 0;
+
+    // the ordering is kept when the structure changes
+    reindexed_calculus.updateIndexes();
+    reindexed_calculus.eraseCell(reindexed_calculus.myKSpace.unsigns(reindexed_calculus.getSCell(0, DUAL, 0)));
+    reindexed_calculus.updateIndexes();
+    ++nb, nbok += reindexed_calculus.indexOrdering() == ordering && reindexed_calculus.kFormLength(0, DUAL) == calculus.kFormLength(0, DUAL)-1 ? 1 : 0;
+    ++nb, nbok += reindexed_calculus.template laplace<DUAL>().myContainer.rows() == calculus.kFormLength(0, DUAL)-1 ? 1 : 0;
+
+    trace.info() << "(" << nbok << "/" << nb << ") tests" << std::endl;
+    trace.endBlock();
+    return nbok == nb;
+}
+
+/**
+ * Checks that cached operators are identical to assembled ones and
+ * that the cache follows structure and size modifications.
+ */
+template <typename Calculus>
+bool
+testOperatorCache(Calculus calculus)
+{
+    typedef typename Calculus::SparseMatrix SparseMatrix;
+
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+    trace.beginBlock("Testing operator cache");
+
+    const SparseMatrix laplace = calculus.template laplace<DUAL>().myContainer;
+    const SparseMatrix cached_laplace = calculus.template laplace<DUAL>().myContainer;
+    const SparseMatrix expected_laplace = (calculus.template antiderivative<1, DUAL>() * calculus.template derivative<0, DUAL>()).myContainer;
+    ++nb, nbok += SparseMatrix(laplace - cached_laplace).norm() == 0 ? 1 : 0;
+    ++nb, nbok += SparseMatrix(laplace - expected_laplace).norm() < 1e-10 ? 1 : 0;
+
+    const SparseMatrix derivative = calculus.template derivative<0, DUAL>().myContainer;
+    const SparseMatrix cached_derivative = calculus.template derivative<0, DUAL>().myContainer;
+    ++nb, nbok += SparseMatrix(derivative - cached_derivative).norm() == 0 ? 1 : 0;
+
+    // modified sizes
+    const typename Calculus::SCell signed_cell = calculus.getSCell(1, PRIMAL, 0);
+    calculus.insertSCell(signed_cell, 1, .5);
+    calculus.updateIndexes();
+    const SparseMatrix modified_hodge = calculus.template hodge<1, PRIMAL>().myContainer;
+    const typename Calculus::Index index = calculus.getCellIndex(calculus.myKSpace.unsigns(signed_cell));
+    ++nb, nbok += std::abs(modified_hodge.coeff(index, index)) == .5 ? 1 : 0;
+    calculus.resetSizes();
+    ++nb, nbok += std::abs(calculus.template hodge<1, PRIMAL>().myContainer.coeff(index, index)) == 1 ? 1 : 0;
+
+    // modified structure
+    calculus.eraseCell(calculus.myKSpace.unsigns(calculus.getSCell(0, PRIMAL, 0)));
+    calculus.updateIndexes();
+    ++nb, nbok += calculus.template laplace<PRIMAL>().myContainer.rows() == calculus.kFormLength(0, PRIMAL) ? 1 : 0;
+    ++nb, nbok += calculus.template derivative<0, PRIMAL>().myContainer.cols() == calculus.kFormLength(0, PRIMAL) ? 1 : 0;
+
+    trace.info() << "(" << nbok << "/" << nb << ") tests" << std::endl;
+    trace.endBlock();
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main(int argc, char** argv)
+{
+    trace.beginBlock("Testing DiscreteExteriorCalculus indexing");
+    trace.info() << "Args:";
+    for (int i = 0; i < argc; ++i)
+        trace.info() << " " << argv[i];
+    trace.info() << endl;
+
+    typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+    typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus2D;
+    typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus3D;
+
+    // 2d disk with a hole
+    const Z2i::Domain domain_2d(Z2i::Point(-12, -12), Z2i::Point(12, 12));
+    Z2i::DigitalSet set_2d(domain_2d);
+    for (Z2i::Domain::ConstIterator pi=domain_2d.begin(), pie=domain_2d.end(); pi!=pie; pi++)
+    {
+        const Z2i::Point& point = *pi;
+        const int norm = point.dot(point);
+        if (norm <= 120 && norm > 8) set_2d.insertNew(point);
+    }
+    const Calculus2D calculus_2d = CalculusFactory::createFromDigitalSet(set_2d);
+
+    // 3d box
+    const Z3i::Domain domain_3d(Z3i::Point(0, 0, 0), Z3i::Point(9, 7, 5));
+    Z3i::DigitalSet set_3d(domain_3d);
+    set_3d.assignFromComplement(Z3i::DigitalSet(domain_3d));
+    const Calculus3D calculus_3d = CalculusFactory::createFromDigitalSet(set_3d);
+
+    const bool res = testOperatorCache(calculus_2d)
+        && testOperatorCache(calculus_3d)
+        && testReindexing(calculus_2d, Calculus2D::MORTON_ORDER)
+        && testReindexing(calculus_2d, Calculus2D::REVERSE_CUTHILL_MCKEE_ORDER)
+        && testReindexing(calculus_3d, Calculus3D::MORTON_ORDER)
+        && testReindexing(calculus_3d, Calculus3D::REVERSE_CUTHILL_MCKEE_ORDER);
+    trace.emphase() << (res ? "Passed." : "Error.") << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
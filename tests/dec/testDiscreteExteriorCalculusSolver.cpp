@@ -0,0 +1,220 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDiscreteExteriorCalculusSolver.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing factorization reuse, warm starts and block
+ * solves of class DiscreteExteriorCalculusSolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/GeometricMultigridSolver.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus;
+typedef Calculus::DualForm0 DualForm0;
+typedef Calculus::DualIdentity0 DualIdentity0;
+
+/// Relative difference between two vectors or matrices.
+template <typename Dense>
+double
+relativeError(const Dense& solution, const Dense& expected)
+{
+    return (solution - expected).template lpNorm<Eigen::Infinity>() / expected.template lpNorm<Eigen::Infinity>();
+}
+
+/// Implicit heat diffusion step operator.
+DualIdentity0
+heatStep(const Calculus& calculus, const double time_step)
+{
+    return calculus.identity<0, DUAL>() + time_step * calculus.laplace<DUAL>();
+}
+
+/// Solver settings, default ones for direct solvers.
+template <typename LinearAlgebraSolver>
+void
+configure(LinearAlgebraSolver& /*linear_algebra_solver*/)
+{
+}
+
+void
+configure(EigenLinearAlgebraBackend::SolverConjugateGradient& linear_algebra_solver)
+{
+    linear_algebra_solver.setTolerance(1e-10);
+}
+
+void
+configure(GeometricMultigridSolver<Calculus>& linear_algebra_solver)
+{
+    linear_algebra_solver.setTolerance(1e-10).setCoarsestSize(50);
+}
+
+/**
+ * Time steps of various sizes sharing one symbolic analysis, compared
+ * with full factorizations, then a block of inputs solved at once.
+ */
+template <typename LinearAlgebraSolver>
+bool
+testFactorizationReuse(const Calculus& calculus)
+{
+    typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, DUAL, 0, DUAL> Solver;
+    typedef DiscreteExteriorCalculusSolver<Calculus, EigenLinearAlgebraBackend::SolverSimplicialLDLT, 0, DUAL, 0, DUAL> DirectSolver;
+
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+    trace.beginBlock("Testing factorization reuse");
+
+    const DualForm0 input(calculus, Calculus::DenseVector::Random(calculus.kFormLength(0, DUAL)));
+
+    // iterative solvers keep a reference to the operator
+    std::vector<DualIdentity0> heat_steps;
+    for (int kk=0; kk<4; kk++)
+        heat_steps.push_back(heatStep(calculus, 1. / (1 << kk)));
+
+    Solver solver;
+    configure(solver.myLinearAlgebraSolver);
+    solver.analyzePattern(heat_steps.front());
+    double max_error = 0;
+    for (std::size_t kk=0; kk<heat_steps.size(); kk++)
+    {
+        DirectSolver direct_solver;
+        direct_solver.compute(heat_steps[kk]);
+        const DualForm0 expected = direct_solver.solve(input);
+
+        solver.factorize(heat_steps[kk]);
+        const DualForm0 solution = solver.solve(input);
+        max_error = std::max(max_error, relativeError(solution.myContainer, expected.myContainer));
+        nb++, nbok += solver.isValid() ? 1 : 0;
+    }
+    trace.info() << "refactorized solution error=" << max_error << std::endl;
+    ++nb, nbok += max_error < 1e-6 ? 1 : 0;
+
+    // block of inputs
+    const Calculus::DenseMatrix inputs = Calculus::DenseMatrix::Random(calculus.kFormLength(0, DUAL), 5);
+    const Calculus::DenseMatrix solutions = solver.solve(inputs);
+    max_error = 0;
+    for (int kk=0; kk<inputs.cols(); kk++)
+    {
+        const DualForm0 solution = solver.solve(DualForm0(calculus, inputs.col(kk)));
+        max_error = std::max(max_error, relativeError(Calculus::DenseVector(solutions.col(kk)), solution.myContainer));
+    }
+    trace.info() << "block solution error=" << max_error << std::endl;
+    ++nb, nbok += solutions.rows() == inputs.rows() && solutions.cols() == inputs.cols() && max_error < 1e-6 ? 1 : 0;
+
+    trace.info() << "(" << nbok << "/" << nb << ") tests" << std::endl;
+    trace.endBlock();
+    return nbok == nb;
+}
+
+/**
+ * Slowly varying inputs solved by an iterative solver started from the
+ * previous solution, compared with cold starts.
+ */
+template <typename LinearAlgebraSolver>
+bool
+testWarmStart(const Calculus& calculus)
+{
+    typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, 0, DUAL, 0, DUAL> Solver;
+
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+    trace.beginBlock("Testing warm start");
+
+    const DualIdentity0 heat_step = heatStep(calculus, .1);
+    Solver solver;
+    configure(solver.myLinearAlgebraSolver);
+    solver.compute(heat_step);
+
+    const DualForm0 input(calculus, Calculus::DenseVector::Random(calculus.kFormLength(0, DUAL)));
+    const DualForm0 perturbation(calculus, Calculus::DenseVector::Random(calculus.kFormLength(0, DUAL)));
+    DualForm0 warm = solver.solve(input);
+    DualForm0 cold = warm;
+    long int warm_iterations = 0;
+    long int cold_iterations = 0;
+    for (int kk=1; kk<=5; kk++)
+    {
+        const DualForm0 current_input(calculus, input.myContainer + 1e-3 * kk * perturbation.myContainer);
+        cold = solver.solve(current_input);
+        cold_iterations += solver.myLinearAlgebraSolver.iterations();
+        warm = solver.solve(current_input, warm);
+        warm_iterations += solver.myLinearAlgebraSolver.iterations();
+    }
+    const double error = relativeError(warm.myContainer, cold.myContainer);
+    trace.info() << "iterations cold=" << cold_iterations << " warm=" << warm_iterations << " error=" << error << std::endl;
+    ++nb, nbok += solver.isValid() && error < 1e-6 ? 1 : 0;
+    ++nb, nbok += warm_iterations < cold_iterations ? 1 : 0;
+
+    // exact guess
+    solver.solve(input, solver.solve(input));
+    trace.info() << "iterations from solution=" << solver.myLinearAlgebraSolver.iterations() << std::endl;
+    ++nb, nbok += solver.myLinearAlgebraSolver.iterations() <= 1 ? 1 : 0;
+
+    trace.info() << "(" << nbok << "/" << nb << ") tests" << std::endl;
+    trace.endBlock();
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main(int argc, char** argv)
+{
+    trace.beginBlock("Testing class DiscreteExteriorCalculusSolver");
+    trace.info() << "Args:";
+    for (int i = 0; i < argc; ++i)
+        trace.info() << " " << argv[i];
+    trace.info() << endl;
+
+    // 2d disk with a hole
+    const Z2i::Domain domain(Z2i::Point(-20, -20), Z2i::Point(20, 20));
+    Z2i::DigitalSet set(domain);
+    for (Z2i::Domain::ConstIterator pi=domain.begin(), pie=domain.end(); pi!=pie; pi++)
+    {
+        const Z2i::Point& point = *pi;
+        const int norm = point.dot(point);
+        if (norm <= 380 && norm > 8) set.insertNew(point);
+    }
+    const Calculus calculus = CalculusFactory::createFromDigitalSet(set);
+
+    const bool res = testFactorizationReuse<EigenLinearAlgebraBackend::SolverSimplicialLLT>(calculus)
+        && testFactorizationReuse<EigenLinearAlgebraBackend::SolverSparseLU>(calculus)
+        && testFactorizationReuse<EigenLinearAlgebraBackend::SolverConjugateGradient>(calculus)
+        && testFactorizationReuse< GeometricMultigridSolver<Calculus> >(calculus)
+        && testWarmStart<EigenLinearAlgebraBackend::SolverConjugateGradient>(calculus)
+        && testWarmStart< GeometricMultigridSolver<Calculus> >(calculus);
+    trace.emphase() << (res ? "Passed." : "Error.") << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
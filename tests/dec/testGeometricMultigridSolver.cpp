@@ -0,0 +1,169 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testGeometricMultigridSolver.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class GeometricMultigridSolver.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/DiscreteExteriorCalculusSolver.h"
+#include "DGtal/dec/GeometricMultigridSolver.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/**
+ * Solves a problem with the multigrid solver plugged in
+ * DiscreteExteriorCalculusSolver and compares the solution with the
+ * one of a direct solver.
+ */
+template <typename Calculus, Order order, Duality duality>
+bool
+testSolve(const LinearOperator<Calculus, order, duality, order, duality>& linear_operator, const typename Calculus::Index& max_iterations)
+{
+    typedef KForm<Calculus, order, duality> Form;
+    typedef GeometricMultigridSolver<Calculus> LinearAlgebraSolver;
+    typedef DiscreteExteriorCalculusSolver<Calculus, LinearAlgebraSolver, order, duality, order, duality> Solver;
+    typedef DiscreteExteriorCalculusSolver<Calculus, typename Calculus::LinearAlgebraBackend::SolverSimplicialLDLT, order, duality, order, duality> DirectSolver;
+
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+    trace.beginBlock("Testing multigrid solve");
+
+    const Calculus& calculus = *linear_operator.myCalculus;
+    const Form input(calculus, Calculus::DenseVector::Random(calculus.kFormLength(order, duality)));
+
+    DirectSolver direct_solver;
+    direct_solver.compute(linear_operator);
+    const Form expected = direct_solver.solve(input);
+
+    Solver solver;
+    solver.myLinearAlgebraSolver.setTolerance(1e-10).setCoarsestSize(50);
+    solver.compute(linear_operator);
+    const Form solution = solver.solve(input);
+    const double error = (solution.myContainer - expected.myContainer).template lpNorm<Eigen::Infinity>() / expected.myContainer.template lpNorm<Eigen::Infinity>();
+    trace.info() << solver.myLinearAlgebraSolver << " solution error=" << error << std::endl;
+
+    ++nb, nbok += solver.isValid() && solver.myLinearAlgebraSolver.info() == Eigen::Success ? 1 : 0;
+    ++nb, nbok += solver.myLinearAlgebraSolver.levels() > 1 ? 1 : 0;
+    ++nb, nbok += error < 1e-6 ? 1 : 0;
+    ++nb, nbok += solver.myLinearAlgebraSolver.iterations() <= max_iterations ? 1 : 0;
+
+    // unpreconditioned problems need more iterations
+    typename Calculus::LinearAlgebraBackend::SolverConjugateGradient cg_solver;
+    cg_solver.setTolerance(1e-10);
+    cg_solver.compute(linear_operator.myContainer);
+    const typename Calculus::DenseVector cg_solution = cg_solver.solve(input.myContainer);
+    trace.info() << "conjugate gradient iterations=" << cg_solver.iterations() << std::endl;
+    ++nb, nbok += solver.myLinearAlgebraSolver.iterations() < cg_solver.iterations() ? 1 : 0;
+
+    // a single v-cycle reduces the residual
+    const typename Calculus::DenseVector cycle_solution = solver.myLinearAlgebraSolver.cycle(input.myContainer);
+    const double cycle_residual = (input.myContainer - linear_operator.myContainer * cycle_solution).norm() / input.myContainer.norm();
+    trace.info() << "v-cycle residual=" << cycle_residual << std::endl;
+    ++nb, nbok += cycle_residual < .5 ? 1 : 0;
+
+    trace.info() << "(" << nbok << "/" << nb << ") tests" << std::endl;
+    trace.endBlock();
+    return nbok == nb;
+}
+
+/// Checks that the multigrid solver reports missing cells.
+template <typename Calculus>
+bool
+testMissingCells(const Calculus& calculus)
+{
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+    trace.beginBlock("Testing missing cells");
+
+    GeometricMultigridSolver<Calculus> solver;
+    solver.compute(calculus.template laplace<DUAL>().myContainer);
+    ++nb, nbok += solver.info() == Eigen::InvalidInput && !solver.isValid() ? 1 : 0;
+
+    solver.setCells(calculus.template getIndexedSCells<0, DUAL>(), calculus.myKSpace);
+    solver.compute(calculus.template laplace<DUAL>().myContainer);
+    ++nb, nbok += solver.info() == Eigen::Success && solver.isValid() ? 1 : 0;
+
+    trace.info() << "(" << nbok << "/" << nb << ") tests" << std::endl;
+    trace.endBlock();
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main(int argc, char** argv)
+{
+    trace.beginBlock("Testing class GeometricMultigridSolver");
+    trace.info() << "Args:";
+    for (int i = 0; i < argc; ++i)
+        trace.info() << " " << argv[i];
+    trace.info() << endl;
+
+    typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+    typedef DiscreteExteriorCalculus<2, 2, EigenLinearAlgebraBackend> Calculus2D;
+    typedef DiscreteExteriorCalculus<3, 3, EigenLinearAlgebraBackend> Calculus3D;
+
+    // 2d disk with a hole
+    const Z2i::Domain domain_2d(Z2i::Point(-20, -20), Z2i::Point(20, 20));
+    Z2i::DigitalSet set_2d(domain_2d);
+    for (Z2i::Domain::ConstIterator pi=domain_2d.begin(), pie=domain_2d.end(); pi!=pie; pi++)
+    {
+        const Z2i::Point& point = *pi;
+        const int norm = point.dot(point);
+        if (norm <= 380 && norm > 20) set_2d.insertNew(point);
+    }
+    const Calculus2D calculus_2d = CalculusFactory::createFromDigitalSet(set_2d);
+
+    // 3d box
+    const Z3i::Domain domain_3d(Z3i::Point(0, 0, 0), Z3i::Point(15, 15, 15));
+    Z3i::DigitalSet set_3d(domain_3d);
+    set_3d.assignFromComplement(Z3i::DigitalSet(domain_3d));
+    const Calculus3D calculus_3d = CalculusFactory::createFromDigitalSet(set_3d);
+
+    // primal helmholtz operator, definite with the same sign as the laplace,
+    // and symmetric with unit sizes
+    Calculus2D unit_calculus_2d = calculus_2d;
+    unit_calculus_2d.resetSizes();
+    const Calculus2D::PrimalIdentity0 primal_laplace = unit_calculus_2d.laplace<PRIMAL>();
+    const double sign = ( primal_laplace.myContainer.coeff(0, 0) > 0 ? 1 : -1 );
+    const Calculus2D::PrimalIdentity0 primal_helmholtz = primal_laplace + sign * .01 * unit_calculus_2d.identity<0, PRIMAL>();
+
+    const bool res = testMissingCells(calculus_2d)
+        && testSolve(calculus_2d.laplace<DUAL>(), 20)
+        && testSolve(primal_helmholtz, 20)
+        && testSolve(calculus_3d.laplace<DUAL>(), 20);
+    trace.emphase() << (res ? "Passed." : "Error.") << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
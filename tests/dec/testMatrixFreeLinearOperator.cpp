@@ -0,0 +1,209 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMatrixFreeLinearOperator.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MatrixFreeLinearOperator against the
+ * assembled operators of DiscreteExteriorCalculus.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include "DGtal/math/linalg/EigenSupport.h"
+#include "DGtal/dec/DiscreteExteriorCalculus.h"
+#include "DGtal/dec/DiscreteExteriorCalculusFactory.h"
+#include "DGtal/dec/MatrixFreeLinearOperator.h"
+#include "DGtal/dec/EigenMatrixFreeOperator.h"
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/**
+ * Compares the application of an assembled operator and of a matrix
+ * free operator on a random form.
+ */
+template <typename Calculus, Order order_in, Duality duality_in, Order order_out, Duality duality_out>
+bool
+sameApplication(const LinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& assembled,
+                const MatrixFreeLinearOperator<Calculus, order_in, duality_in, order_out, duality_out>& matrix_free)
+{
+    typedef KForm<Calculus, order_in, duality_in> InputKForm;
+    const Calculus& calculus = *assembled.myCalculus;
+    const InputKForm input(calculus, Calculus::DenseVector::Random(calculus.kFormLength(order_in, duality_in)));
+    const typename Calculus::DenseVector difference = (assembled * input).myContainer - (matrix_free * input).myContainer;
+    const bool same = matrix_free.isValid() && matrix_free.rows() == assembled.myContainer.rows()
+        && matrix_free.cols() == assembled.myContainer.cols()
+        && ( difference.size() == 0 || difference.template lpNorm<Eigen::Infinity>() < 1e-10 );
+    if (!same) trace.warning() << "different operators " << matrix_free << std::endl;
+    return same;
+}
+
+/// Compares the operators of all orders from 'order' to the embedded dimension.
+template <typename Calculus, Order order, bool is_last = ( order == Calculus::dimensionEmbedded )>
+struct OperatorsTester
+{
+    static
+    void
+    test(const Calculus& calculus, unsigned int& nbok, unsigned int& nb)
+    {
+        ++nb, nbok += sameApplication(calculus.template hodge<order, PRIMAL>(), calculus.template matrixFreeHodge<order, PRIMAL>()) ? 1 : 0;
+        ++nb, nbok += sameApplication(calculus.template hodge<order, DUAL>(), calculus.template matrixFreeHodge<order, DUAL>()) ? 1 : 0;
+        ++nb, nbok += sameApplication(calculus.template derivative<order, PRIMAL>(), calculus.template matrixFreeDerivative<order, PRIMAL>()) ? 1 : 0;
+        ++nb, nbok += sameApplication(calculus.template derivative<order, DUAL>(), calculus.template matrixFreeDerivative<order, DUAL>()) ? 1 : 0;
+        ++nb, nbok += sameApplication(calculus.template antiderivative<order+1, PRIMAL>(), calculus.template matrixFreeAntiderivative<order+1, PRIMAL>()) ? 1 : 0;
+        ++nb, nbok += sameApplication(calculus.template antiderivative<order+1, DUAL>(), calculus.template matrixFreeAntiderivative<order+1, DUAL>()) ? 1 : 0;
+        OperatorsTester<Calculus, order+1>::test(calculus, nbok, nb);
+    }
+};
+
+template <typename Calculus, Order order>
+struct OperatorsTester<Calculus, order, true>
+{
+    static
+    void
+    test(const Calculus& calculus, unsigned int& nbok, unsigned int& nb)
+    {
+        ++nb, nbok += sameApplication(calculus.template hodge<order, PRIMAL>(), calculus.template matrixFreeHodge<order, PRIMAL>()) ? 1 : 0;
+        ++nb, nbok += sameApplication(calculus.template hodge<order, DUAL>(), calculus.template matrixFreeHodge<order, DUAL>()) ? 1 : 0;
+    }
+};
+
+/**
+ * Compares all the matrix free operators of a calculus with the
+ * assembled ones, then solves a dual Poisson problem with the matrix
+ * free conjugate gradient and biconjugate gradient solvers when the
+ * calculus has a border, i.e. when the dual laplace is invertible.
+ */
+template <typename Calculus>
+bool
+testMatrixFreeOperators(const Calculus& calculus, const bool with_border)
+{
+    typedef typename Calculus::DualForm0 DualForm0;
+    typedef MatrixFreeLinearOperator<Calculus, 0, DUAL, 0, DUAL> MatrixFreeLaplace;
+    typedef EigenMatrixFreeOperator<MatrixFreeLaplace> EigenLaplace;
+
+    unsigned int nbok = 0;
+    unsigned int nb = 0;
+    trace.beginBlock("Testing matrix free operators");
+    trace.info() << calculus << std::endl;
+
+    OperatorsTester<Calculus, 0>::test(calculus, nbok, nb);
+    ++nb, nbok += sameApplication(calculus.template laplace<PRIMAL>(), calculus.template matrixFreeLaplace<PRIMAL>()) ? 1 : 0;
+    ++nb, nbok += sameApplication(calculus.template laplace<DUAL>(), calculus.template matrixFreeLaplace<DUAL>()) ? 1 : 0;
+
+    // the laplace operator is a (2n+1)-point stencil
+    const MatrixFreeLaplace laplace = calculus.template matrixFreeLaplace<DUAL>();
+    trace.info() << laplace << std::endl;
+    ++nb, nbok += laplace.myStencils.size() == 1 && laplace.myStencils.front().myWidth == 2*Calculus::dimensionEmbedded+1 ? 1 : 0;
+
+    // composed and fused operators
+    const MatrixFreeLinearOperator<Calculus, 0, PRIMAL, 0, PRIMAL> composed_laplace =
+        calculus.template matrixFreeAntiderivative<1, PRIMAL>() * calculus.template matrixFreeDerivative<0, PRIMAL>();
+    ++nb, nbok += composed_laplace.myStencils.size() == 2 && sameApplication(calculus.template laplace<PRIMAL>(), composed_laplace) ? 1 : 0;
+    ++nb, nbok += sameApplication(-2 * calculus.template laplace<PRIMAL>(), (-2 * composed_laplace).fused()) ? 1 : 0;
+    ++nb, nbok += sameApplication(calculus.template derivative<1, DUAL>() * calculus.template derivative<0, DUAL>(),
+                                  (calculus.template matrixFreeDerivative<1, DUAL>() * calculus.template matrixFreeDerivative<0, DUAL>()).fused()) ? 1 : 0;
+    trace.info() << "(" << nbok << "/" << nb << ") operators" << std::endl;
+    if (!with_border)
+    {
+        trace.endBlock();
+        return nbok == nb;
+    }
+
+    // dual poisson problem
+    const DualForm0 input(calculus, Calculus::DenseVector::Random(calculus.kFormLength(0, DUAL)));
+    typename Calculus::LinearAlgebraBackend::SolverSimplicialLDLT direct_solver;
+    direct_solver.compute(calculus.template laplace<DUAL>().myContainer);
+    const DualForm0 expected(calculus, direct_solver.solve(input.myContainer));
+
+    const EigenLaplace eigen_laplace(laplace);
+    typename EigenLaplace::SolverConjugateGradient cg_solver;
+    cg_solver.setTolerance(1e-12);
+    cg_solver.compute(eigen_laplace);
+    const DualForm0 cg_solution(calculus, cg_solver.solve(input.myContainer));
+    const double cg_error = (cg_solution.myContainer - expected.myContainer).template lpNorm<Eigen::Infinity>();
+    trace.info() << "conjugate gradient: " << cg_solver.iterations() << " iterations, error=" << cg_error << std::endl;
+    ++nb, nbok += cg_solver.info() == Eigen::Success && cg_error < 1e-6 ? 1 : 0;
+
+    typename EigenLaplace::SolverBiCGSTAB bicgstab_solver;
+    bicgstab_solver.setTolerance(1e-12);
+    bicgstab_solver.compute(eigen_laplace);
+    const DualForm0 bicgstab_solution(calculus, bicgstab_solver.solve(input.myContainer));
+    const double bicgstab_error = (bicgstab_solution.myContainer - expected.myContainer).template lpNorm<Eigen::Infinity>();
+    trace.info() << "biconjugate gradient: " << bicgstab_solver.iterations() << " iterations, error=" << bicgstab_error << std::endl;
+    ++nb, nbok += bicgstab_solver.info() == Eigen::Success && bicgstab_error < 1e-6 ? 1 : 0;
+
+    trace.info() << "(" << nbok << "/" << nb << ") tests" << std::endl;
+    trace.endBlock();
+    return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main(int argc, char** argv)
+{
+    trace.beginBlock("Testing class MatrixFreeLinearOperator");
+    trace.info() << "Args:";
+    for (int i = 0; i < argc; ++i)
+        trace.info() << " " << argv[i];
+    trace.info() << endl;
+
+    typedef DiscreteExteriorCalculusFactory<EigenLinearAlgebraBackend> CalculusFactory;
+
+    // 2d disk with a hole
+    const Z2i::Domain domain_2d(Z2i::Point(-12, -12), Z2i::Point(12, 12));
+    Z2i::DigitalSet set_2d(domain_2d);
+    for (Z2i::Domain::ConstIterator pi=domain_2d.begin(), pie=domain_2d.end(); pi!=pie; pi++)
+    {
+        const Z2i::Point& point = *pi;
+        const int norm = point.dot(point);
+        if (norm <= 120 && norm > 8) set_2d.insertNew(point);
+    }
+
+    // 3d box
+    const Z3i::Domain domain_3d(Z3i::Point(0, 0, 0), Z3i::Point(7, 6, 5));
+    Z3i::DigitalSet set_3d(domain_3d);
+    set_3d.assignFromComplement(Z3i::DigitalSet(domain_3d));
+
+    // 2d sheet embedded in 3d
+    Z3i::KSpace kspace_3d;
+    kspace_3d.init(domain_3d.lowerBound(), domain_3d.upperBound(), true);
+    std::vector<Z3i::SCell> sheet_3d;
+    for (int xx=1; xx<12; xx+=2)
+        for (int yy=1; yy<10; yy+=2)
+            sheet_3d.push_back(kspace_3d.sCell(Z3i::Point(xx, yy, 4), (xx+yy)%4 == 0 ? Z3i::KSpace::POS : Z3i::KSpace::NEG));
+
+    const bool res = testMatrixFreeOperators(CalculusFactory::createFromDigitalSet(set_2d), true)
+        && testMatrixFreeOperators(CalculusFactory::createFromDigitalSet(set_2d, false), false)
+        && testMatrixFreeOperators(CalculusFactory::createFromDigitalSet(set_3d), true)
+        && testMatrixFreeOperators(CalculusFactory::createFromNSCells<2>(sheet_3d.begin(), sheet_3d.end()), true);
+    trace.emphase() << (res ? "Passed." : "Error.") << endl;
+    trace.endBlock();
+    return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,98 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the greedy segmentation of noisy curves of up to 10^6
+ * points into alpha-thick segments (AlphaThickSegmentComputer).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/AlphaThickSegmentComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2, double> RealPoint;
+typedef std::vector<RealPoint> Range;
+typedef AlphaThickSegmentComputer<RealPoint, Range::const_iterator> SegmentComputer;
+typedef GreedySegmentation<SegmentComputer> Segmentation;
+
+/// Noisy curve of aSize points, sampled on a curve of radius about
+/// aSize / 40 with a uniform noise of amplitude 1.
+static Range makeNoisyCurve( unsigned int aSize )
+{
+  Range curve;
+  curve.reserve( aSize );
+  srand( 0 );
+  const double radius = aSize / 40.0;
+  for ( unsigned int k = 0; k < aSize; ++k )
+    {
+      const double t = 2.0 * M_PI * k / aSize;
+      const double r = radius * ( 1.0 + 0.3 * std::cos( 7 * t ) + 0.1 * std::sin( 23 * t ) );
+      curve.push_back( RealPoint( r * std::cos( t ) + rand() / ( double )RAND_MAX - 0.5,
+                                  r * std::sin( t ) + rand() / ( double )RAND_MAX - 0.5 ) );
+    }
+  return curve;
+}
+
+static void BM_GreedyAlphaThick(benchmark::State& state)
+{
+  const Range curve = makeNoisyCurve( state.range(0) );
+  const Segmentation segmentation( curve.begin(), curve.end(),
+                                   SegmentComputer( state.range(1) ) );
+  unsigned int nbSegments = 0;
+  while (state.KeepRunning())
+    {
+      nbSegments = 0;
+      for ( Segmentation::SegmentComputerIterator it = segmentation.begin(),
+              itEnd = segmentation.end(); it != itEnd; ++it )
+        ++nbSegments;
+      benchmark::DoNotOptimize( nbSegments );
+    }
+  state.counters["segments"] = nbSegments;
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*curve.size());
+}
+BENCHMARK(BM_GreedyAlphaThick)->ArgPair(100000,2)->ArgPair(1000000,2)->ArgPair(1000000,8)
+->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
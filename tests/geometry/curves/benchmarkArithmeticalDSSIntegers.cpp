@@ -0,0 +1,111 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the greedy recognition of DSSs with
+ * ArithmeticalDSSComputer, with DGtal::int64_t, DGtal::HybridInteger
+ * and DGtal::BigInteger as integer type, for small coordinates and for
+ * coordinates around 2^40.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/arithmetic/HybridInteger.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2, DGtal::int64_t> Point;
+typedef std::vector<Point>::const_iterator ConstIterator;
+
+/// 8-connected curve of aSize points made of long straight parts,
+/// starting at (anOrigin, anOrigin).
+static std::vector<Point> makeCurve( unsigned int aSize, DGtal::int64_t anOrigin )
+{
+  std::vector<Point> curve;
+  curve.reserve( aSize );
+  Point p( anOrigin, anOrigin );
+  srand( 0 );
+  unsigned int a = 1, b = 1;
+  for ( unsigned int i = 0; i < aSize; ++i )
+    {
+      if ( i % 200 == 0 )
+        {
+          a = rand() % 97;
+          b = 1 + rand() % 97;
+        }
+      curve.push_back( p );
+      // step of the naive line of slope a/b (first octant)
+      p[ 0 ] += 1;
+      if ( ( ( i + 1 ) * a ) / b != ( i * a ) / b && a <= b )
+        p[ 1 ] += 1;
+    }
+  return curve;
+}
+
+template <typename TInteger>
+static void BM_GreedyDSS(benchmark::State& state)
+{
+  typedef ArithmeticalDSSComputer<ConstIterator, TInteger, 8> DSSComputer;
+  const DGtal::int64_t origin = state.range(0) == 0 ? 0 : ( DGtal::int64_t( 1 ) << 40 );
+  const std::vector<Point> curve = makeCurve( 100000, origin );
+  unsigned int nbDSS = 0;
+  while (state.KeepRunning())
+    {
+      nbDSS = 0;
+      ConstIterator it = curve.begin();
+      while ( it != curve.end() )
+        {
+          DSSComputer dss;
+          dss.init( it );
+          while ( ( dss.end() != curve.end() ) && dss.extendFront() ) {}
+          it = dss.end();
+          ++nbDSS;
+        }
+      benchmark::DoNotOptimize( nbDSS );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*curve.size());
+}
+BENCHMARK_TEMPLATE(BM_GreedyDSS, DGtal::int64_t)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_GreedyDSS, DGtal::HybridInteger)->Arg(0)->Arg(1);
+BENCHMARK_TEMPLATE(BM_GreedyDSS, DGtal::BigInteger)->Arg(0)->Arg(1);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
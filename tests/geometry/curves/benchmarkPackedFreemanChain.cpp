@@ -0,0 +1,140 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the traversals of a FreemanChain and of a
+ * PackedFreemanChain (bounding box, contour points, loops), against
+ * the number of codes.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int> FC;
+typedef PackedFreemanChain<int> PFC;
+
+/// Closed counterclockwise staircase chain of about aSize codes.
+static FC makeChain( unsigned int aSize )
+{
+  const unsigned int n = aSize / 8;
+  std::string s;
+  s.reserve( 8 * n );
+  for ( unsigned int k = 0; k < n; ++k ) s += "01";
+  for ( unsigned int k = 0; k < n; ++k ) s += "12";
+  for ( unsigned int k = 0; k < n; ++k ) s += "23";
+  for ( unsigned int k = 0; k < n; ++k ) s += "30";
+  return FC( s, 0, 0 );
+}
+
+static void BM_BoundingBox(benchmark::State& state)
+{
+  const FC fc = makeChain( state.range(0) );
+  int min_x, min_y, max_x, max_y;
+  while (state.KeepRunning())
+    {
+      fc.computeBoundingBox( min_x, min_y, max_x, max_y );
+      benchmark::DoNotOptimize( min_x + min_y + max_x + max_y );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*fc.size());
+}
+BENCHMARK(BM_BoundingBox)->Arg(1000)->Arg(100000);
+
+static void BM_PackedBoundingBox(benchmark::State& state)
+{
+  const PFC pc( makeChain( state.range(0) ) );
+  int min_x, min_y, max_x, max_y;
+  while (state.KeepRunning())
+    {
+      pc.computeBoundingBox( min_x, min_y, max_x, max_y );
+      benchmark::DoNotOptimize( min_x + min_y + max_x + max_y );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*pc.size());
+}
+BENCHMARK(BM_PackedBoundingBox)->Arg(1000)->Arg(100000);
+
+static void BM_ContourPoints(benchmark::State& state)
+{
+  const FC fc = makeChain( state.range(0) );
+  std::vector<FC::Point> points;
+  while (state.KeepRunning())
+    {
+      FC::getContourPoints( fc, points );
+      benchmark::DoNotOptimize( points.data() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*fc.size());
+}
+BENCHMARK(BM_ContourPoints)->Arg(1000)->Arg(100000);
+
+static void BM_PackedContourPoints(benchmark::State& state)
+{
+  const PFC pc( makeChain( state.range(0) ) );
+  std::vector<PFC::Point> points;
+  while (state.KeepRunning())
+    {
+      pc.getContourPoints( points );
+      benchmark::DoNotOptimize( points.data() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*pc.size());
+}
+BENCHMARK(BM_PackedContourPoints)->Arg(1000)->Arg(100000);
+
+static void BM_CcwLoops(benchmark::State& state)
+{
+  const FC fc = makeChain( state.range(0) );
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( fc.ccwLoops() );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*fc.size());
+}
+BENCHMARK(BM_CcwLoops)->Arg(1000)->Arg(100000);
+
+static void BM_PackedCcwLoops(benchmark::State& state)
+{
+  const PFC pc( makeChain( state.range(0) ) );
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( pc.ccwLoops() );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*pc.size());
+}
+BENCHMARK(BM_PackedCcwLoops)->Arg(1000)->Arg(100000);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,146 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the sequential and parallel greedy and saturated
+ * segmentations of closed curves into DSSs, against the curve
+ * length. The first argument is the radius of the curve (the number
+ * of points is about 17 times the radius), the second argument of
+ * the parallel benchmarks is the number of OpenMP threads: the
+ * speedup is the ratio of the times per point.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <benchmark/benchmark.h>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2,int> Point;
+typedef std::vector<Point> Range;
+typedef Circulator<Range::const_iterator> ConstCirculator;
+typedef ArithmeticalDSSComputer<ConstCirculator,int,4> SegmentComputer;
+typedef GreedySegmentation<SegmentComputer> Greedy;
+typedef SaturatedSegmentation<SegmentComputer> Saturated;
+
+/// Closed 4-connected digital curve (see testParallelSegmentation.cpp).
+static Range makeCurve( double aRadius )
+{
+  Range curve;
+  const unsigned int nb = static_cast<unsigned int>( 40 * aRadius );
+  Point current;
+  for ( unsigned int k = 0; k <= nb; ++k )
+    {
+      const double t = 2.0 * M_PI * k / nb;
+      const double r = aRadius * ( 1.0 + 0.3 * std::cos( 7 * t ) + 0.1 * std::sin( 23 * t ) );
+      const Point target( static_cast<int>( std::floor( r * std::cos( t ) + 0.5 ) ),
+                          static_cast<int>( std::floor( r * std::sin( t ) + 0.5 ) ) );
+      if ( k == 0 ) { current = target; curve.push_back( current ); continue; }
+      while ( current != target )
+        {
+          if ( current[ 0 ] != target[ 0 ] ) current[ 0 ] += ( target[ 0 ] > current[ 0 ] ) ? 1 : -1;
+          else current[ 1 ] += ( target[ 1 ] > current[ 1 ] ) ? 1 : -1;
+          curve.push_back( current );
+        }
+    }
+  curve.pop_back();
+  return curve;
+}
+
+static void setThreads( int nbThreads )
+{
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#else
+  boost::ignore_unused_variable_warning( nbThreads );
+#endif
+}
+
+template <typename Segmentation>
+static void BM_Sequential(benchmark::State& state)
+{
+  const Range curve = makeCurve( state.range(0) );
+  const ConstCirculator c( curve.begin(), curve.begin(), curve.end() );
+  const Segmentation segmentation( c, c, SegmentComputer() );
+  while (state.KeepRunning())
+    {
+      std::vector<SegmentComputer> segments;
+      for ( typename Segmentation::SegmentComputerIterator it = segmentation.begin(),
+              itEnd = segmentation.end(); it != itEnd; ++it )
+        segments.push_back( *it );
+      benchmark::DoNotOptimize( segments.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*curve.size());
+}
+BENCHMARK_TEMPLATE(BM_Sequential, Greedy)->Arg(1000)->Arg(10000)->Arg(100000)
+->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_Sequential, Saturated)->Arg(1000)->Arg(10000)->Arg(100000)
+->Unit(benchmark::kMillisecond);
+
+template <typename Segmentation>
+static void BM_Parallel(benchmark::State& state)
+{
+  setThreads( state.range(1) );
+  const Range curve = makeCurve( state.range(0) );
+  const ConstCirculator c( curve.begin(), curve.begin(), curve.end() );
+  const Segmentation segmentation( c, c, SegmentComputer() );
+  while (state.KeepRunning())
+    {
+      std::vector<SegmentComputer> segments;
+      segmentation.getSegmentsParallel( segments );
+      benchmark::DoNotOptimize( segments.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*curve.size());
+}
+BENCHMARK_TEMPLATE(BM_Parallel, Greedy)->ArgPair(1000,1)->ArgPair(10000,1)->ArgPair(100000,1)
+->ArgPair(1000,4)->ArgPair(10000,4)->ArgPair(100000,4)
+->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_Parallel, Saturated)->ArgPair(1000,1)->ArgPair(10000,1)->ArgPair(100000,1)
+->ArgPair(1000,4)->ArgPair(10000,4)->ArgPair(100000,4)
+->Unit(benchmark::kMillisecond)->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
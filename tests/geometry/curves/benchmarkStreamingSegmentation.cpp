@@ -0,0 +1,181 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file benchmarkStreamingSegmentation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmarks the greedy and saturated segmentations of 3D curves
+ * read as streams, against the segmentations of stored curves.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/Naive3DDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/StreamingSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<3, int> Point;
+
+/**
+ * Single pass input iterator generating a 26-connected curve made of
+ * digital straight pieces, without storing it.
+ */
+class CurveStream : public std::iterator<std::input_iterator_tag, Point>
+{
+public:
+  CurveStream( unsigned int aSize = 0 )
+    : myRemaining( aSize ), myPoint( 0, 0, 0 ), mySeed( 1 ), myI( 0 ), myLength( 0 )
+  {}
+  const Point & operator*() const { return myPoint; }
+  CurveStream & operator++()
+  {
+    --myRemaining;
+    if ( myI == myLength ) newPiece();
+    ++myI;
+    myPoint += ( ( myI * myR ) / myQ > ( ( myI - 1 ) * myR ) / myQ ) ? myS2 : myS1;
+    return *this;
+  }
+  bool operator==( const CurveStream & other ) const { return myRemaining == other.myRemaining; }
+  bool operator!=( const CurveStream & other ) const { return myRemaining != other.myRemaining; }
+
+private:
+  unsigned int random() { mySeed = mySeed * 1103515245u + 12345u; return ( mySeed >> 16 ) & 0x7fff; }
+  Point randomStep()
+  {
+    Point s( 0, 0, 0 );
+    while ( s == Point( 0, 0, 0 ) )
+      s = Point( (int)( random() % 2 ), (int)( random() % 2 ), (int)( random() % 2 ) );
+    return s;
+  }
+  void newPiece()
+  {
+    myS1 = randomStep();
+    myS2 = randomStep();
+    myQ = 1 + random() % 7;
+    myR = random() % ( myQ + 1 );
+    myI = 0;
+    myLength = 20 + random() % 200;
+  }
+
+  unsigned int myRemaining;
+  Point myPoint, myS1, myS2;
+  unsigned int mySeed, myQ, myR, myI, myLength;
+};
+
+/// Counts the segments.
+template <typename SegmentComputer>
+struct SegmentCounter
+{
+  SegmentCounter() : nb( 0 ) {}
+  void operator()( const SegmentComputer& ) { ++nb; }
+  unsigned int nb;
+};
+
+typedef Naive3DDSSComputer<std::vector<Point>::const_iterator, DGtal::int64_t, 8> StoredComputer;
+typedef Naive3DDSSComputer<StreamWindow<Point>::ConstIterator, DGtal::int64_t, 8> StreamComputer;
+
+/// Greedy segmentation of a stored curve (the curve is stored once).
+static void BM_GreedyStored(benchmark::State& state)
+{
+  const std::vector<Point> curve( CurveStream( state.range(0) ), CurveStream() );
+  while (state.KeepRunning())
+    {
+      GreedySegmentation<StoredComputer> s( curve.begin(), curve.end(), StoredComputer() );
+      unsigned int nb = 0;
+      for ( GreedySegmentation<StoredComputer>::SegmentComputerIterator
+              it = s.begin(), itEnd = s.end(); it != itEnd; ++it )
+        ++nb;
+      benchmark::DoNotOptimize( nb );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*state.range(0));
+}
+BENCHMARK(BM_GreedyStored)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+/// Greedy segmentation of a generated stream of points.
+static void BM_GreedyStreaming(benchmark::State& state)
+{
+  StreamingSegmentation<StreamComputer> s;
+  while (state.KeepRunning())
+    {
+      SegmentCounter<StreamComputer> counter;
+      s.greedySegmentation( CurveStream( state.range(0) ), CurveStream(), counter );
+      benchmark::DoNotOptimize( counter.nb );
+    }
+  state.counters["window"] = s.maxWindowSize();
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*state.range(0));
+}
+BENCHMARK(BM_GreedyStreaming)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+/// Saturated segmentation of a stored curve (the curve is stored once).
+static void BM_SaturatedStored(benchmark::State& state)
+{
+  const std::vector<Point> curve( CurveStream( state.range(0) ), CurveStream() );
+  while (state.KeepRunning())
+    {
+      SaturatedSegmentation<StoredComputer> s( curve.begin(), curve.end(), StoredComputer() );
+      unsigned int nb = 0;
+      for ( SaturatedSegmentation<StoredComputer>::SegmentComputerIterator
+              it = s.begin(), itEnd = s.end(); it != itEnd; ++it )
+        ++nb;
+      benchmark::DoNotOptimize( nb );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*state.range(0));
+}
+BENCHMARK(BM_SaturatedStored)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+/// Saturated segmentation of a generated stream of points.
+static void BM_SaturatedStreaming(benchmark::State& state)
+{
+  StreamingSegmentation<StreamComputer> s;
+  while (state.KeepRunning())
+    {
+      SegmentCounter<StreamComputer> counter;
+      s.saturatedSegmentation( CurveStream( state.range(0) ), CurveStream(), counter );
+      benchmark::DoNotOptimize( counter.nb );
+    }
+  state.counters["window"] = s.maxWindowSize();
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*state.range(0));
+}
+BENCHMARK(BM_SaturatedStreaming)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
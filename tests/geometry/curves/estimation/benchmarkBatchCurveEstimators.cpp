@@ -0,0 +1,177 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the tangent and curvature estimations on many small
+ * contours: one FreemanChain and one estimator per contour, against
+ * a FreemanChainCollection processed by BatchCurveEstimators. The
+ * argument is the number of contours, the second argument of the
+ * batch benchmarks is the number of OpenMP threads.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <benchmark/benchmark.h>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/FreemanChainCollection.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/BinomialConvolver.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+#include "DGtal/geometry/curves/estimation/BatchCurveEstimators.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int> FC;
+typedef FreemanChainCollection<int> Collection;
+typedef BatchCurveEstimators<int> Batch;
+typedef Batch::RealVector RealVector;
+typedef FC::Point Point;
+typedef std::vector<Point>::const_iterator ConstIterator;
+typedef Circulator<ConstIterator> ConstCirculator;
+typedef ArithmeticalDSSComputer<ConstCirculator,int,4> DSSComputer;
+typedef TangentFromDSSEstimator<DSSComputer> SCEstimator;
+typedef MostCenteredMaximalSegmentEstimator<DSSComputer,SCEstimator> TangentEstimator;
+typedef BinomialConvolver<ConstIterator, double> Convolver;
+typedef CurvatureFromBinomialConvolverFunctor<Convolver, double> CurvatureFunctor;
+typedef BinomialConvolverEstimator<Convolver, CurvatureFunctor> CurvatureEstimator;
+
+/// Closed chains of 20 to 90 codes (see testBatchCurveEstimators.cpp).
+static std::vector<FC> makeChains( unsigned int aNb )
+{
+  std::vector<FC> chains;
+  for ( unsigned int i = 0; i < aNb; ++i )
+    {
+      const double radius = 3 + i % 8;
+      const unsigned int nb = static_cast<unsigned int>( 40 * radius );
+      std::string codes;
+      Point current, first;
+      for ( unsigned int k = 0; k <= nb; ++k )
+        {
+          const double t = 2.0 * M_PI * k / nb;
+          const double r = radius * ( 1.0 + 0.1 * std::cos( 5 * t ) );
+          const Point target( static_cast<int>( std::floor( r * std::cos( t ) + 0.5 ) ),
+                              static_cast<int>( std::floor( r * std::sin( t ) + 0.5 ) ) );
+          if ( k == 0 ) { current = first = target; continue; }
+          while ( current != target )
+            {
+              char code;
+              if ( current[ 0 ] != target[ 0 ] ) code = ( target[ 0 ] > current[ 0 ] ) ? '0' : '2';
+              else code = ( target[ 1 ] > current[ 1 ] ) ? '1' : '3';
+              current += FC::displacement( code );
+              // back and forth moves are removed
+              if ( ! codes.empty() && ( ( codes[ codes.size() - 1 ] - '0' + 2 ) % 4 == code - '0' ) )
+                codes.erase( codes.size() - 1 );
+              else
+                codes += code;
+            }
+        }
+      while ( codes.size() > 2 && ( ( codes[ 0 ] - '0' + 2 ) % 4 == codes[ codes.size() - 1 ] - '0' ) )
+        {
+          first += FC::displacement( codes[ 0 ] );
+          codes = codes.substr( 1, codes.size() - 2 );
+        }
+      chains.push_back( FC( codes, first[ 0 ] + 50 * i, first[ 1 ] ) );
+    }
+  return chains;
+}
+
+static void setThreads( int nbThreads )
+{
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#else
+  boost::ignore_unused_variable_warning( nbThreads );
+#endif
+}
+
+static void BM_PerContour(benchmark::State& state)
+{
+  const std::vector<FC> chains = makeChains( state.range(0) );
+  std::size_t nbCodes = 0;
+  for ( unsigned int i = 0; i < chains.size(); ++i ) nbCodes += chains[ i ].size();
+  while (state.KeepRunning())
+    {
+      std::vector<RealVector> tangents;
+      std::vector<double> curvatures;
+      for ( unsigned int i = 0; i < chains.size(); ++i )
+        {
+          std::vector<Point> points;
+          FC::getContourPoints( chains[ i ], points );
+          points.pop_back();
+          const ConstCirculator c( points.begin(), points.begin(), points.end() );
+          const DSSComputer dss;
+          const SCEstimator sce;
+          TangentEstimator tangentEstimator( dss, sce );
+          tangentEstimator.init( 1.0, c, c );
+          tangentEstimator.eval( c, c, std::back_inserter( tangents ) );
+          CurvatureEstimator curvatureEstimator;
+          curvatureEstimator.init( 0.1, points.begin(), points.end(), true );
+          curvatureEstimator.eval( points.begin(), points.end(), std::back_inserter( curvatures ) );
+        }
+      benchmark::DoNotOptimize( tangents.size() + curvatures.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*nbCodes);
+}
+BENCHMARK(BM_PerContour)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+static void BM_Batch(benchmark::State& state)
+{
+  setThreads( state.range(1) );
+  const std::vector<FC> chains = makeChains( state.range(0) );
+  Collection contours;
+  for ( unsigned int i = 0; i < chains.size(); ++i ) contours.push_back( chains[ i ] );
+  std::vector<RealVector> tangents;
+  std::vector<double> curvatures;
+  while (state.KeepRunning())
+    {
+      Batch::tangents( contours, tangents );
+      Batch::curvatures( contours, curvatures, 0.1 );
+      benchmark::DoNotOptimize( tangents.size() + curvatures.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*contours.nbCodes());
+}
+BENCHMARK(BM_Batch)->ArgPair(1000,1)->ArgPair(10000,1)->ArgPair(1000,4)->ArgPair(10000,4)
+->Unit(benchmark::kMillisecond)->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,220 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testBatchCurveEstimators.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class BatchCurveEstimators against the
+ * estimators applied to each contour.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/FreemanChainCollection.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/BinomialConvolver.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/estimation/MostCenteredMaximalSegmentEstimator.h"
+#include "DGtal/geometry/curves/estimation/SegmentComputerEstimators.h"
+#include "DGtal/geometry/curves/estimation/DSSLengthEstimator.h"
+#include "DGtal/geometry/curves/estimation/LambdaMST2D.h"
+#include "DGtal/geometry/curves/estimation/BatchCurveEstimators.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChainCollection<int> Collection;
+typedef Collection::Point Point;
+typedef BatchCurveEstimators<int> Batch;
+typedef Batch::RealVector RealVector;
+
+/**
+ * Closed 4-connected contour following the polar curve
+ * r = R ( 1 + a cos( 5 t ) ) around some center, as a Freeman code.
+ */
+void addContour( Collection & aContours, int x0, int y0, double aRadius, double a )
+{
+  std::vector<Point> points;
+  const unsigned int nb = static_cast<unsigned int>( 40 * aRadius ) + 8;
+  Point current;
+  for ( unsigned int k = 0; k <= nb; ++k )
+    {
+      const double t = 2.0 * M_PI * k / nb;
+      const double r = aRadius * ( 1.0 + a * std::cos( 5 * t ) );
+      const Point target( x0 + static_cast<int>( std::floor( r * std::cos( t ) + 0.5 ) ),
+                          y0 + static_cast<int>( std::floor( r * std::sin( t ) + 0.5 ) ) );
+      if ( k == 0 ) { current = target; points.push_back( current ); continue; }
+      while ( current != target )
+        {
+          if ( current[ 0 ] != target[ 0 ] ) current[ 0 ] += ( target[ 0 ] > current[ 0 ] ) ? 1 : -1;
+          else current[ 1 ] += ( target[ 1 ] > current[ 1 ] ) ? 1 : -1;
+          points.push_back( current );
+        }
+    }
+  // codes, with back and forth moves removed so that the contour is simple
+  std::string codes;
+  for ( unsigned int k = 0; k + 1 < points.size(); ++k )
+    {
+      const Point d = points[ k + 1 ] - points[ k ];
+      const char code = ( d[ 0 ] == 1 ) ? '0' : ( d[ 1 ] == 1 ) ? '1' : ( d[ 0 ] == -1 ) ? '2' : '3';
+      if ( ! codes.empty() && ( ( codes[ codes.size() - 1 ] - '0' + 2 ) % 4 == code - '0' ) )
+        codes.erase( codes.size() - 1 );
+      else
+        codes += code;
+    }
+  Point first = points[ 0 ];
+  while ( codes.size() > 2 && ( ( codes[ 0 ] - '0' + 2 ) % 4 == codes[ codes.size() - 1 ] - '0' ) )
+    {
+      first += FreemanChain<int>::displacement( codes[ 0 ] );
+      codes = codes.substr( 1, codes.size() - 2 );
+    }
+  aContours.push_back( first[ 0 ], first[ 1 ], codes );
+}
+
+/// Distinct points of a closed chain.
+void contourPoints( const FreemanChain<int> & aChain, std::vector<Point> & aPoints )
+{
+  FreemanChain<int>::getContourPoints( aChain, aPoints );
+  aPoints.pop_back();
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchCurveEstimators.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the batch estimations with the estimations on each
+ * contour.
+ */
+bool testBatchCurveEstimators( const Collection & aContours )
+{
+  typedef std::vector<Point>::const_iterator ConstIterator;
+  typedef Circulator<ConstIterator> ConstCirculator;
+  typedef ArithmeticalDSSComputer<ConstCirculator,int,4> DSSComputer;
+  typedef TangentFromDSSEstimator<DSSComputer> SCEstimator;
+  typedef MostCenteredMaximalSegmentEstimator<DSSComputer,SCEstimator> TangentEstimator;
+  typedef SaturatedSegmentation<DSSComputer> Segmentation;
+  typedef LambdaMST2D<Segmentation> LambdaMSTEstimator;
+  typedef BinomialConvolver<ConstIterator, double> Convolver;
+  typedef CurvatureFromBinomialConvolverFunctor<Convolver, double> CurvatureFunctor;
+  typedef BinomialConvolverEstimator<Convolver, CurvatureFunctor> CurvatureEstimator;
+  const double h = 0.1;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: batch estimators against per-contour estimators." );
+
+  std::vector<RealVector> tangents, lambdaTangents;
+  std::vector<double> curvatures, curvatures3, lengths;
+  Batch::tangents( aContours, tangents );
+  Batch::lambdaMSTTangents( aContours, lambdaTangents );
+  Batch::curvatures( aContours, curvatures, h );
+  Batch::curvatures( aContours, curvatures3, h, 3 );
+  Batch::lengths( aContours, lengths, h );
+  nbok += ( tangents.size() == aContours.nbCodes() ) && ( lambdaTangents.size() == aContours.nbCodes() )
+    && ( curvatures.size() == aContours.nbCodes() ) && ( lengths.size() == aContours.size() ) ? 1 : 0;
+  ++nb;
+
+  std::vector<Point> points;
+  for ( unsigned int i = 0; i < aContours.size(); ++i )
+    {
+      contourPoints( aContours.chain( i ), points );
+      const ConstCirculator c( points.begin(), points.begin(), points.end() );
+      const std::size_t o = aContours.offset( i );
+
+      std::vector<RealVector> expectedTangents;
+      const DSSComputer dss;
+      const SCEstimator sce;
+      TangentEstimator tangentEstimator( dss, sce );
+      tangentEstimator.init( 1.0, c, c );
+      tangentEstimator.eval( c, c, std::back_inserter( expectedTangents ) );
+
+      // pointwise evaluation, valid on circulators
+      std::vector<RealVector> expectedLambdaTangents;
+      Segmentation segmentation( c, c, dss );
+      LambdaMSTEstimator lambdaEstimator;
+      lambdaEstimator.attach( segmentation );
+      lambdaEstimator.init( c, c );
+      ConstCirculator it = c;
+      do
+        expectedLambdaTangents.push_back( lambdaEstimator.eval( it ) );
+      while ( ++it != c );
+
+      std::vector<double> expectedCurvatures, expectedCurvatures3;
+      CurvatureEstimator curvatureEstimator;
+      curvatureEstimator.init( h, points.begin(), points.end(), true );
+      curvatureEstimator.eval( points.begin(), points.end(), std::back_inserter( expectedCurvatures ) );
+      CurvatureEstimator curvatureEstimator3( 3 );
+      curvatureEstimator3.init( h, points.begin(), points.end(), true );
+      curvatureEstimator3.eval( points.begin(), points.end(), std::back_inserter( expectedCurvatures3 ) );
+
+      DSSLengthEstimator<ConstCirculator> lengthEstimator;
+      lengthEstimator.init( h, c, c );
+
+      bool ok = ( expectedTangents.size() == points.size() )
+        && ( std::abs( lengths[ i ] - lengthEstimator.eval() ) < 1e-9 );
+      for ( unsigned int k = 0; k < points.size(); ++k )
+        {
+          ok = ok && ( ( tangents[ o + k ] - expectedTangents[ k ] ).norm() < 1e-12 );
+          ok = ok && ( std::abs( curvatures[ o + k ] - expectedCurvatures[ k ] ) < 1e-9 );
+          ok = ok && ( std::abs( curvatures3[ o + k ] - expectedCurvatures3[ k ] ) < 1e-9 );
+          ok = ok && ( ( lambdaTangents[ o + k ] - expectedLambdaTangents[ k ] ).norm() < 1e-9 );
+        }
+      nbok += ok ? 1 : 0; ++nb;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BatchCurveEstimators" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  Collection contours;
+  contours.push_back( 0, 0, "0123" );          // one pixel
+  contours.push_back( 5, 5, "00112233" );      // 2x2 square
+  srand( 3 );
+  for ( unsigned int i = 0; i < 200; ++i )
+    addContour( contours, rand() % 1000, rand() % 1000, 3.0 + rand() % 30, 0.05 * ( rand() % 5 ) );
+  trace.info() << contours << std::endl;
+
+  bool res = testBatchCurveEstimators( contours );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
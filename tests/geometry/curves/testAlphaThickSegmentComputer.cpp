@@ -533,6 +533,64 @@ testThicknessDefinitions(){
 
 
 
+/**
+ * Test the incremental extension against the thickness of the convex
+ * hull recomputed from scratch for each new point.
+ **/
+bool
+testIncrementalExtension(){
+  typedef  AlphaThickSegmentComputer<Z2i::Point> AlphaThickSegmentComputer2D;
+  typedef InHalfPlaneBySimple3x3Matrix<Z2i::Point, Z2i::Integer> Functor;
+  unsigned nb=0;
+  unsigned nbok =0;
+  trace.beginBlock ( "Testing incremental extension against hull recomputation:" );
+
+  srand(0);
+  std::vector<Z2i::Point> aContour;
+  for (int i = 0; i < 2000; i++){
+    aContour.push_back(Z2i::Point(i/2+rand()%4, i/3+rand()%4));
+  }
+  for (int i = 0; i < 2000; i++){
+    aContour.push_back(Z2i::Point(1000+i/4+rand()%9, 666-i/5+rand()%9));
+  }
+  functions::Hull2D::ThicknessDefinition definitions[2] = {functions::Hull2D::EuclideanThickness,
+                                                           functions::Hull2D::HorizontalVerticalThickness};
+  for (unsigned int d = 0; d < 2; d++){
+    std::vector<Z2i::Point>::const_iterator it = aContour.begin();
+    while (it != aContour.end()){
+      AlphaThickSegmentComputer2D segment(5.0, definitions[d]);
+      MelkmanConvexHull<Z2i::Point, Functor> hull;
+      bool ok = true;
+      for (; it != aContour.end(); ++it){
+        MelkmanConvexHull<Z2i::Point, Functor> newHull(hull);
+        newHull.add(*it);
+        double th = functions::Hull2D::computeHullThickness(newHull.begin(), newHull.end(), definitions[d]);
+        th = floor(th / 1e-6 + 0.5) * 1e-6;
+        bool expected = th <= 5.0;
+        ok = ok && (segment.isExtendableFront(*it) == expected);
+        ok = ok && (segment.extendFront(*it) == expected);
+        if (!expected){
+          break;
+        }
+        hull = newHull;
+        ok = ok && (segment.getThickness() == th) && (segment.getConvexHull().size() == hull.size());
+        ok = ok && (segment.size() == segment.getConvexHull().size());
+        // the antipodal pair may differ from the one of computeHullThickness for equidistant vertices.
+        std::pair<std::pair<Z2i::Point, Z2i::Point>, Z2i::Point> pair = segment.getAntipodalLeaningPoints();
+        double pairTh = functions::Hull2D::getThicknessAntipodalPair(pair.first.first, pair.first.second,
+                                                                     pair.second, definitions[d]);
+        ok = ok && (hull.size() < 3 || floor(pairTh / 1e-6 + 0.5) * 1e-6 == th);
+      }
+      nbok += ok ? 1 : 0;
+      nb++;
+    }
+  }
+  trace.info() << nb << " segments (" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nb==nbok;
+}
+
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -545,7 +603,8 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res =  testAlphaThickSegmentConvexHullAndBox() && testAlphaThickSegmentComputerFloatingPointContour() &&
-    testAlphaThickSegmentFreeman() && testAlphaThickSpecialInit() && testMultiWidth() && testThicknessDefinitions();
+    testAlphaThickSegmentFreeman() && testAlphaThickSpecialInit() && testMultiWidth() && testThicknessDefinitions() &&
+    testIncrementalExtension();
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
 
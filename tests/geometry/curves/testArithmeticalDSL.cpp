@@ -33,6 +33,7 @@
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/CPointPredicate.h"
 #include "DGtal/geometry/curves/ArithmeticalDSL.h"
+#include "DGtal/arithmetic/HybridInteger.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -375,6 +376,7 @@ int main( int argc, char** argv )
   bool res = mainTest<DGtal::ArithmeticalDSL<DGtal::int32_t> >()
 #ifdef WITH_BIGINTEGER
     && mainTest<DGtal::ArithmeticalDSL<DGtal::int32_t, DGtal::BigInteger, 4> >()
+    && mainTest<DGtal::ArithmeticalDSL<DGtal::int32_t, DGtal::HybridInteger, 4> >()
 #endif
     && mainTest<DGtal::NaiveDSL<DGtal::int32_t> >()
     && mainTest<DGtal::StandardDSL<DGtal::int32_t> >()
@@ -465,6 +467,11 @@ int main( int argc, char** argv )
     res = res && rangeTest( DSL(5, 8, -26) ) && rangeTest( DSL(5, 8, 13) )
       && rangeTest( DSL(5, 8, -17) ) && rangeTest( DSL(5, 8, 11313) ); 
   }
+  {
+    typedef DGtal::ArithmeticalDSL<DGtal::int32_t, DGtal::HybridInteger, 4> DSL;
+    res = res && rangeTest( DSL(5, 8, -26) ) && rangeTest( DSL(5, 8, 13) )
+      && rangeTest( DSL(5, 8, -17) ) && rangeTest( DSL(5, 8, 11313) );
+  }
   // Warning: BOOST_CONCEPT_ASSERT(( boost_concepts::RandomAccessTraversalConcept<I> )); 
   // does not accept DGtal::BigInteger as a difference type for random access iterators
   // because it uses methods is_signed and is_integer of std::numeric_limits
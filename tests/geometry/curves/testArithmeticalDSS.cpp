@@ -35,6 +35,7 @@
 #include "DGtal/geometry/curves/ArithmeticalDSS.h"
 #include "DGtal/geometry/curves/ArithmeticalDSSFactory.h"
 #include "DGtal/geometry/curves/StabbingLineComputer.h"
+#include "DGtal/arithmetic/HybridInteger.h"
 ///////////////////////////////////////////////////////////////////////////////
 
 using namespace std;
@@ -1368,6 +1369,7 @@ int main( int argc, char** argv )
   bool res = mainTest<DGtal::ArithmeticalDSS<DGtal::int32_t> >()
 #ifdef WITH_BIGINTEGER
     && mainTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::BigInteger, 4> >()
+    && mainTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::HybridInteger, 4> >()
 #endif
     && mainTest<DGtal::NaiveDSS8<DGtal::int32_t> >()
     && mainTest<DGtal::StandardDSS4<DGtal::int32_t> >()
@@ -1453,6 +1455,7 @@ int main( int argc, char** argv )
     && updateTest<DGtal::ArithmeticalDSS<DGtal::int32_t> >()
 #ifdef WITH_BIGINTEGER
     && updateTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::BigInteger, 4> >()
+    && updateTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::HybridInteger, 4> >()
 #endif
     ;
 
@@ -1460,6 +1463,7 @@ int main( int argc, char** argv )
     && constructorsTest<DGtal::ArithmeticalDSS<DGtal::int32_t> >()
 #ifdef WITH_BIGINTEGER
     && constructorsTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::BigInteger, 4> >()
+    && constructorsTest<DGtal::ArithmeticalDSS<DGtal::int32_t, DGtal::HybridInteger, 4> >()
 #endif
     && constructorsTest<DGtal::NaiveDSS8<DGtal::int32_t> >()
     && constructorsTest<DGtal::StandardDSS4<DGtal::int32_t> >()
@@ -1488,6 +1492,8 @@ int main( int argc, char** argv )
     && comparisonSubsegment<StandardDSL<DGtal::int32_t> >(-8,-5)
 #ifdef WITH_BIGINTEGER
     && comparisonSubsegment<StandardDSL<DGtal::int32_t, DGtal::BigInteger> >(5,8)
+    && comparisonSubsegment<StandardDSL<DGtal::int32_t, DGtal::HybridInteger> >(5,8)
+    && comparisonSubsegment<NaiveDSL<DGtal::int32_t, DGtal::HybridInteger> >(-8,5)
 #endif
       ;
   }
@@ -47,6 +47,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/arithmetic/HybridInteger.h"
 #include "DGtal/io/boards/Board2D.h"
 
 #include "DGtal/geometry/curves/CDynamicBidirectionalSegmentComputer.h"
@@ -422,6 +423,50 @@ bool testBIGINTEGER()
   return flag;
 }
 
+/**
+ * Test for 4-connected points with 64-bit coordinates,
+ * whose remainders do not fit in 64 bits
+ */
+bool testHybridInteger()
+{
+  typedef DGtal::int64_t Coordinate;
+  typedef PointVector<2,Coordinate> Point;
+  typedef std::vector<Point>::iterator Iterator;
+  typedef ArithmeticalDSSComputer<Iterator,DGtal::HybridInteger,4> DSS4;
+
+  trace.beginBlock("Add some points of 64-bit coordinates");
+
+  const Coordinate x = 4000000000000000000LL;
+  std::vector<Point> contour;
+  contour.push_back(Point(x,x));
+  contour.push_back(Point(x+1,x));
+  contour.push_back(Point(x+2,x));
+  contour.push_back(Point(x+3,x));
+  contour.push_back(Point(x+3,x+1));
+  contour.push_back(Point(x+4,x+1));
+  contour.push_back(Point(x+5,x+1));
+  contour.push_back(Point(x+5,x+2));
+
+  DSS4 theDSS4;
+  theDSS4.init( contour.begin() );
+  while ( (theDSS4.end() != contour.end())
+          &&(theDSS4.extendFront()) ) {}
+
+  trace.info() << theDSS4 << " " << theDSS4.isValid() << std::endl;
+
+  const DGtal::HybridInteger mu( DGtal::BigInteger( "-12000000000000000000" ) );
+  bool flag = (theDSS4.a() == 2)
+    &&(theDSS4.b() == 5)
+    &&(theDSS4.mu() == mu)
+    &&(theDSS4.omega() == 7)
+    &&(theDSS4.end() == contour.end())
+    &&(theDSS4.isValid());
+
+  trace.endBlock();
+
+  return flag;
+}
+
 #endif
 
 /**
@@ -487,6 +532,7 @@ int main(int argc, char **argv)
     && testCorner()
 #ifdef WITH_BIGINTEGER
     && testBIGINTEGER()
+    && testHybridInteger()
 #endif
     && testIsInside()
     ;
@@ -0,0 +1,113 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testFreemanChainCollection.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class FreemanChainCollection.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/FreemanChainCollection.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class FreemanChainCollection.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Fills a collection and compares its chains with the original ones.
+ */
+bool testFreemanChainCollection()
+{
+  typedef FreemanChain<int> FC;
+  typedef FreemanChainCollection<int> Collection;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: FreemanChainCollection." );
+
+  std::vector<FC> chains;
+  chains.push_back( FC( "0123", 0, 0 ) );
+  chains.push_back( FC( "", 3, 4 ) );
+  chains.push_back( FC( "00101122232333", -5, 7 ) );
+  chains.push_back( FC( "0001", 10, -2 ) );
+
+  Collection collection;
+  collection.reserve( chains.size(), 100 );
+  nbok += collection.empty() ? 1 : 0; ++nb;
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    if ( i % 2 == 0 ) collection.push_back( chains[ i ] );
+    else collection.push_back( chains[ i ].x0, chains[ i ].y0, chains[ i ].chain );
+  trace.info() << collection << std::endl;
+  nbok += ( collection.size() == chains.size() ) && ( collection.nbCodes() == 22 )
+    && collection.isValid() ? 1 : 0; ++nb;
+
+  std::vector<Collection::Point> points, expected;
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    {
+      const FC fc = collection.chain( i );
+      bool ok = ( fc.chain == chains[ i ].chain ) && ( fc.x0 == chains[ i ].x0 )
+        && ( fc.y0 == chains[ i ].y0 ) && ( collection.length( i ) == chains[ i ].size() )
+        && ( std::string( collection.begin( i ), collection.end( i ) ) == chains[ i ].chain )
+        && ( collection.offset( i + 1 ) - collection.offset( i ) == collection.length( i ) )
+        && ( collection.isClosed( i ) == ( chains[ i ].isClosed() != 0 ) );
+      collection.getContourPoints( i, points );
+      // FreemanChain gives no point for an empty chain, the collection
+      // gives its first point.
+      FC::getContourPoints( chains[ i ], expected );
+      if ( expected.empty() ) expected.push_back( collection.firstPoint( i ) );
+      ok = ok && ( points == expected );
+      nbok += ok ? 1 : 0; ++nb;
+    }
+
+  collection.clear();
+  nbok += collection.empty() && ( collection.nbCodes() == 0 ) && collection.isValid() ? 1 : 0; ++nb;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class FreemanChainCollection" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testFreemanChainCollection();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,151 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testPackedFreemanChain.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class PackedFreemanChain against FreemanChain.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/geometry/curves/FreemanChain.h"
+#include "DGtal/geometry/curves/PackedFreemanChain.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef FreemanChain<int> FC;
+typedef PackedFreemanChain<int> PFC;
+
+/**
+ * Compares a packed chain with the Freeman chain.
+ */
+bool compare( const FC & fc, const PFC & pc )
+{
+  bool ok = ( pc.unpack() == fc ) && pc.isValid() && ( pc.size() == fc.size() )
+    && ( pc.bytes().size() == ( fc.size() + 3 ) / 4 )
+    && ( pc.firstPoint() == fc.firstPoint() ) && ( pc.lastPoint() == fc.lastPoint() )
+    && ( pc.isClosed() == ( fc.isClosed() != 0 ) );
+  for ( unsigned int i = 0; i < fc.size(); ++i )
+    ok = ok && ( pc.code( i ) == fc.code( i ) );
+
+  int min_x, min_y, max_x, max_y, pmin_x, pmin_y, pmax_x, pmax_y;
+  fc.computeBoundingBox( min_x, min_y, max_x, max_y );
+  pc.computeBoundingBox( pmin_x, pmin_y, pmax_x, pmax_y );
+  ok = ok && ( min_x == pmin_x ) && ( min_y == pmin_y ) && ( max_x == pmax_x ) && ( max_y == pmax_y );
+
+  std::vector<FC::Point> points, expected;
+  pc.getContourPoints( points );
+  FC::getContourPoints( fc, expected );
+  if ( fc.size() == 0 ) expected.push_back( fc.firstPoint() );
+  ok = ok && ( points == expected );
+
+  // area and spikes computed from the points
+  int area = 0;
+  for ( unsigned int i = 0; i < points.size(); ++i )
+    {
+      const FC::Point & p = points[ i ];
+      const FC::Point & q = points[ ( i + 1 ) % points.size() ];
+      area += p[ 0 ] * q[ 1 ] - q[ 0 ] * p[ 1 ];
+    }
+  unsigned int spikes = 0;
+  const unsigned int nbPairs = fc.isClosed() ? fc.size() : ( fc.size() > 0 ? fc.size() - 1 : 0 );
+  for ( unsigned int i = 0; i < nbPairs; ++i )
+    if ( ( fc.code( i ) - '0' + 2 ) % 4 == fc.code( ( i + 1 ) % fc.size() ) - '0' )
+      ++spikes;
+  ok = ok && ( pc.twiceSignedArea() == area ) && ( pc.nbSpikes() == spikes );
+  if ( fc.size() > 0 )
+    ok = ok && ( pc.ccwLoops() == fc.ccwLoops() );
+  return ok;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class PackedFreemanChain.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Open and closed chains of all lengths modulo 4.
+ */
+bool testPackedFreemanChain()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: PackedFreemanChain." );
+
+  std::vector<FC> chains;
+  chains.push_back( FC( "", 3, 4 ) );
+  chains.push_back( FC( "0123", 0, 0 ) );
+  chains.push_back( FC( "00112233", 5, 5 ) );
+  chains.push_back( FC( "0001", 10, -2 ) );
+  chains.push_back( FC( "03322110", -1, 2 ) );                 // clockwise
+  chains.push_back( FC( "00101122232333", -5, 7 ) );
+  chains.push_back( FC( "0123012301230123", 0, 0 ) );         // 4 loops
+  chains.push_back( FC( "0012321233", 0, 0 ) );               // spikes
+  chains.push_back( FC( "000111222333000111222333", 2, 1 ) ); // 2 loops
+  srand( 7 );
+  for ( unsigned int n = 0; n < 70; ++n )
+    {
+      std::string s;
+      for ( unsigned int k = 0; k < n; ++k )
+        s += static_cast<char>( '0' + rand() % 4 );
+      chains.push_back( FC( s, rand() % 100 - 50, rand() % 100 - 50 ) );
+    }
+
+  for ( unsigned int i = 0; i < chains.size(); ++i )
+    {
+      const PFC pc( chains[ i ] );
+      const PFC pc2( chains[ i ].chain, chains[ i ].x0, chains[ i ].y0 );
+      nbok += compare( chains[ i ], pc ) && compare( chains[ i ], pc2 ) ? 1 : 0; ++nb;
+    }
+  const PFC square( "00112233", 5, 5 );
+  const PFC clockwise( "03322110", -1, 2 );
+  nbok += ( square.ccwLoops() == 1 ) && ( square.twiceSignedArea() == 8 )
+    && ( clockwise.ccwLoops() == -1 ) && ( clockwise.twiceSignedArea() == -8 ) ? 1 : 0; ++nb;
+  trace.info() << square << std::endl;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class PackedFreemanChain" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testPackedFreemanChain();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
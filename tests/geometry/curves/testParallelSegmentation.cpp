@@ -0,0 +1,227 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testParallelSegmentation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the getSegmentsParallel() methods of
+ * GreedySegmentation and SaturatedSegmentation against the
+ * sequential iterators.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/base/Circulator.h"
+#include "DGtal/geometry/curves/ArithmeticalDSSComputer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2,int> Point;
+typedef std::vector<Point> Range;
+typedef Range::const_iterator ConstIterator;
+typedef Circulator<ConstIterator> ConstCirculator;
+
+/**
+ * Closed 4-connected digital curve following the polar curve
+ * r = R ( 1 + 0.3 cos( 7 t ) + 0.1 sin( 23 t ) ).
+ */
+void makeCurve( Range & aCurve, double aRadius )
+{
+  aCurve.clear();
+  const unsigned int nb = static_cast<unsigned int>( 40 * aRadius );
+  Point current;
+  for ( unsigned int k = 0; k <= nb; ++k )
+    {
+      const double t = 2.0 * M_PI * k / nb;
+      const double r = aRadius * ( 1.0 + 0.3 * std::cos( 7 * t ) + 0.1 * std::sin( 23 * t ) );
+      const Point target( static_cast<int>( std::floor( r * std::cos( t ) + 0.5 ) ),
+                          static_cast<int>( std::floor( r * std::sin( t ) + 0.5 ) ) );
+      if ( k == 0 ) { current = target; aCurve.push_back( current ); continue; }
+      while ( current != target )
+        {
+          if ( current[ 0 ] != target[ 0 ] ) current[ 0 ] += ( target[ 0 ] > current[ 0 ] ) ? 1 : -1;
+          else current[ 1 ] += ( target[ 1 ] > current[ 1 ] ) ? 1 : -1;
+          aCurve.push_back( current );
+        }
+    }
+  aCurve.pop_back(); // back to the first point
+}
+
+/// Compares two sequences of segments.
+template <typename SC>
+bool sameSegments( const std::vector<SC> & aSegments1, const std::vector<SC> & aSegments2 )
+{
+  if ( aSegments1.size() != aSegments2.size() ) return false;
+  for ( unsigned int i = 0; i < aSegments1.size(); ++i )
+    if ( ( aSegments1[ i ].begin() != aSegments2[ i ].begin() )
+         || ( aSegments1[ i ].end() != aSegments2[ i ].end() )
+         || ( aSegments1[ i ] != aSegments2[ i ] ) )
+      return false;
+  return true;
+}
+
+/**
+ * Compares the parallel computation of the segments with the
+ * sequential one, for several numbers of chunks.
+ */
+template <typename Segmentation>
+bool compareWithSequential( const Segmentation & aSegmentation, unsigned int & nbok, unsigned int & nb )
+{
+  typedef typename Segmentation::SegmentComputer SC;
+  std::vector<SC> sequential;
+  for ( typename Segmentation::SegmentComputerIterator it = aSegmentation.begin(),
+          itEnd = aSegmentation.end(); it != itEnd; ++it )
+    sequential.push_back( *it );
+
+  const unsigned int nbChunks[] = { 0, 2, 3, 7, 64, 1000 };
+  bool res = true;
+  for ( unsigned int i = 0; i < 6; ++i )
+    {
+      std::vector<SC> parallel;
+      aSegmentation.getSegmentsParallel( parallel, nbChunks[ i ] );
+      const bool ok = sameSegments( sequential, parallel );
+      if ( ! ok )
+        trace.info() << "  " << nbChunks[ i ] << " chunks: " << parallel.size()
+                     << " segments instead of " << sequential.size() << std::endl;
+      res = res && ok;
+      ++nb, nbok += ok ? 1 : 0;
+    }
+  return res;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing getSegmentsParallel().
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Greedy segmentations of an open range, of a subrange (all modes)
+ * and of a closed curve given by circulators.
+ */
+bool testGreedy( const Range & aCurve )
+{
+  typedef ArithmeticalDSSComputer<ConstIterator,int,4> SC;
+  typedef ArithmeticalDSSComputer<ConstCirculator,int,4> CSC;
+  typedef GreedySegmentation<SC> Segmentation;
+  typedef GreedySegmentation<CSC> CSegmentation;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: parallel greedy segmentation." );
+
+  Segmentation whole( aCurve.begin(), aCurve.end(), SC() );
+  compareWithSequential( whole, nbok, nb );
+
+  const std::string modes[] = { "Truncate", "Truncate+1", "DoNotTruncate" };
+  for ( unsigned int m = 0; m < 3; ++m )
+    {
+      Segmentation sub( aCurve.begin(), aCurve.end(), SC() );
+      sub.setSubRange( aCurve.begin() + aCurve.size() / 5, aCurve.begin() + 4 * aCurve.size() / 5 );
+      sub.setMode( modes[ m ] );
+      compareWithSequential( sub, nbok, nb );
+    }
+
+  const ConstCirculator c( aCurve.begin() + 17, aCurve.begin(), aCurve.end() );
+  CSegmentation closed( c, c, CSC() );
+  compareWithSequential( closed, nbok, nb );
+
+  // subrange of a closed curve, around the first point of the range
+  CSegmentation closedSub( c, c, CSC() );
+  closedSub.setSubRange( c - aCurve.size() / 3, c + aCurve.size() / 3 );
+  compareWithSequential( closedSub, nbok, nb );
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Saturated segmentations of an open range, of a subrange (all modes)
+ * and of a closed curve given by circulators.
+ */
+bool testSaturated( const Range & aCurve )
+{
+  typedef ArithmeticalDSSComputer<ConstIterator,int,4> SC;
+  typedef ArithmeticalDSSComputer<ConstCirculator,int,4> CSC;
+  typedef SaturatedSegmentation<SC> Segmentation;
+  typedef SaturatedSegmentation<CSC> CSegmentation;
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing block: parallel saturated segmentation." );
+
+  Segmentation whole( aCurve.begin(), aCurve.end(), SC() );
+  compareWithSequential( whole, nbok, nb );
+
+  const std::string modes[] = { "First", "MostCentered", "Last", "First++", "MostCentered++", "Last++" };
+  for ( unsigned int m = 0; m < 6; ++m )
+    {
+      Segmentation sub( aCurve.begin(), aCurve.end(), SC() );
+      sub.setSubRange( aCurve.begin() + aCurve.size() / 5, aCurve.begin() + 4 * aCurve.size() / 5 );
+      sub.setMode( modes[ m ] );
+      compareWithSequential( sub, nbok, nb );
+
+      const ConstCirculator c( aCurve.begin() + 17, aCurve.begin(), aCurve.end() );
+      CSegmentation closed( c, c, CSC() );
+      closed.setMode( modes[ m ] );
+      compareWithSequential( closed, nbok, nb );
+    }
+
+  const ConstCirculator c( aCurve.begin(), aCurve.begin(), aCurve.end() );
+  CSegmentation closedSub( c, c, CSC() );
+  closedSub.setSubRange( c - aCurve.size() / 3, c + aCurve.size() / 3 );
+  compareWithSequential( closedSub, nbok, nb );
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing parallel segmentations" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  Range small, large;
+  makeCurve( small, 20.0 );
+  makeCurve( large, 2000.0 );
+  trace.info() << small.size() << " and " << large.size() << " points." << std::endl;
+
+  bool res = testGreedy( small ) && testGreedy( large )
+    && testSaturated( small ) && testSaturated( large );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
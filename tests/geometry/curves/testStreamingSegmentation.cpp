@@ -0,0 +1,229 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStreamingSegmentation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class StreamingSegmentation against
+ * GreedySegmentation and SaturatedSegmentation.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include <utility>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/curves/Naive3DDSSComputer.h"
+#include "DGtal/geometry/curves/StandardDSS6Computer.h"
+#include "DGtal/geometry/curves/GreedySegmentation.h"
+#include "DGtal/geometry/curves/SaturatedSegmentation.h"
+#include "DGtal/geometry/curves/StreamingSegmentation.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<3,int> Point;
+typedef std::pair<std::size_t, std::size_t> Range;
+
+/**
+ * Random 3D curve made of digital straight pieces, whose steps
+ * alternate between two steps of @a steps.
+ */
+std::vector<Point> makeCurve( const std::vector<Point>& steps, unsigned int aNbPieces )
+{
+  std::vector<Point> curve;
+  Point p( 0, 0, 0 );
+  curve.push_back( p );
+  for ( unsigned int k = 0; k < aNbPieces; ++k )
+    {
+      const Point s1 = steps[ rand() % steps.size() ];
+      const Point s2 = steps[ rand() % steps.size() ];
+      const int q = 1 + rand() % 7;
+      const int r = rand() % ( q + 1 );
+      const int length = 5 + rand() % 60;
+      for ( int i = 0; i < length; ++i )
+        {
+          p += ( ( ( i + 1 ) * r ) / q > ( i * r ) / q ) ? s2 : s1;
+          curve.push_back( p );
+        }
+    }
+  return curve;
+}
+
+/// Records the ranges and directions of the streamed segments.
+template <typename SegmentComputer>
+struct SegmentRecorder
+{
+  std::vector<Range> ranges;
+  std::vector<typename SegmentComputer::Vector3d> directions;
+
+  void operator()( const SegmentComputer& s )
+  {
+    typename SegmentComputer::Vector3d direction;
+    typename SegmentComputer::PointR3d intercept, thickness;
+    s.getParameters( direction, intercept, thickness );
+    ranges.push_back( Range( s.begin().index(), s.end().index() ) );
+    directions.push_back( direction );
+  }
+};
+
+/**
+ * Compares the segments computed by StreamingSegmentation with the
+ * ones of GreedySegmentation and SaturatedSegmentation on a stored
+ * curve.
+ */
+template <template <typename, typename, int> class TComputer, int connectivity>
+bool testStreamingSegmentation( const std::vector<Point>& steps )
+{
+  typedef std::vector<Point>::const_iterator Iterator;
+  typedef TComputer<Iterator, DGtal::int64_t, connectivity> SegmentComputer;
+  typedef typename StreamWindow<Point>::ConstIterator WindowIterator;
+  typedef TComputer<WindowIterator, DGtal::int64_t, connectivity> StreamSegmentComputer;
+  typedef typename SegmentComputer::Vector3d Vector3d;
+  typedef typename SegmentComputer::PointR3d PointR3d;
+
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Streaming segmentations versus stored segmentations" );
+  for ( unsigned int k = 0; k < 20; ++k )
+    {
+      const std::vector<Point> curve = makeCurve( steps, 1 + k * 10 );
+
+      // reference segmentations
+      std::vector<Range> greedy, saturated;
+      std::vector<Vector3d> greedyDirections;
+      std::size_t maxLength = 0;
+      GreedySegmentation<SegmentComputer> gs( curve.begin(), curve.end(), SegmentComputer() );
+      for ( typename GreedySegmentation<SegmentComputer>::SegmentComputerIterator
+              it = gs.begin(), itEnd = gs.end(); it != itEnd; ++it )
+        {
+          Vector3d direction;
+          PointR3d intercept, thickness;
+          it->getParameters( direction, intercept, thickness );
+          greedy.push_back( Range( it->begin() - curve.begin(), it->end() - curve.begin() ) );
+          greedyDirections.push_back( direction );
+          maxLength = std::max( maxLength, greedy.back().second - greedy.back().first );
+        }
+      SaturatedSegmentation<SegmentComputer> ss( curve.begin(), curve.end(), SegmentComputer() );
+      for ( typename SaturatedSegmentation<SegmentComputer>::SegmentComputerIterator
+              it = ss.begin(), itEnd = ss.end(); it != itEnd; ++it )
+        {
+          saturated.push_back( Range( it->begin() - curve.begin(), it->end() - curve.begin() ) );
+          maxLength = std::max( maxLength, saturated.back().second - saturated.back().first );
+        }
+
+      // streaming segmentations
+      StreamingSegmentation<StreamSegmentComputer> streaming;
+      SegmentRecorder<StreamSegmentComputer> greedyRecorder, saturatedRecorder;
+      const std::size_t nbGreedy =
+        streaming.greedySegmentation( curve.begin(), curve.end(), greedyRecorder );
+      const std::size_t greedyWindow = streaming.maxWindowSize();
+      const std::size_t nbSaturated =
+        streaming.saturatedSegmentation( curve.begin(), curve.end(), saturatedRecorder );
+      const std::size_t saturatedWindow = streaming.maxWindowSize();
+
+      trace.info() << curve.size() << " points, " << nbGreedy << " greedy segments, "
+                   << nbSaturated << " maximal segments, " << streaming << std::endl;
+      ++nb, nbok += ( nbGreedy == greedy.size() ) && ( greedyRecorder.ranges == greedy )
+        && ( greedyRecorder.directions == greedyDirections ) ? 1 : 0;
+      ++nb, nbok += ( nbSaturated == saturated.size() )
+        && ( saturatedRecorder.ranges == saturated ) ? 1 : 0;
+      ++nb, nbok += ( greedyWindow <= maxLength + 1 )
+        && ( saturatedWindow <= maxLength + 1 ) ? 1 : 0;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") segmentations" << std::endl;
+
+  StreamingSegmentation<StreamSegmentComputer> streaming;
+  SegmentRecorder<StreamSegmentComputer> recorder;
+  const std::vector<Point> single( 1, Point( 1, 2, 3 ) );
+  ++nb, nbok += ( streaming.greedySegmentation( single.end(), single.end(), recorder ) == 0 )
+    && ( streaming.saturatedSegmentation( single.begin(), single.end(), recorder ) == 1 )
+    && ( recorder.ranges.back() == Range( 0, 1 ) ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") empty and single point curves" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Checks that the iterators of a StreamWindow remain valid while the
+ * window slides and grows.
+ */
+bool testStreamWindow()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing StreamWindow" );
+  StreamWindow<int> window( 3 );
+  ++nb, nbok += ( window.capacity() == 4 ) && ( window.size() == 0 ) ? 1 : 0;
+  StreamWindow<int>::ConstIterator it = window.begin();
+  bool ok = true;
+  for ( int i = 0; i < 1000; ++i )
+    {
+      window.push_back( i );
+      if ( ( i < 300 ) && ( i % 3 == 2 ) ) window.eraseBefore( window.begin() + 2 );
+      ok = ok && ( *( window.end() - 1 ) == i ) && ( *window.begin() == (int) window.begin().index() );
+      if ( window.contains( it.index() ) ) ok = ok && ( *it == (int) it.index() );
+      if ( i == 500 ) it = window.end() - 1;
+    }
+  ++nb, nbok += ok && ( *it == 500 ) ? 1 : 0;
+  ++nb, nbok += ( window.size() == 1000 - 2 * 100 )
+    && ( window.end() - window.begin() == (std::ptrdiff_t) window.size() )
+    && ( window.capacity() >= window.size() ) && ( window.capacity() < 2 * window.size() ) ? 1 : 0;
+  trace.info() << "(" << nbok << "/" << nb << ") tests, capacity=" << window.capacity() << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class StreamingSegmentation" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  srand( 0 );
+  std::vector<Point> steps26;
+  for ( int x = -1; x <= 1; ++x )
+    for ( int y = 0; y <= 1; ++y )
+      for ( int z = 0; z <= 1; ++z )
+        if ( ( x != 0 ) || ( y != 0 ) || ( z != 0 ) )
+          steps26.push_back( Point( x, y, z ) );
+  std::vector<Point> steps6;
+  steps6.push_back( Point( 1, 0, 0 ) );
+  steps6.push_back( Point( 0, 1, 0 ) );
+  steps6.push_back( Point( 0, 0, 1 ) );
+
+  bool res = testStreamWindow()
+    && testStreamingSegmentation<Naive3DDSSComputer, 8>( steps26 )
+    && testStreamingSegmentation<StandardDSS6Computer, 4>( steps6 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
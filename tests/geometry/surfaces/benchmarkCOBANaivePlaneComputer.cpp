@@ -0,0 +1,163 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the recognition of naive planes with
+ * COBANaivePlaneComputer (same workload as
+ * testCOBANaivePlaneComputer-benchmark.cpp), and of the cuts of
+ * LatticePolytope2D stored in a list or in a vector.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/arithmetic/LatticePolytope2D.h"
+#include "DGtal/geometry/surfaces/COBANaivePlaneComputer.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+template <typename Integer>
+static Integer getRandomInteger( const Integer & first, const Integer & after_last )
+{
+  Integer r = (Integer) rand();
+  return ( r % (after_last - first) ) + first;
+}
+
+/// aNbPoints random points of the naive plane d <= ax+by+cz < d + max(|a|,|b|,|c|),
+/// with (a,b,c) dominated by the x-coordinate.
+static std::vector<Z3i::Point> makePlanePoints( int aDiameter, unsigned int aNbPoints,
+                                                DGtal::int64_t a, DGtal::int64_t b,
+                                                DGtal::int64_t c, DGtal::int64_t d )
+{
+  IntegerComputer<DGtal::int64_t> ic;
+  std::vector<Z3i::Point> points;
+  for ( unsigned int i = 0; i < aNbPoints; ++i )
+    {
+      Z3i::Point p( 0,
+                    getRandomInteger<int>( -aDiameter+1, aDiameter ),
+                    getRandomInteger<int>( -aDiameter+1, aDiameter ) );
+      p[ 0 ] = (int) ic.ceilDiv( d - b * p[ 1 ] - c * p[ 2 ], a );
+      points.push_back( p );
+    }
+  return points;
+}
+
+/// Recognition of 20 random planes of diameter range(0) from 1000 points each.
+template <typename Integer>
+static void BM_COBANaivePlane(benchmark::State& state)
+{
+  typedef COBANaivePlaneComputer<Z3i::Space, Integer> PlaneComputer;
+  const int diameter = state.range(0);
+  srand( 0 );
+  std::vector< std::vector<Z3i::Point> > planes;
+  for ( unsigned int i = 0; i < 20; ++i )
+    {
+      const DGtal::int64_t b = getRandomInteger<int>( 0, diameter / 2 );
+      const DGtal::int64_t c = getRandomInteger<int>( 0, diameter / 2 );
+      const DGtal::int64_t a = std::max( b, c ) + 1 + getRandomInteger<int>( 0, diameter / 2 );
+      const DGtal::int64_t d = getRandomInteger<int>( 0, diameter / 2 );
+      planes.push_back( makePlanePoints( diameter, 1000, a, b, c, d ) );
+    }
+  unsigned int nbOk = 0;
+  while (state.KeepRunning())
+    {
+      nbOk = 0;
+      for ( unsigned int i = 0; i < planes.size(); ++i )
+        {
+          PlaneComputer plane;
+          plane.init( 0, diameter, 1, 1 );
+          bool ok = true;
+          for ( unsigned int j = 0; ok && ( j < planes[ i ].size() ); ++j )
+            ok = plane.extend( planes[ i ][ j ] );
+          nbOk += ok ? 1 : 0;
+        }
+      benchmark::DoNotOptimize( nbOk );
+    }
+  if ( nbOk != 20 )
+    state.SkipWithError( "A plane was not recognized." );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*20*1000);
+}
+BENCHMARK_TEMPLATE(BM_COBANaivePlane, DGtal::int64_t)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_COBANaivePlane, DGtal::BigInteger)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+
+/// Cuts of a square search space by batches of 2 opposite half-planes,
+/// as done by COBANaivePlaneComputer, for a given vertex sequence.
+template <typename Integer, typename Sequence>
+static void BM_LatticePolytopeCut(benchmark::State& state)
+{
+  typedef SpaceND<2, Integer> Space2;
+  typedef typename Space2::Point Point2;
+  typedef LatticePolytope2D<Space2, Sequence> Polytope;
+  typedef typename Polytope::HalfSpace HalfSpace;
+  const int diameter = state.range(0);
+  srand( 0 );
+  std::vector<HalfSpace> cuts;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      Point2 n( getRandomInteger<int>( -diameter, diameter+1 ),
+                getRandomInteger<int>( -diameter, diameter+1 ) );
+      if ( n == Point2::zero ) n[ 0 ] = 1;
+      const Integer c = getRandomInteger<int>( diameter * diameter / 4, diameter * diameter );
+      cuts.push_back( HalfSpace( n, c ) );
+      cuts.push_back( HalfSpace( -n, c ) );
+    }
+  Polytope polytope;
+  while (state.KeepRunning())
+    {
+      for ( unsigned int i = 0; i < cuts.size(); i += 10 )
+        {
+          polytope.clear();
+          polytope.pushBack( Point2( -diameter, -diameter ) );
+          polytope.pushBack( Point2(  diameter, -diameter ) );
+          polytope.pushBack( Point2(  diameter,  diameter ) );
+          polytope.pushBack( Point2( -diameter,  diameter ) );
+          polytope.cut( cuts.begin() + i, cuts.begin() + i + 10 );
+          benchmark::DoNotOptimize( polytope.size() );
+        }
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*cuts.size());
+}
+BENCHMARK_TEMPLATE(BM_LatticePolytopeCut, DGtal::int64_t, std::list< PointVector<2, DGtal::int64_t> >)->Arg(100)->Arg(500);
+BENCHMARK_TEMPLATE(BM_LatticePolytopeCut, DGtal::int64_t, std::vector< PointVector<2, DGtal::int64_t> >)->Arg(100)->Arg(500);
+BENCHMARK_TEMPLATE(BM_LatticePolytopeCut, DGtal::BigInteger, std::list< PointVector<2, DGtal::BigInteger> >)->Arg(100)->Arg(500);
+BENCHMARK_TEMPLATE(BM_LatticePolytopeCut, DGtal::BigInteger, std::vector< PointVector<2, DGtal::BigInteger> >)->Arg(100)->Arg(500);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,181 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the jet fitting of JetFitting, compared with a fit
+ * building the full design matrix of each neighborhood and solving it
+ * with a SVD (as CGAL Monge_via_jet_fitting does), and of the
+ * sequential and parallel evaluations of a jet fitting estimator on a
+ * digital surface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/surfaces/estimation/LocalEstimatorFromSurfelFunctorAdapter.h"
+#include "DGtal/geometry/surfaces/estimation/JetFitting.h"
+#include "DGtal/geometry/surfaces/estimation/estimationFunctors/JetFittingEstimators.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef std::vector<Z3i::RealPoint> Neighborhood;
+
+/// 1000 noisy patches of 100 points around points of a sphere of radius 10.
+static std::vector<Neighborhood> makeNeighborhoods()
+{
+  srand( 0 );
+  std::vector<Neighborhood> neighborhoods( 1000 );
+  for ( unsigned int i = 0; i < neighborhoods.size(); ++i )
+    {
+      const Eigen::Vector3d center = Eigen::Vector3d::Random().normalized() * 10;
+      for ( unsigned int j = 0; j < 100; ++j )
+        {
+          const Eigen::Vector3d point =
+            ( center + 3 * Eigen::Vector3d::Random() ).normalized() * 10 + 0.05 * Eigen::Vector3d::Random();
+          neighborhoods[ i ].push_back( Z3i::RealPoint( point(0), point(1), point(2) ) );
+        }
+      neighborhoods[ i ][ 0 ] = Z3i::RealPoint( center(0), center(1), center(2) );
+    }
+  return neighborhoods;
+}
+
+/// Fits of degree range(0) with a JetFitting reused between neighborhoods.
+static void BM_JetFitting(benchmark::State& state)
+{
+  const unsigned int degree = state.range(0);
+  const std::vector<Neighborhood> neighborhoods = makeNeighborhoods();
+  JetFitting<Z3i::RealPoint> fitting;
+  while (state.KeepRunning())
+    {
+      double sum = 0;
+      for ( unsigned int i = 0; i < neighborhoods.size(); ++i )
+        {
+          fitting.reset();
+          for ( unsigned int j = 0; j < neighborhoods[ i ].size(); ++j )
+            fitting.push( neighborhoods[ i ][ j ] );
+          fitting.fit( degree );
+          sum += fitting.meanCurvature();
+        }
+      benchmark::DoNotOptimize( sum );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*neighborhoods.size());
+}
+BENCHMARK(BM_JetFitting)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond);
+
+/// Fits of degree range(0) copying each neighborhood, then building
+/// and solving its design matrix with a SVD.
+static void BM_JetFittingDesignMatrix(benchmark::State& state)
+{
+  const unsigned int degree = state.range(0);
+  const unsigned int nbCoefficients = ( degree + 1 ) * ( degree + 2 ) / 2;
+  const std::vector<Neighborhood> neighborhoods = makeNeighborhoods();
+  while (state.KeepRunning())
+    {
+      double sum = 0;
+      for ( unsigned int i = 0; i < neighborhoods.size(); ++i )
+        {
+          const Neighborhood& neighborhood = neighborhoods[ i ];
+          Eigen::MatrixXd points( neighborhood.size(), 3 );
+          for ( unsigned int j = 0; j < neighborhood.size(); ++j )
+            for ( unsigned int k = 0; k < 3; ++k )
+              points( j, k ) = neighborhood[ j ][ k ] - neighborhood[ 0 ][ k ];
+          const Eigen::MatrixXd centered = points.rowwise() - points.colwise().mean();
+          const Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> pca( centered.transpose() * centered );
+          const Eigen::MatrixXd local = points * pca.eigenvectors().rowwise().reverse();
+
+          Eigen::MatrixXd design( neighborhood.size(), nbCoefficients );
+          for ( unsigned int j = 0; j < neighborhood.size(); ++j )
+            {
+              unsigned int c = 0;
+              for ( unsigned int total = 0; total <= degree; ++total )
+                for ( unsigned int k = 0; k <= total; ++k )
+                  design( j, c++ ) = std::pow( local( j, 0 ), double( total - k ) ) * std::pow( local( j, 1 ), double( k ) );
+            }
+          const Eigen::VectorXd coefficients =
+            design.jacobiSvd( Eigen::ComputeThinU | Eigen::ComputeThinV ).solve( local.col( 2 ) );
+          sum += coefficients( 3 ) + coefficients( 5 );
+        }
+      benchmark::DoNotOptimize( sum );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*neighborhoods.size());
+}
+BENCHMARK(BM_JetFittingDesignMatrix)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond);
+
+/// Mean curvature of a digitized ball of radius 16, evaluated
+/// sequentially (range(0) == 0) or in parallel (range(0) == 1).
+static void BM_JetFittingMeanCurvatureEstimator(benchmark::State& state)
+{
+  using namespace Z3i;
+  typedef GaussDigitizer<Space, ImplicitBall<Space> > Gauss;
+  typedef LightImplicitDigitalSurface<KSpace, Gauss> SurfaceContainer;
+  typedef DigitalSurface<SurfaceContainer> Surface;
+  typedef Surface::Surfel Surfel;
+  typedef functors::JetFittingMeanCurvatureEstimator<Surfel, CanonicSCellEmbedder<KSpace> > Functor;
+  typedef functors::ConstValue<double> ConvFunctor;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<SurfaceContainer, L2Metric, Functor, ConvFunctor> Reporter;
+
+  const Point p1( -20, -20, -20 );
+  const Point p2( 20, 20, 20 );
+  ImplicitBall<Space> shape( RealPoint( 0.5, 0.2, 0 ), 16 );
+  Gauss gauss;
+  gauss.attach( shape );
+  gauss.init( p1, p2, 1 );
+  KSpace K;
+  K.init( p1, p2, true );
+  const Surfel bel = Surfaces<KSpace>::findABel( K, gauss, 10000 );
+  Surface surface( new SurfaceContainer( K, gauss, SurfelAdjacency<KSpace::dimension>( true ), bel ) );
+  const CanonicSCellEmbedder<KSpace> embedder( K );
+  const std::vector<Surfel> surfels( surface.begin(), surface.end() );
+
+  Functor functor( embedder, 1.0, 2 );
+  ConvFunctor convFunc( 1.0 );
+  Reporter reporter( surface, l2Metric, functor, convFunc );
+  reporter.setParams( l2Metric, functor, convFunc, 6.0 );
+  reporter.init( 1.0, surfels.begin(), surfels.end() );
+  std::vector<double> means;
+  means.reserve( surfels.size() );
+  while (state.KeepRunning())
+    {
+      means.clear();
+      if ( state.range(0) == 0 )
+        reporter.eval( surfels.begin(), surfels.end(), std::back_inserter( means ) );
+      else
+        reporter.evalParallel( surfels.begin(), surfels.end(), std::back_inserter( means ) );
+      benchmark::DoNotOptimize( means.data() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*surfels.size());
+}
+BENCHMARK(BM_JetFittingMeanCurvatureEstimator)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,275 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class BatchTensorVotingFeatureExtraction.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/math/linalg/SimpleMatrix.h"
+#include "DGtal/math/linalg/EigenDecomposition.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/graph/DistanceBreadthFirstVisitor.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/shapes/implicit/ImplicitHyperCube.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/geometry/surfaces/estimation/estimationFunctors/TensorVotingFeatureExtraction.h"
+#include "DGtal/geometry/surfaces/estimation/BatchTensorVotingFeatureExtraction.h"
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class BatchTensorVotingFeatureExtraction.
+///////////////////////////////////////////////////////////////////////////////
+
+/// Euclidean distance from the canonical embedding of a given surfel.
+template <typename KSpace>
+struct EmbeddedDistance
+{
+  typedef double Value;
+  typedef typename KSpace::SCell Surfel;
+  typedef typename KSpace::Space::RealPoint RealPoint;
+
+  EmbeddedDistance( const CanonicSCellEmbedder<KSpace> & embedder, const Surfel & s )
+    : myEmbedder( &embedder ), myCenter( embedder( s ) )
+  {}
+
+  Value operator()( const Surfel & s ) const
+  {
+    return ( (*myEmbedder)( s ) - myCenter ).norm();
+  }
+
+  const CanonicSCellEmbedder<KSpace>* myEmbedder;
+  RealPoint myCenter;
+};
+
+/**
+ * Feature score of a surfel computed surfel by surfel with
+ * functors::TensorVotingFeatureExtraction, as
+ * LocalEstimatorFromSurfelFunctorAdapter does, with Euclidean
+ * distances between canonical embeddings.
+ */
+template <typename Surface>
+double referenceScore( const Surface & surface, const typename Surface::Surfel & s,
+                       const functors::GaussianKernel & kernel, const double radius )
+{
+  typedef typename Surface::KSpace KSpace;
+  typedef typename Surface::Surfel Surfel;
+  typedef CanonicSCellEmbedder<KSpace> Embedder;
+  typedef EmbeddedDistance<KSpace> Distance;
+  typedef DistanceBreadthFirstVisitor<Surface, Distance> Visitor;
+
+  const Embedder embedder( surface.container().space() );
+  functors::TensorVotingFeatureExtraction<Surfel, Embedder> functor( embedder, 1.0 );
+  Visitor visitor( surface, Distance( embedder, s ), s );
+  while ( ! visitor.finished() )
+    {
+      typename Visitor::Node node = visitor.current();
+      if ( node.second >= radius ) break;
+      functor.pushSurfel( node.first, kernel( ( radius - node.second ) / radius ) );
+      visitor.expand();
+    }
+  return functor.eval();
+}
+
+/**
+ * Closed form eigenvalues against EigenDecomposition.
+ */
+bool testEigenValues()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing closed form eigenvalues ..." );
+
+  typedef BatchTensorVotingFeatureExtraction<
+    LightImplicitDigitalSurface<Z3i::KSpace, GaussDigitizer<Z3i::Space, ImplicitBall<Z3i::Space> > >,
+    Z3i::L2Metric, functors::GaussianKernel> Batch;
+  typedef SimpleMatrix<double, 3, 3> Matrix;
+
+  srand( 0 );
+  std::vector<Matrix> matrices;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    {
+      Matrix m;
+      for ( Dimension r = 0; r < 3; ++r )
+        for ( Dimension c = r; c < 3; ++c )
+          {
+            const double v = 2.0 * rand() / (double) RAND_MAX - 1.0;
+            m.setComponent( r, c, v );
+            m.setComponent( c, r, v );
+          }
+      matrices.push_back( m );
+    }
+  Matrix m;
+  m.identity();
+  matrices.push_back( m );
+  m.setComponent( 2, 2, 3.0 );
+  matrices.push_back( m );
+  m.setComponent( 0, 0, 3.0 );
+  matrices.push_back( m );
+  m.constant( 1.0 );
+  matrices.push_back( m );
+
+  double maxError = 0.0;
+  for ( unsigned int i = 0; i < matrices.size(); ++i )
+    {
+      Matrix eigenvectors;
+      Z3i::RealVector eigenvalues;
+      EigenDecomposition<3, double>::getEigenDecomposition( matrices[ i ], eigenvectors, eigenvalues );
+      std::sort( eigenvalues.begin(), eigenvalues.end() );
+      double l[ 3 ];
+      Batch::eigenValues( matrices[ i ]( 0, 0 ), matrices[ i ]( 0, 1 ), matrices[ i ]( 0, 2 ),
+                          matrices[ i ]( 1, 1 ), matrices[ i ]( 1, 2 ), matrices[ i ]( 2, 2 ),
+                          l[ 0 ], l[ 1 ], l[ 2 ] );
+      for ( Dimension k = 0; k < 3; ++k )
+        maxError = std::max( maxError, std::abs( l[ k ] - eigenvalues[ k ] ) );
+    }
+  trace.info() << "Max eigenvalue error = " << maxError << std::endl;
+  nbok += ( maxError < 1e-6 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Same eigenvalues as EigenDecomposition" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Batch scores against surfel by surfel scores.
+ */
+template <typename Shape>
+bool testBatchScores( const std::string & name, const double radius )
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing batch tensor voting on " + name + " ..." );
+
+  using namespace Z3i;
+  typedef GaussDigitizer<Space, Shape> Gauss;
+  typedef LightImplicitDigitalSurface<KSpace, Gauss> SurfaceContainer;
+  typedef DigitalSurface<SurfaceContainer> Surface;
+  typedef typename Surface::Surfel Surfel;
+  typedef BatchTensorVotingFeatureExtraction<SurfaceContainer, L2Metric, functors::GaussianKernel> Batch;
+
+  Point p1( -10, -10, -10 );
+  Point p2( 10, 10, 10 );
+  KSpace K;
+  K.init( p1, p2, true );
+  Shape shape( RealPoint::diagonal( 0.0 ), 6.0 );
+  Gauss gauss;
+  gauss.attach( shape );
+  gauss.init( p1, p2, 1.0 );
+  Surfel bel = Surfaces<KSpace>::findABel( K, gauss, 10000 );
+  SurfaceContainer* surfaceContainer = new SurfaceContainer
+    ( K, gauss, SurfelAdjacency<KSpace::dimension>( true ), bel );
+  Surface surface( surfaceContainer ); // acquired
+
+  functors::GaussianKernel kernel( 1.0 );
+  Batch batch( surface, l2Metric, kernel, radius );
+  trace.info() << batch << std::endl;
+  nbok += batch.isValid() ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "batch is valid" << std::endl;
+
+  std::vector<Surfel> surfels( surface.begin(), surface.end() );
+  std::vector<double> scores;
+  batch.eval( surfels.begin(), surfels.end(), std::back_inserter( scores ) );
+  nbok += ( scores.size() == surfels.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "one score per surfel" << std::endl;
+
+  double maxError = 0.0;
+  double minScore = scores[ 0 ];
+  double maxScore = scores[ 0 ];
+  for ( unsigned int i = 0; i < surfels.size(); ++i )
+    {
+      const double ref = referenceScore( surface, surfels[ i ], kernel, radius );
+      maxError = std::max( maxError, std::abs( ref - scores[ i ] ) );
+      minScore = std::min( minScore, scores[ i ] );
+      maxScore = std::max( maxScore, scores[ i ] );
+    }
+  trace.info() << "Scores in [" << minScore << "," << maxScore << "]"
+               << ", max error = " << maxError << std::endl;
+  nbok += ( maxError < 1e-8 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Same scores as TensorVotingFeatureExtraction" << std::endl;
+
+  nbok += ( std::abs( batch.eval( surfels[ 7 ] ) - scores[ 7 ] ) == 0.0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Single surfel evaluation" << std::endl;
+
+#ifdef WITH_OPENMP
+  const int nbThreads = omp_get_max_threads();
+  omp_set_num_threads( 3 );
+  std::vector<double> scores3;
+  batch.eval( surfels.begin(), surfels.end(), std::back_inserter( scores3 ) );
+  omp_set_num_threads( nbThreads );
+  nbok += ( scores3 == scores ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Same scores with 3 threads" << std::endl;
+#endif
+
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class BatchTensorVotingFeatureExtraction" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testEigenValues()
+    && testBatchScores<ImplicitHyperCube<Z3i::Space> >( "cube", 2.0 )
+    && testBatchScores<ImplicitBall<Z3i::Space> >( "ball", 3.5 );
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,291 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testJetFitting.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class JetFitting, the jet fitting estimators
+ * and OrientedSphereFittingEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/CanonicSCellEmbedder.h"
+#include "DGtal/topology/LightImplicitDigitalSurface.h"
+#include "DGtal/geometry/volumes/distance/ExactPredicateLpSeparableMetric.h"
+#include "DGtal/geometry/surfaces/estimation/LocalEstimatorFromSurfelFunctorAdapter.h"
+#include "DGtal/geometry/surfaces/estimation/EstimatorCache.h"
+#include "DGtal/geometry/surfaces/estimation/JetFitting.h"
+#include "DGtal/geometry/surfaces/estimation/estimationFunctors/JetFittingEstimators.h"
+#include "DGtal/geometry/surfaces/estimation/estimationFunctors/OrientedSphereFittingEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/estimationFunctors/ElementaryConvolutionNormalVectorEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class JetFitting.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Samples of z = (k1 x^2 + k2 y^2) / 2, plus cubic terms for degrees
+ * above 2, in a rotated and translated frame, whose curvatures at the
+ * origin are k1 and k2. The fit is exact for the quadric, and
+ * approximate otherwise since the height is taken along the smallest
+ * principal axis of the points.
+ */
+bool testParaboloid()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing jet fitting on a paraboloid ..." );
+
+  const double k1 = 0.5;
+  const double k2 = -0.2;
+  const double step = 0.05;
+  const Eigen::Matrix3d rotation( Eigen::AngleAxisd( 0.7, Eigen::Vector3d( 1, 2, 3 ).normalized() ) );
+  const Eigen::Vector3d translation( 10, -3, 4 );
+  const Eigen::Vector3d expected_normal = rotation.col( 2 );
+
+  JetFitting<Z3i::RealPoint> fitting;
+  for ( unsigned int degree = 2; degree <= 4; ++degree )
+    {
+      const double tolerance = degree == 2 ? 1e-8 : 2e-2;
+      fitting.reset();
+      fitting.push( Z3i::RealPoint( translation(0), translation(1), translation(2) ) );
+      for ( int i = -5; i <= 5; ++i )
+        for ( int j = -5; j <= 5; ++j )
+          {
+            if ( i == 0 && j == 0 ) continue;
+            const double x = i * step;
+            const double y = j * step;
+            const double cubic = degree > 2 ? x*x*x + x*y*y : 0.;
+            const Eigen::Vector3d local( x, y, ( k1*x*x + k2*y*y ) / 2 + cubic );
+            const Eigen::Vector3d point = rotation * local + translation;
+            fitting.push( Z3i::RealPoint( point(0), point(1), point(2) ) );
+          }
+      const bool ok = fitting.fit( degree );
+      const Z3i::RealPoint normal = fitting.normal();
+      const double cosine = normal[0]*expected_normal(0) + normal[1]*expected_normal(1) + normal[2]*expected_normal(2);
+      // the orientation is arbitrary
+      const double sign = cosine < 0 ? -1. : 1.;
+      const std::pair<double, double> curvatures = fitting.principalCurvatures();
+      trace.info() << fitting << std::endl;
+      nbok += ok && fitting.size() == 11*11 && fitting.degree() == degree ? 1 : 0;
+      nb++;
+      nbok += std::abs( std::abs( cosine ) - 1 ) < tolerance ? 1 : 0;
+      nb++;
+      nbok += std::abs( sign * fitting.meanCurvature() - ( k1 + k2 ) / 2 ) < tolerance ? 1 : 0;
+      nb++;
+      nbok += std::abs( fitting.gaussianCurvature() - k1 * k2 ) < tolerance ? 1 : 0;
+      nb++;
+      nbok += std::abs( ( sign > 0 ? curvatures.first : -curvatures.second ) - k1 ) < tolerance ? 1 : 0;
+      nb++;
+    }
+
+  // too few points for the degree
+  fitting.reset();
+  for ( int i = 0; i < 8; ++i )
+    fitting.push( Z3i::RealPoint( i % 3, i / 3, 0.1 * i ) );
+  nbok += fitting.fit( 4 ) && fitting.degree() == 2 ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "curvatures of exact paraboloids" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Jet fitting and sphere fitting estimators on a digitized ball,
+ * evaluated sequentially and in parallel.
+ */
+bool testDigitalSphere()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing estimators on a digital sphere ..." );
+
+  using namespace Z3i;
+
+  const double radius = 12.0;
+  Point p1( -20, -20, -20 );
+  Point p2( 20, 20, 20 );
+  const RealPoint center( 0.5, 0.2, 0 );
+  ImplicitBall<Z3i::Space> shape( center, radius );
+  typedef GaussDigitizer<Z3i::Space, ImplicitBall<Z3i::Space> > Gauss;
+  Gauss gauss;
+  gauss.attach( shape );
+  gauss.init( p1, p2, 1 );
+
+  typedef LightImplicitDigitalSurface<KSpace, Gauss> SurfaceContainer;
+  typedef DigitalSurface<SurfaceContainer> Surface;
+  typedef Surface::Surfel Surfel;
+
+  KSpace K;
+  nbok += K.init( p1, p2, true ) ? 1 : 0;
+  nb++;
+  Surfel bel = Surfaces<KSpace>::findABel( K, gauss, 10000 );
+  SurfaceContainer* surfaceContainer = new SurfaceContainer
+    ( K, gauss, SurfelAdjacency<KSpace::dimension>( true ), bel );
+  Surface surface( surfaceContainer ); // acquired
+  CanonicSCellEmbedder<KSpace> embedder( surface.container().space() );
+  std::vector<Surfel> surfels( surface.begin(), surface.end() );
+  trace.info() << "surface size=" << surfels.size() << std::endl;
+
+  typedef functors::ConstValue< double > ConvFunctor;
+  ConvFunctor convFunc( 1.0 );
+  const double kernelRadius = 6.0;
+  const unsigned int degree = 2;
+
+  // mean curvature
+  typedef functors::JetFittingMeanCurvatureEstimator<Surfel, CanonicSCellEmbedder<KSpace> > FunctorMean;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<SurfaceContainer, Z3i::L2Metric, FunctorMean, ConvFunctor> ReporterMean;
+  FunctorMean functorMean( embedder, 1.0, degree );
+  ReporterMean reporterMean( surface, l2Metric, functorMean, convFunc );
+  reporterMean.setParams( l2Metric, functorMean, convFunc, kernelRadius );
+  reporterMean.init( 1.0, surfels.begin(), surfels.end() );
+  std::vector<double> means;
+  reporterMean.eval( surfels.begin(), surfels.end(), std::back_inserter( means ) );
+  std::vector<double> parallelMeans;
+  reporterMean.evalParallel( surfels.begin(), surfels.end(), std::back_inserter( parallelMeans ) );
+  double meanError = 0;
+  for ( std::size_t i = 0; i < means.size(); ++i )
+    meanError += std::abs( std::abs( means[ i ] ) - 1. / radius );
+  meanError /= means.size() / radius;
+  trace.info() << "average relative mean curvature error=" << meanError << std::endl;
+  nbok += meanError < 0.1 ? 1 : 0;
+  nb++;
+  trace.info() << "parallel evaluation is " << ( means == parallelMeans ? "identical" : "different" ) << std::endl;
+  nbok += means == parallelMeans ? 1 : 0;
+  nb++;
+
+  // gaussian curvature
+  typedef functors::JetFittingGaussianCurvatureEstimator<Surfel, CanonicSCellEmbedder<KSpace> > FunctorGaussian;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<SurfaceContainer, Z3i::L2Metric, FunctorGaussian, ConvFunctor> ReporterGaussian;
+  FunctorGaussian functorGaussian( embedder, 1.0, degree );
+  ReporterGaussian reporterGaussian( surface, l2Metric, functorGaussian, convFunc );
+  reporterGaussian.setParams( l2Metric, functorGaussian, convFunc, kernelRadius );
+  reporterGaussian.init( 1.0, surfels.begin(), surfels.end() );
+  std::vector<double> gaussians;
+  reporterGaussian.evalParallel( surfels.begin(), surfels.end(), std::back_inserter( gaussians ) );
+  double gaussianError = 0;
+  for ( std::size_t i = 0; i < gaussians.size(); ++i )
+    gaussianError += std::abs( gaussians[ i ] - 1. / ( radius * radius ) );
+  gaussianError /= gaussians.size() / ( radius * radius );
+  trace.info() << "average relative gaussian curvature error=" << gaussianError << std::endl;
+  nbok += gaussianError < 0.2 ? 1 : 0;
+  nb++;
+
+  // normal vector
+  typedef functors::JetFittingNormalVectorEstimator<Surfel, CanonicSCellEmbedder<KSpace> > FunctorNormal;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<SurfaceContainer, Z3i::L2Metric, FunctorNormal, ConvFunctor> ReporterNormal;
+  FunctorNormal functorNormal( embedder, 1.0, degree );
+  ReporterNormal reporterNormal( surface, l2Metric, functorNormal, convFunc );
+  reporterNormal.setParams( l2Metric, functorNormal, convFunc, kernelRadius );
+  reporterNormal.init( 1.0, surfels.begin(), surfels.end() );
+  std::vector<RealPoint> normals;
+  reporterNormal.evalParallel( surfels.begin(), surfels.end(), std::back_inserter( normals ) );
+  double minCosine = 1;
+  for ( std::size_t i = 0; i < normals.size(); ++i )
+    {
+      const RealPoint radial = embedder( surfels[ i ] ) - center;
+      minCosine = std::min( minCosine, std::abs( normals[ i ].dot( radial ) ) / radial.norm() );
+    }
+  trace.info() << "minimal cosine to the radial direction=" << minCosine << std::endl;
+  nbok += minCosine > 0.95 ? 1 : 0;
+  nb++;
+
+  // sphere fitting
+  typedef functors::ElementaryConvolutionNormalVectorEstimator<Surfel, CanonicSCellEmbedder<KSpace> > FunctorConvolution;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<SurfaceContainer, Z3i::L2Metric,
+                                                 FunctorConvolution,
+                                                 DGtal::functors::GaussianKernel> ReporterConvolution;
+  typedef EstimatorCache<ReporterConvolution> NormalCache;
+  DGtal::functors::GaussianKernel gaussKernelFunc( 5.0 );
+  FunctorConvolution functorConvolution( embedder, 1.0 );
+  ReporterConvolution reporterConvolution;
+  reporterConvolution.attach( surface );
+  reporterConvolution.setParams( l2Metric, functorConvolution, gaussKernelFunc, 5.0 );
+  NormalCache normalCache( reporterConvolution );
+  normalCache.init( 1, surface.begin(), surface.end() );
+
+  typedef functors::OrientedSphereFittingEstimator<Surfel, CanonicSCellEmbedder<KSpace>, NormalCache> FunctorSphere;
+  typedef LocalEstimatorFromSurfelFunctorAdapter<SurfaceContainer, Z3i::L2Metric, FunctorSphere, ConvFunctor> ReporterSphere;
+  FunctorSphere fitter( embedder, 1.0, kernelRadius, normalCache );
+  ReporterSphere reporterSphere;
+  reporterSphere.attach( surface );
+  reporterSphere.setParams( l2Metric, fitter, convFunc, kernelRadius );
+  reporterSphere.init( 1, surfels.begin(), surfels.end() );
+  std::vector<FunctorSphere::Quantity> spheres;
+  reporterSphere.evalParallel( surfels.begin(), surfels.end(), std::back_inserter( spheres ) );
+  double radiusError = 0;
+  double centerError = 0;
+  for ( std::size_t i = 0; i < spheres.size(); ++i )
+    {
+      radiusError += std::abs( spheres[ i ].radius - radius );
+      centerError += ( spheres[ i ].center - center ).norm();
+    }
+  radiusError /= spheres.size() * radius;
+  centerError /= spheres.size();
+  const FunctorSphere::Quantity sphere = reporterSphere.eval( surfels.begin() );
+  trace.info() << "average relative radius error=" << radiusError
+               << " average center error=" << centerError
+               << " first sphere center=" << sphere.center << " radius=" << sphere.radius
+               << " kappa=" << sphere.kappa << std::endl;
+  nbok += radiusError < 0.1 && centerError < 1.0 ? 1 : 0;
+  nb++;
+  nbok += sphere == spheres.front() && std::abs( std::abs( sphere.kappa ) - 1. / sphere.radius ) < 1e-8 ? 1 : 0;
+  nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "estimations on a digital sphere" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class JetFitting" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testParaboloid() && testDigitalSphere();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
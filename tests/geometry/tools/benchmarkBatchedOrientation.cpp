@@ -0,0 +1,206 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the orientation tests of InHalfPlaneBy2x2DetComputer,
+ * one point at a time or batched (InHalfPlaneBy2x2DetComputer::signs),
+ * and of the Andrew convex hull algorithm, with and without the split
+ * of the points by batched orientation tests, with the Akl-Toussaint
+ * filter, in parallel and in streaming mode, on up to 10^7 points.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/kernel/PointVector.h"
+#include "DGtal/geometry/tools/Hull2DHelpers.h"
+#include "DGtal/geometry/tools/determinant/AvnaimEtAl2x2DetSignComputer.h"
+#include "DGtal/geometry/tools/determinant/Simple2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBy2x2DetComputer.h"
+#include "DGtal/geometry/tools/determinant/InHalfPlaneBySimple3x3Matrix.h"
+#include "DGtal/geometry/tools/determinant/PredicateFromOrientationFunctor2.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef PointVector<2, DGtal::int32_t> Point;
+
+/// aSize random points in a square of side 2^20.
+static std::vector<Point> makePoints( unsigned int aSize )
+{
+  std::vector<Point> points;
+  points.reserve( aSize );
+  srand( 0 );
+  for ( unsigned int i = 0; i < aSize; ++i )
+    points.push_back( Point( rand() % ( 1 << 20 ), rand() % ( 1 << 20 ) ) );
+  return points;
+}
+
+template <typename DetComputer>
+static void BM_Orientation(benchmark::State& state)
+{
+  typedef InHalfPlaneBy2x2DetComputer<Point, DetComputer> Functor;
+  const std::vector<Point> points = makePoints( state.range(0) );
+  std::vector<int> signs( points.size() );
+  Functor f;
+  f.init( Point( 0, 0 ), Point( 1 << 20, 1 << 19 ) );
+  while (state.KeepRunning())
+    {
+      for ( std::size_t i = 0; i < points.size(); ++i )
+        {
+          const typename Functor::Value v = f( points[ i ] );
+          signs[ i ] = ( v > 0 ) - ( v < 0 );
+        }
+      benchmark::DoNotOptimize( signs.data() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*points.size());
+}
+BENCHMARK_TEMPLATE(BM_Orientation, AvnaimEtAl2x2DetSignComputer<double>)->Arg(10000000);
+BENCHMARK_TEMPLATE(BM_Orientation, Simple2x2DetComputer<DGtal::int64_t>)->Arg(10000000);
+
+template <typename DetComputer>
+static void BM_BatchedOrientation(benchmark::State& state)
+{
+  typedef InHalfPlaneBy2x2DetComputer<Point, DetComputer> Functor;
+  const std::vector<Point> points = makePoints( state.range(0) );
+  std::vector<int> signs( points.size() );
+  Functor f;
+  f.init( Point( 0, 0 ), Point( 1 << 20, 1 << 19 ) );
+  while (state.KeepRunning())
+    {
+      f.signs( points.begin(), points.end(), signs.begin() );
+      benchmark::DoNotOptimize( signs.data() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*points.size());
+}
+BENCHMARK_TEMPLATE(BM_BatchedOrientation, AvnaimEtAl2x2DetSignComputer<double>)->Arg(10000000);
+BENCHMARK_TEMPLATE(BM_BatchedOrientation, Simple2x2DetComputer<DGtal::int64_t>)->Arg(10000000);
+
+typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> HullFunctor;
+typedef PredicateFromOrientationFunctor2<HullFunctor> HullPredicate;
+
+/// Andrew algorithm without the split of the points
+static void BM_AndrewHullUnsplit(benchmark::State& state)
+{
+  const std::vector<Point> points = makePoints( state.range(0) );
+  HullFunctor functor;
+  HullPredicate predicate( functor );
+  std::vector<Point> container, lower, upper;
+  while (state.KeepRunning())
+    {
+      container = points;
+      lower.clear(); upper.clear();
+      std::sort( container.begin(), container.end() );
+      functions::Hull2D::openGrahamScan( container.begin(), container.end(),
+                                         std::back_inserter( lower ), predicate );
+      functions::Hull2D::openGrahamScan( container.rbegin(), container.rend(),
+                                         std::back_inserter( upper ), predicate );
+      benchmark::DoNotOptimize( lower.size() + upper.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*points.size());
+}
+BENCHMARK(BM_AndrewHullUnsplit)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+static void BM_AndrewHull(benchmark::State& state)
+{
+  const std::vector<Point> points = makePoints( state.range(0) );
+  HullFunctor functor;
+  HullPredicate predicate( functor );
+  std::vector<Point> hull;
+  while (state.KeepRunning())
+    {
+      hull.clear();
+      functions::Hull2D::andrewConvexHullAlgorithm( points.begin(), points.end(),
+                                                    std::back_inserter( hull ), predicate );
+      benchmark::DoNotOptimize( hull.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*points.size());
+}
+BENCHMARK(BM_AndrewHull)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+static void BM_AklToussaintFilter(benchmark::State& state)
+{
+  const std::vector<Point> points = makePoints( state.range(0) );
+  std::vector<Point> remaining;
+  while (state.KeepRunning())
+    {
+      remaining.clear();
+      functions::Hull2D::aklToussaintFilter( points.begin(), points.end(),
+                                             std::back_inserter( remaining ) );
+      benchmark::DoNotOptimize( remaining.size() );
+    }
+  state.counters["remaining"] = remaining.size();
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*points.size());
+}
+BENCHMARK(BM_AklToussaintFilter)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+static void BM_AndrewHullParallel(benchmark::State& state)
+{
+  const std::vector<Point> points = makePoints( state.range(0) );
+  HullFunctor functor;
+  HullPredicate predicate( functor );
+  std::vector<Point> hull;
+  while (state.KeepRunning())
+    {
+      hull.clear();
+      functions::Hull2D::andrewConvexHullAlgorithmParallel( points.begin(), points.end(),
+                                                            std::back_inserter( hull ), predicate );
+      benchmark::DoNotOptimize( hull.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*points.size());
+}
+BENCHMARK(BM_AndrewHullParallel)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+static void BM_StreamingHull(benchmark::State& state)
+{
+  const std::vector<Point> points = makePoints( state.range(0) );
+  HullFunctor functor;
+  HullPredicate predicate( functor );
+  std::vector<Point> hull;
+  while (state.KeepRunning())
+    {
+      hull.clear();
+      functions::Hull2D::streamingConvexHullAlgorithm( points.begin(), points.end(),
+                                                       std::back_inserter( hull ), predicate );
+      benchmark::DoNotOptimize( hull.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*points.size());
+}
+BENCHMARK(BM_StreamingHull)->Arg(1000000)->Arg(10000000)->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -28,7 +28,9 @@
  */
 
 ///////////////////////////////////////////////////////////////////////////////
+#include <cstdlib>
 #include <iostream>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/kernel/PointVector.h"
 
@@ -91,6 +93,63 @@ bool testInHalfPlane(OrientationFunctor f)
   return nbok == nb;
 }
 
+/**
+ * Compares the batched orientation tests with the pointwise ones, for
+ * points in general position and points close to the line, whose
+ * orientation cannot be certified by the floating-point filter.
+ * @param aMax maximal absolute value of the coordinates
+ * @tparam OrientationFunctor a model of InHalfPlaneBy2x2DetComputer
+ */
+template<typename OrientationFunctor>
+bool testBatchedInHalfPlane(DGtal::int64_t aMax)
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  
+  trace.beginBlock ( "Testing block: batched orientation tests" );
+  typedef typename OrientationFunctor::Value Value; 
+  typedef typename OrientationFunctor::Point Point; 
+  typedef typename Point::Coordinate Coordinate; 
+  srand( 0 );
+  for ( unsigned int t = 0; t < 20; ++t )
+    {
+      const Point a( static_cast<Coordinate>( ( rand() % 2001 - 1000 ) * ( aMax / 1000 ) ), 
+                     static_cast<Coordinate>( ( rand() % 2001 - 1000 ) * ( aMax / 1000 ) ) ); 
+      const Point u( rand() % 201 - 100, rand() % 201 - 100 ); 
+      const Point b = a + u * static_cast<Coordinate>( aMax / 1000 ); 
+      std::vector<Point> points; 
+      for ( unsigned int i = 0; i < 100; ++i )
+        { // points close to the line (a,b)
+          const Coordinate k = static_cast<Coordinate>( rand() % 2001 - 1000 ) * ( aMax / 2000 ); 
+          points.push_back( a + u * k / 100 + Point( rand() % 3 - 1, rand() % 3 - 1 ) ); 
+        }
+      for ( unsigned int i = 0; i < 101; ++i )
+        points.push_back( Point( static_cast<Coordinate>( ( rand() % 2001 - 1000 ) * ( aMax / 1000 ) ), 
+                                 static_cast<Coordinate>( ( rand() % 2001 - 1000 ) * ( aMax / 1000 ) ) ) ); 
+      points.push_back( a ); 
+      points.push_back( b ); 
+      points.push_back( b + u * static_cast<Coordinate>( aMax / 1000 ) + Point( 0, 1 ) ); 
+
+      OrientationFunctor f; 
+      f.init( a, b ); 
+      std::vector<int> signs( points.size() ); 
+      f.signs( points.begin(), points.end(), signs.begin() ); 
+      bool ok = true; 
+      for ( unsigned int i = 0; i < points.size(); ++i )
+        {
+          const Value v = f( points[ i ] ); 
+          const int expected = ( v > NumberTraits<Value>::ZERO ) ? 1 : ( ( v < NumberTraits<Value>::ZERO ) ? -1 : 0 ); 
+          ok = ok && ( signs[ i ] == expected ); 
+        }
+      nbok += ok ? 1 : 0; 
+      nb++; 
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+  trace.endBlock();
+  
+  return nbok == nb;
+}
+
 /**
  * Example of a test. To be completed.
  */
@@ -285,6 +344,19 @@ int main( int argc, char** argv )
   typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int32_t> Functor2; 
   res = res && testInHalfPlane( Functor2() );
 
+  typedef PointVector<2, DGtal::int32_t> Point32; 
+  typedef InHalfPlaneBy2x2DetComputer<Point32, Simple2x2DetComputer<DGtal::int64_t> > Functor3; 
+  res = res && testBatchedInHalfPlane<Functor3>( 1000 )
+    && testBatchedInHalfPlane<Functor3>( 1000000000 ); 
+
+  typedef PointVector<2, DGtal::int64_t> Point64; 
+  typedef InHalfPlaneBy2x2DetComputer<Point64, AvnaimEtAl2x2DetSignComputer<double> > Functor4; 
+  res = res && testBatchedInHalfPlane<Functor4>( 1000000000000000LL ); 
+#ifdef WITH_BIGINTEGER
+  typedef InHalfPlaneBy2x2DetComputer<Point64, Simple2x2DetComputer<DGtal::BigInteger> > Functor5; 
+  res = res && testBatchedInHalfPlane<Functor5>( 1000000000000000000LL ); 
+#endif
+
   res = res && testInGeneralizedDiskOfGivenRadius(); 
 
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
@@ -259,6 +259,17 @@ bool testConvexHull2D()
 	nbok++; 
       nb++; 
       trace.info() << "(" << nbok << "/" << nb << ") " << endl;
+      //computation with a clockwise predicate
+      res2.clear(); 
+      PredicateFromOrientationFunctor2<Functor, true, false> cwPredicate( functor ); 
+      andrewConvexHullAlgorithm( randomData.begin(), randomData.end(), back_inserter( res2 ), cwPredicate );   
+      //comparison
+      reverse( res2.begin(), res2.end() ); 
+      if ( (res1.size() == res2.size()) && 
+	   (circularlyEqual(res1.begin(), res1.end(), res2.begin(), res2.end())) )
+	nbok++; 
+      nb++; 
+      trace.info() << "(" << nbok << "/" << nb << ") " << endl;
     }
 
   trace.endBlock();
@@ -330,6 +341,224 @@ bool testConvexHullCompThickness()
   return nb==nbok;
 }
 
+/**
+ * Testing the Akl-Toussaint filter and the parallel and streaming
+ * convex hull computations against the Andrew algorithm.
+ * @return 'true' if passed.
+ */
+bool testFilteredConvexHulls2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef PointVector<2,DGtal::int32_t> Point;
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+  Functor functor;
+  PredicateFromOrientationFunctor2<Functor> predicate( functor );
+  PredicateFromOrientationFunctor2<Functor, true, false> cwPredicate( functor );
+
+  trace.beginBlock ( "Akl-Toussaint filter, parallel and streaming hulls..." );
+  srand( 0 );
+  for ( unsigned int t = 0; t < 4; ++t )
+    {
+      //random points in a disk (t even) or a square with many collinear points (t odd)
+      vector<Point> data;
+      for ( unsigned int i = 0; i < 20000; ++i )
+        {
+          Point p( rand() % 2001 - 1000, rand() % 2001 - 1000 );
+          if ( ( t % 2 == 1 ) || ( p.norm() <= 1000 ) )
+            data.push_back( p );
+        }
+
+      vector<Point> octagon, filtered;
+      functions::Hull2D::computeAklToussaintOctagon( data.begin(), data.end(), octagon );
+      functions::Hull2D::aklToussaintFilter( data.begin(), data.end(), back_inserter( filtered ) );
+      trace.info() << data.size() << " points, " << octagon.size() << " vertices, "
+                   << filtered.size() << " after filtering" << std::endl;
+
+      vector<Point> g, gCw;
+      functions::Hull2D::andrewConvexHullAlgorithm( data.begin(), data.end(), back_inserter( g ), predicate );
+      functions::Hull2D::andrewConvexHullAlgorithm( data.begin(), data.end(), back_inserter( gCw ), cwPredicate );
+
+      //all the vertices of the hull are kept
+      bool kept = ( octagon.size() > 2 ) && ( filtered.size() < data.size() );
+      for ( vector<Point>::const_iterator it = g.begin(); it != g.end(); ++it )
+        kept = kept && ( find( filtered.begin(), filtered.end(), *it ) != filtered.end() );
+      nbok += kept ? 1 : 0; nb++;
+
+      const unsigned int sizes[] = { 1, 3, 16, 1000, 0 };
+      for ( unsigned int k = 0; k < 5; ++k )
+        {
+          vector<Point> res, resCw, res2, res2Cw;
+          functions::Hull2D::andrewConvexHullAlgorithmParallel( data.begin(), data.end(), back_inserter( res ), predicate, sizes[ k ] );
+          functions::Hull2D::andrewConvexHullAlgorithmParallel( data.begin(), data.end(), back_inserter( resCw ), cwPredicate, sizes[ k ] );
+          functions::Hull2D::streamingConvexHullAlgorithm( data.begin(), data.end(), back_inserter( res2 ), predicate, sizes[ k ] );
+          functions::Hull2D::streamingConvexHullAlgorithm( data.begin(), data.end(), back_inserter( res2Cw ), cwPredicate, sizes[ k ] );
+          nbok += ( res == g ) && ( resCw == gCw ) && ( res2 == g ) && ( res2Cw == gCw ) ? 1 : 0;
+          nb++;
+        }
+
+      //the thickness of the output hull is available as usual
+      const double th = functions::Hull2D::computeHullThickness( g.begin(), g.end(), functions::Hull2D::EuclideanThickness );
+      vector<Point> res;
+      functions::Hull2D::andrewConvexHullAlgorithmParallel( data.begin(), data.end(), back_inserter( res ), predicate );
+      nbok += ( th > 0 ) && ( th == functions::Hull2D::computeHullThickness( res.begin(), res.end(), functions::Hull2D::EuclideanThickness ) ) ? 1 : 0;
+      nb++;
+      trace.info() << g.size() << " hull vertices, thickness " << th << std::endl;
+      trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+    }
+
+  //degenerate inputs
+  vector<Point> data, octagon, res, res2;
+  functions::Hull2D::computeAklToussaintOctagon( data.begin(), data.end(), octagon );
+  functions::Hull2D::andrewConvexHullAlgorithmParallel( data.begin(), data.end(), back_inserter( res ), predicate );
+  nbok += octagon.empty() && res.empty() ? 1 : 0; nb++;
+  for ( int i = 0; i < 10; ++i )
+    data.push_back( Point( i, 2 * i ) );
+  functions::Hull2D::computeAklToussaintOctagon( data.begin(), data.end(), octagon );
+  functions::Hull2D::andrewConvexHullAlgorithmParallel( data.begin(), data.end(), back_inserter( res ), predicate, 3 );
+  functions::Hull2D::streamingConvexHullAlgorithm( data.begin(), data.end(), back_inserter( res2 ), predicate, 4 );
+  nbok += ( octagon.size() == 2 ) && ( res.size() == 2 ) && ( res2 == res ) ? 1 : 0; nb++;
+  //a chunk or a buffer of equal points
+  data.assign( 40, Point( 5, 5 ) );
+  data.push_back( Point( 0, 0 ) );
+  data.push_back( Point( 9, 1 ) );
+  res.clear(); res2.clear();
+  functions::Hull2D::andrewConvexHullAlgorithmParallel( data.begin(), data.end(), back_inserter( res ), predicate, 4 );
+  functions::Hull2D::streamingConvexHullAlgorithm( data.begin(), data.end(), back_inserter( res2 ), predicate, 16 );
+  nbok += ( res.size() == 3 ) && ( res2 == res ) ? 1 : 0; nb++;
+
+  //floating-point coordinates: no filtering, same hull
+  typedef PointVector<2,double> RealPoint;
+  typedef InHalfPlaneBySimple3x3Matrix<RealPoint, double> RealFunctor;
+  RealFunctor realFunctor;
+  PredicateFromOrientationFunctor2<RealFunctor> realPredicate( realFunctor );
+  vector<RealPoint> realData, realOctagon, realFiltered, realRes;
+  for ( unsigned int i = 0; i < 1000; ++i )
+    realData.push_back( RealPoint( rand() % 201 - 100, rand() % 201 - 100 ) );
+  functions::Hull2D::computeAklToussaintOctagon( realData.begin(), realData.end(), realOctagon );
+  functions::Hull2D::aklToussaintFilter( realData.begin(), realData.end(), realOctagon, back_inserter( realFiltered ) );
+  nbok += ( realOctagon.size() > 2 ) && ( realFiltered == realData ) ? 1 : 0; nb++;
+  data.clear(); res.clear();
+  for ( unsigned int i = 0; i < realData.size(); ++i )
+    data.push_back( Point( (int) realData[ i ][ 0 ], (int) realData[ i ][ 1 ] ) );
+  functions::Hull2D::andrewConvexHullAlgorithm( data.begin(), data.end(), back_inserter( res ), predicate );
+  functions::Hull2D::andrewConvexHullAlgorithmParallel( realData.begin(), realData.end(), back_inserter( realRes ), realPredicate, 3 );
+  bool same = ( realRes.size() == res.size() );
+  for ( unsigned int i = 0; same && ( i < res.size() ); ++i )
+    same = ( realRes[ i ] == RealPoint( res[ i ][ 0 ], res[ i ][ 1 ] ) );
+  nbok += same ? 1 : 0; nb++;
+
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Testing the vertices and the kept points computed by
+ * MelkmanConvexHull without any update against add().
+ * @return 'true' if passed.
+ */
+bool testMelkmanHullAfterAdding()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef PointVector<2,DGtal::int32_t> Point;
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+
+  trace.beginBlock ( "Melkman convex hull after adding a point..." );
+  srand( 0 );
+  for ( unsigned int i = 0; i < 20; ++i )
+    {
+      DGtal::MelkmanConvexHull<Point, Functor> ch;
+      vector<Point> vertices;
+      bool ok = true;
+      for ( unsigned int j = 0; j < 500; ++j )
+        {
+          Point p( j / 2 + rand() % ( 3 + i ), j / 3 + rand() % ( 3 + i ) );
+          std::size_t first, last;
+          bool isKept = ch.pointsKeptByAdding( p, first, last );
+          bool isChanged = ch.hullAfterAdding( p, vertices );
+          DGtal::MelkmanConvexHull<Point, Functor> ch2( ch );
+          ch2.add( p );
+          vector<Point> res( ch2.begin(), ch2.end() );
+          if ( isChanged )
+            ok = ok && ( vertices == res );
+          else
+            ok = ok && vector<Point>( ch.begin(), ch.end() ) == res;
+          if ( isKept && isChanged )
+            ok = ok && ( res.size() == last - first + 2 ) && ( res[ 0 ] == ch[ first ] )
+              && ( res[ res.size() - 2 ] == ch[ last ] ) && ( res.back() == p );
+          ok = ok && ( isChanged || isKept );
+          ch = ch2;
+        }
+      nbok += ok ? 1 : 0; nb++;
+    }
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+#ifdef WITH_BIGINTEGER
+/**
+ * Testing the convex hull computations with unbounded coordinates,
+ * for which the batched orientation tests do not apply.
+ * @return 'true' if passed.
+ */
+bool testBigIntegerConvexHulls2D()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  typedef PointVector<2,DGtal::int32_t> Point;
+  typedef PointVector<2,DGtal::BigInteger> BigPoint;
+  typedef InHalfPlaneBySimple3x3Matrix<Point, DGtal::int64_t> Functor;
+  Functor functor;
+  PredicateFromOrientationFunctor2<Functor> predicate( functor );
+  typedef InHalfPlaneBySimple3x3Matrix<BigPoint, DGtal::BigInteger> BigFunctor;
+  BigFunctor bigFunctor;
+  PredicateFromOrientationFunctor2<BigFunctor> bigPredicate( bigFunctor );
+
+  trace.beginBlock ( "Convex hulls with BigInteger coordinates..." );
+  srand( 0 );
+  vector<Point> data;
+  vector<BigPoint> bigData;
+  for ( unsigned int i = 0; i < 2000; ++i )
+    {
+      Point p( rand() % 2001 - 1000, rand() % 2001 - 1000 );
+      data.push_back( p );
+      bigData.push_back( BigPoint( p[ 0 ], p[ 1 ] ) );
+    }
+
+  vector<Point> g;
+  functions::Hull2D::andrewConvexHullAlgorithm( data.begin(), data.end(), back_inserter( g ), predicate );
+  vector<BigPoint> res;
+  functions::Hull2D::andrewConvexHullAlgorithm( bigData.begin(), bigData.end(), back_inserter( res ), bigPredicate );
+  bool same = ( res.size() == g.size() );
+  for ( unsigned int i = 0; same && ( i < g.size() ); ++i )
+    same = ( res[ i ] == BigPoint( g[ i ][ 0 ], g[ i ][ 1 ] ) );
+  nbok += same ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "andrewConvexHullAlgorithm" << std::endl;
+
+  vector<BigPoint> firstChain, secondChain;
+  nbok += ( functions::Hull2D::splitPointsByChord( bigData, bigData[ 0 ], bigData[ 1 ], bigPredicate,
+                                                    firstChain, secondChain ) == 0 )
+    && firstChain.empty() && secondChain.empty() ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no split without batched orientation tests" << std::endl;
+
+  vector<BigPoint> octagon, filtered, res2;
+  functions::Hull2D::computeAklToussaintOctagon( bigData.begin(), bigData.end(), octagon );
+  functions::Hull2D::aklToussaintFilter( bigData.begin(), bigData.end(), octagon, back_inserter( filtered ) );
+  functions::Hull2D::andrewConvexHullAlgorithmParallel( bigData.begin(), bigData.end(), back_inserter( res2 ), bigPredicate, 4 );
+  nbok += ( octagon.size() > 2 ) && ( filtered == bigData ) && ( res2 == res ) ? 1 : 0; nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no filtering without batched orientation tests" << std::endl;
+
+  trace.endBlock();
+  return nbok == nb;
+}
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -341,7 +570,11 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testConvexHull2D() &&testConvexHullCompThickness();
+  bool res = testConvexHull2D() &&testConvexHullCompThickness()
+    && testFilteredConvexHulls2D() && testMelkmanHullAfterAdding();
+#ifdef WITH_BIGINTEGER
+  res = res && testBigIntegerConvexHulls2D();
+#endif
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
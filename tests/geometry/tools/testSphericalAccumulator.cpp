@@ -29,6 +29,9 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <cmath>
+#include <cstdlib>
+#include <vector>
 #include "DGtal/base/Common.h"
 #include "DGtal/helpers/StdDefs.h"
 #include "DGtal/geometry/tools/SphericalAccumulator.h"
@@ -199,6 +202,169 @@ bool testSphericalMoreIntegerDir()
   return nbok == nb;
 }
 
+
+/**
+ * Bin coordinates of a direction with acos and atan2, as originally
+ * computed by SphericalAccumulator.
+ */
+template <typename Vector>
+void referenceBinCoordinates(const Vector &aDir, const unsigned int nPhi,
+                             unsigned int &posPhi, unsigned int &posTheta)
+{
+  const double x = NumberTraits<typename Vector::Component>::castToDouble(aDir[0]);
+  const double y = NumberTraits<typename Vector::Component>::castToDouble(aDir[1]);
+  const double z = NumberTraits<typename Vector::Component>::castToDouble(aDir[2]);
+  const double phi = acos(z/aDir.norm());
+  const double dphi = M_PI/(double)(nPhi-1);
+  posPhi = static_cast<unsigned int>(floor( (phi+dphi/2.) *(nPhi-1)/  M_PI));
+  posTheta = 0;
+  if(posPhi == 0 || posPhi== (nPhi-1))
+    return;
+  double theta = atan2(y, x);
+  if (theta < 0)
+    theta += 2.0*M_PI;
+  const double Nthetai = floor(2.0*(nPhi)*sin(posPhi*dphi));
+  const double dtheta = 2.0*M_PI/(Nthetai);
+  posTheta = static_cast<unsigned int>(floor( (theta+dtheta/2.0)/dtheta));
+  if (posTheta >= Nthetai)
+    posTheta -= static_cast<unsigned int>(Nthetai);
+}
+
+bool testSphericalBinningAndBatches()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing Spherical Accumulator binning, batches and merge ..." );
+
+  typedef Z3i::Vector Vector;
+  typedef Z3i::RealVector RealVector;
+  typedef SphericalAccumulator<Vector>::Size Size;
+
+  // Random directions, and directions on or close to bin boundaries.
+  srand( 0 );
+  std::vector<Vector> directions;
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      Vector v( rand() % 201 - 100, rand() % 201 - 100, rand() % 201 - 100 );
+      if ( v != Vector::zero )
+        directions.push_back( v );
+    }
+  for ( int x = -3; x <= 3; ++x )
+    for ( int y = -3; y <= 3; ++y )
+      for ( int z = -3; z <= 3; ++z )
+        if ( x != 0 || y != 0 || z != 0 )
+          directions.push_back( Vector( x, y, z ) );
+  std::vector<RealVector> realDirections;
+  for ( unsigned int i = 0; i < 20000; ++i )
+    {
+      RealVector v( rand() / (double) RAND_MAX - 0.5,
+                    rand() / (double) RAND_MAX - 0.5,
+                    rand() / (double) RAND_MAX - 0.5 );
+      if ( v.norm() > 0.01 )
+        realDirections.push_back( v );
+    }
+  for ( unsigned int k = 1; k < 10; ++k )
+    for ( unsigned int j = 0; j < 36; ++j )
+      {
+        const double phi = k * M_PI / 9.0 - M_PI / 18.0;
+        const double theta = j * M_PI / 18.0;
+        realDirections.push_back( RealVector( sin( phi ) * cos( theta ),
+                                              sin( phi ) * sin( theta ),
+                                              cos( phi ) ) );
+      }
+
+  const unsigned int sizes[ 2 ] = { 10, 7 };
+  for ( unsigned int s = 0; s < 2; ++s )
+    {
+      SphericalAccumulator<Vector> accumulator( sizes[ s ] );
+      SphericalAccumulator<RealVector> realAccumulator( sizes[ s ] );
+      unsigned int nbSame = 0;
+      for ( unsigned int i = 0; i < directions.size(); ++i )
+        {
+          Size i1, j1;
+          unsigned int i2, j2;
+          accumulator.binCoordinates( directions[ i ], i1, j1 );
+          referenceBinCoordinates( directions[ i ], sizes[ s ], i2, j2 );
+          nbSame += ( i1 == i2 && j1 == j2 ) ? 1 : 0;
+        }
+      for ( unsigned int i = 0; i < realDirections.size(); ++i )
+        {
+          SphericalAccumulator<RealVector>::Size i1, j1;
+          unsigned int i2, j2;
+          realAccumulator.binCoordinates( realDirections[ i ], i1, j1 );
+          referenceBinCoordinates( realDirections[ i ], sizes[ s ], i2, j2 );
+          nbSame += ( i1 == i2 && j1 == j2 ) ? 1 : 0;
+        }
+      nbok += ( nbSame == directions.size() + realDirections.size() ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "Same bins as acos/atan2 for " << sizes[ s ] << " slices" << std::endl;
+    }
+
+  // Sequential insertion, batch insertion and merge of two halves.
+  SphericalAccumulator<Vector> sequential( 10 );
+  for ( unsigned int i = 0; i < directions.size(); ++i )
+    sequential.addDirection( directions[ i ] );
+  SphericalAccumulator<Vector> batch( 10 );
+  batch.addDirections( directions.begin(), directions.begin() + 10 );
+  batch.addDirections( directions.begin() + 10, directions.end() );
+  SphericalAccumulator<Vector> half( 10 );
+  SphericalAccumulator<Vector> otherHalf( 10 );
+  half.addDirections( directions.begin(), directions.begin() + directions.size() / 2 );
+  otherHalf.addDirections( directions.begin() + directions.size() / 2, directions.end() );
+  half.merge( otherHalf );
+
+  bool sameBatch = true;
+  bool sameMerge = true;
+  for ( Size i = 0; i < 10; ++i )
+    for ( Size j = 0; j < 20; ++j )
+      if ( sequential.isValidBin( i, j ) )
+        {
+          sameBatch = sameBatch && sequential.count( i, j ) == batch.count( i, j )
+            && sequential.representativeDirection( i, j ) == batch.representativeDirection( i, j );
+          sameMerge = sameMerge && sequential.count( i, j ) == half.count( i, j )
+            && sequential.representativeDirection( i, j ) == half.representativeDirection( i, j );
+        }
+  Size i1, j1, i2, j2, i3, j3;
+  sequential.maxCountBin( i1, j1 );
+  batch.maxCountBin( i2, j2 );
+  half.maxCountBin( i3, j3 );
+  nbok += ( sameBatch && i1 == i2 && j1 == j2
+            && sequential.samples() == batch.samples() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Batch insertion same as sequential insertion" << std::endl;
+  nbok += ( sameMerge && sequential.count( i1, j1 ) == half.count( i3, j3 )
+            && sequential.samples() == half.samples() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Merged halves same as sequential insertion" << std::endl;
+
+  // Reset and reuse.
+  half.clear();
+  bool cleared = ( half.samples() == 0 );
+  for ( Size i = 0; i < 10; ++i )
+    for ( Size j = 0; j < 20; ++j )
+      if ( half.isValidBin( i, j ) )
+        cleared = cleared && half.count( i, j ) == 0;
+  half.addDirections( directions.begin(), directions.end() );
+  half.maxCountBin( i3, j3 );
+  for ( Size i = 0; i < 10; ++i )
+    for ( Size j = 0; j < 20; ++j )
+      if ( half.isValidBin( i, j ) )
+        cleared = cleared && sequential.count( i, j ) == half.count( i, j )
+          && sequential.representativeDirection( i, j ) == half.representativeDirection( i, j );
+  nbok += ( cleared && i1 == i3 && j1 == j3 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "Cleared accumulator same as a new one" << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -211,7 +377,7 @@ int main( int argc, char** argv )
   trace.info() << endl;
 
   bool res = testSphericalAccumulator() && testSphericalMore()
-    && testSphericalMoreIntegerDir();
+    && testSphericalMoreIntegerDir() && testSphericalBinningAndBatches();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
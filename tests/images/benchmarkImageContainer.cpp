@@ -36,6 +36,7 @@
 #include "DGtal/kernel/SpaceND.h"
 #include "DGtal/kernel/domains/HyperRectDomain.h"
 #include "DGtal/images/ImageSelector.h"
+#include "DGtal/images/ImageContainerByBlockGrid.h"
 
 #include "DGtal/helpers/StdDefs.h"
 #include <map>
@@ -50,6 +51,7 @@ using namespace DGtal;
 typedef DGtal::ImageContainerBySTLVector< Z2i::Domain, DGtal::int32_t> ImageVector2;
 typedef DGtal::ImageContainerBySTLMap< Z2i::Domain, DGtal::int32_t> ImageMap2;
 typedef DGtal::experimental::ImageContainerByHashTree< Z2i::Domain, DGtal::int32_t> ImageHash2;
+typedef DGtal::ImageContainerByBlockGrid< Z2i::Domain, DGtal::int32_t> ImageBlock2;
 
 template<typename Q>
 static void BM_Constructor(benchmark::State& state)
@@ -66,6 +68,7 @@ static void BM_Constructor(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_Constructor, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_Constructor, ImageMap2)->Range(1<<3 , 1 << 16);
 BENCHMARK_TEMPLATE(BM_Constructor, ImageHash2)->Range(1<<3 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_Constructor, ImageBlock2)->Range(1<<3 , 1 << 16);
 
 template<typename Point>
 std::set<Point> ConstructRandomSet(unsigned int size, unsigned int maxWidth) {
@@ -109,6 +112,32 @@ static void BM_SetValue(benchmark::State& state)
 BENCHMARK_TEMPLATE(BM_SetValue, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageMap2)->Range(1<<3 , 1 << 16);
 BENCHMARK_TEMPLATE(BM_SetValue, ImageHash2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_SetValue, ImageBlock2)->Range(1<<3 , 1 << 16);
+
+template<typename Q>
+static void BM_GetValue(benchmark::State& state)
+{
+  std::set<typename Q::Point> data = ConstructRandomSet<typename Q::Point>(state.range(0),state.range(0));
+  typename Q::Domain dom(typename Q::Point().diagonal(0),
+                         typename Q::Point().diagonal(state.range(0)));
+  Q image( dom );
+  for(typename std::set<typename Q::Point>::const_iterator it = data.begin(), itend=data.end();
+      it != itend; ++it)
+    image.setValue( *it , 42);
+
+  int64_t sum=0;
+  while (state.KeepRunning())
+    {
+      for(typename std::set<typename Q::Point>::const_iterator it = data.begin(), itend=data.end();
+          it != itend; ++it)
+        benchmark::DoNotOptimize( sum += image( *it ) );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*data.size());
+}
+BENCHMARK_TEMPLATE(BM_GetValue, ImageVector2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_GetValue, ImageMap2)->Range(1<<3 , 1 << 16);
+BENCHMARK_TEMPLATE(BM_GetValue, ImageHash2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_GetValue, ImageBlock2)->Range(1<<3 , 1 << 16);
 
 template<typename Q>
 static void BM_RangeScan(benchmark::State& state)
@@ -135,6 +164,7 @@ static void BM_RangeScan(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(BM_RangeScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_RangeScan, ImageMap2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_RangeScan, ImageBlock2)->Range(1<<3 , 1 << 10);
 
 template<typename Q>
 static void BM_DomainScan(benchmark::State& state)
@@ -161,6 +191,7 @@ static void BM_DomainScan(benchmark::State& state)
 }
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageVector2)->Range(1<<3 , 1 << 10);
 BENCHMARK_TEMPLATE(BM_DomainScan, ImageMap2)->Range(1<<3 , 1 << 10);
+BENCHMARK_TEMPLATE(BM_DomainScan, ImageBlock2)->Range(1<<3 , 1 << 10);
 
 
 
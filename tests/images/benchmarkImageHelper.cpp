@@ -0,0 +1,181 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the sequential and parallel image/set conversions of
+ * ImageHelper and SetFromImage. The second argument of the parallel
+ * benchmarks is the number of OpenMP threads. The thread counts
+ * larger than the number of cores should be run with
+ * OMP_WAIT_POLICY=passive.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <iterator>
+#include <benchmark/benchmark.h>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t > Image;
+typedef DigitalSetBySTLVector< Z3i::Domain > VectorSet;
+
+/// Ball of radius size/3 in a cube of side size.
+static void fillBall( Image & image, int size )
+{
+  const Z3i::Point center = Z3i::Point::diagonal( size / 2 );
+  for ( Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it )
+    {
+      const Z3i::Point d = *it - center;
+      image.setValue( *it, d.dot( d ) );
+    }
+}
+
+/// Point functor: l1 norm of the point.
+struct Norm1
+{
+  typedef Z3i::Point Point;
+  typedef Image::Value Value;
+  Value operator()( const Point & p ) const { return static_cast<Value>( p.norm1() ); }
+};
+
+static void setThreads( int nbThreads )
+{
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#else
+  boost::ignore_unused_variable_warning( nbThreads );
+#endif
+}
+
+static void BM_SetFromImage(benchmark::State& state)
+{
+  const int size = state.range(0);
+  Image image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  fillBall( image, size );
+  while (state.KeepRunning())
+    {
+      Z3i::DigitalSet set( image.domain() );
+      SetFromImage<Z3i::DigitalSet>::append<Image>( set, image, -1, size * size / 9 );
+      benchmark::DoNotOptimize( set.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_SetFromImage)->Arg(128)->Arg(256)->Unit(benchmark::kMillisecond);
+
+static void BM_PointsFromImage(benchmark::State& state)
+{
+  const int size = state.range(0);
+  Image image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  fillBall( image, size );
+  while (state.KeepRunning())
+    {
+      std::vector<Z3i::Point> points;
+      setFromImage( image, std::back_inserter( points ), size * size / 9 );
+      benchmark::DoNotOptimize( points.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_PointsFromImage)->Arg(128)->Arg(256)->Unit(benchmark::kMillisecond);
+
+static void BM_PointsFromImageParallel(benchmark::State& state)
+{
+  const int size = state.range(0);
+  setThreads( state.range(1) );
+  Image image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  fillBall( image, size );
+  while (state.KeepRunning())
+    {
+      std::vector<Z3i::Point> points;
+      setFromImageParallel( image, std::back_inserter( points ), size * size / 9 );
+      benchmark::DoNotOptimize( points.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_PointsFromImageParallel)->ArgPair(128,1)->ArgPair(128,2)->ArgPair(128,4)->ArgPair(128,8)
+->ArgPair(256,1)->ArgPair(256,2)->ArgPair(256,4)->ArgPair(256,8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_SetFromImageParallel(benchmark::State& state)
+{
+  const int size = state.range(0);
+  setThreads( state.range(1) );
+  Image image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  fillBall( image, size );
+  while (state.KeepRunning())
+    {
+      VectorSet set( image.domain() );
+      SetFromImage<VectorSet>::appendParallel<Image>( set, image, -1, size * size / 9 );
+      benchmark::DoNotOptimize( set.size() );
+    }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_SetFromImageParallel)->ArgPair(128,1)->ArgPair(128,2)->ArgPair(128,4)->ArgPair(128,8)
+->ArgPair(256,1)->ArgPair(256,2)->ArgPair(256,4)->ArgPair(256,8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ImageFromFunctor(benchmark::State& state)
+{
+  const int size = state.range(0);
+  Image image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  Norm1 f;
+  while (state.KeepRunning())
+    imageFromFunctor( image, f );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_ImageFromFunctor)->Arg(128)->Arg(256)->Unit(benchmark::kMillisecond);
+
+static void BM_ImageFromFunctorParallel(benchmark::State& state)
+{
+  const int size = state.range(0);
+  setThreads( state.range(1) );
+  Image image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  Norm1 f;
+  while (state.KeepRunning())
+    imageFromFunctorParallel( image, f );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_ImageFromFunctorParallel)->ArgPair(128,1)->ArgPair(128,2)->ArgPair(128,4)->ArgPair(128,8)
+->ArgPair(256,1)->ArgPair(256,2)->ArgPair(256,4)->ArgPair(256,8)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,152 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of ImageResampler against ConstImageAdapter combined
+ * with BackwardRigidTransformation3D: rigid resampling of a volume
+ * and extraction of an oblique slice. The second argument of the
+ * parallel benchmarks is the number of OpenMP threads (see
+ * benchmarkImageHelper.cpp).
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <benchmark/benchmark.h>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/images/ImageResampler.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector< Z3i::Domain, unsigned char > Image;
+typedef ImageContainerBySTLVector< Z2i::Domain, unsigned char > Slice;
+typedef functors::BackwardRigidTransformation3D< Z3i::Space > Backward;
+typedef ConstImageAdapter< Image, Z3i::Domain, Backward, unsigned char, functors::Identity > Adapter;
+
+static Image makeVolume( int size )
+{
+  Image image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  for ( Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it )
+    image.setValue( *it, static_cast<unsigned char>( (*it)[ 0 ] ^ (*it)[ 1 ] ^ (*it)[ 2 ] ) );
+  return image;
+}
+
+static Backward makeBackward( int size )
+{
+  return Backward( Z3i::RealPoint::diagonal( size / 2 ), Z3i::RealVector( 1, 1, 1 ).getNormalized(),
+                   M_PI / 7, Z3i::RealVector( 1.5, -2.5, 0.5 ) );
+}
+
+static void setThreads( int nbThreads )
+{
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#else
+  boost::ignore_unused_variable_warning( nbThreads );
+#endif
+}
+
+static void BM_RigidAdapter(benchmark::State& state)
+{
+  const int size = state.range(0);
+  const Image image = makeVolume( size );
+  const Backward backward = makeBackward( size );
+  functors::Identity id;
+  const Adapter adapter( image, image.domain(), backward, id );
+  Image result( image.domain() );
+  while (state.KeepRunning())
+    for ( Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it )
+      result.setValue( *it, adapter( *it ) );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_RigidAdapter)->Arg(64)->Arg(128)->Unit(benchmark::kMillisecond);
+
+static void BM_RigidResampler(benchmark::State& state)
+{
+  const int size = state.range(0);
+  const Image image = makeVolume( size );
+  ImageResampler<Image> resampler( image, state.range(1) == 0 ? ImageResampler<Image>::NearestNeighbor
+                                                               : ImageResampler<Image>::Linear );
+  resampler.setBackwardTransform( makeBackward( size ) );
+  Image result( image.domain() );
+  while (state.KeepRunning())
+    resampler.resample( result );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_RigidResampler)->ArgPair(64,0)->ArgPair(128,0)->ArgPair(64,1)->ArgPair(128,1)
+->Unit(benchmark::kMillisecond);
+
+static void BM_RigidResamplerParallel(benchmark::State& state)
+{
+  const int size = state.range(0);
+  setThreads( state.range(1) );
+  const Image image = makeVolume( size );
+  ImageResampler<Image> resampler( image, ImageResampler<Image>::Linear );
+  resampler.setBackwardTransform( makeBackward( size ) );
+  Image result( image.domain() );
+  while (state.KeepRunning())
+    resampler.resampleParallel( result );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*image.domain().size());
+}
+BENCHMARK(BM_RigidResamplerParallel)->ArgPair(128,1)->ArgPair(128,2)->ArgPair(128,4)
+->Unit(benchmark::kMillisecond)->UseRealTime();
+
+static void BM_ObliqueSlice(benchmark::State& state)
+{
+  const int size = state.range(0);
+  const Image image = makeVolume( size );
+  ImageResampler<Image> resampler( image, state.range(1) == 0 ? ImageResampler<Image>::NearestNeighbor
+                                                               : ImageResampler<Image>::Linear );
+  const Z3i::RealVector u = Z3i::RealVector( 1, -1, 0 ).getNormalized();
+  const Z3i::RealVector v = Z3i::RealVector( 1, 1, -2 ).getNormalized();
+  Slice slice( Z2i::Domain( Z2i::Point::diagonal( 0 ), Z2i::Point::diagonal( size - 1 ) ) );
+  while (state.KeepRunning())
+    resampler.reslice( slice, Z3i::RealPoint::diagonal( 0.5 * size ), u, v );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*slice.domain().size());
+}
+BENCHMARK(BM_ObliqueSlice)->ArgPair(256,0)->ArgPair(512,0)->ArgPair(256,1)->ArgPair(512,1)
+->Unit(benchmark::kMillisecond);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
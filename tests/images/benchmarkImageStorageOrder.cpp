@@ -0,0 +1,132 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of the storage orders of ImageContainerBySTLVector on a
+ * 26-neighbourhood stencil.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t, ColMajorStorage > ImageColMajor;
+typedef ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t, BlockedStorage<2> > ImageBlocked4;
+typedef ImageContainerBySTLVector< Z3i::Domain, DGtal::int32_t, BlockedStorage<3> > ImageBlocked8;
+
+/// Sum of the 26-neighbourhood of every point, the points being
+/// visited along a path given as a vector of points.
+template<typename Q>
+static int64_t stencilSum( const Q & image, const std::vector<Z3i::Point> & path )
+{
+  int64_t sum = 0;
+  for ( std::vector<Z3i::Point>::const_iterator it = path.begin(), itend = path.end();
+        it != itend; ++it )
+    for ( int z = -1; z <= 1; ++z )
+      for ( int y = -1; y <= 1; ++y )
+        for ( int x = -1; x <= 1; ++x )
+          sum += image( *it + Z3i::Point( x, y, z ) );
+  return sum;
+}
+
+/// Points of the domain interior, in domain order.
+static std::vector<Z3i::Point> scanPath( int size )
+{
+  std::vector<Z3i::Point> path;
+  const Z3i::Domain interior( Z3i::Point::diagonal( 1 ), Z3i::Point::diagonal( size - 2 ) );
+  for ( Z3i::Domain::ConstIterator it = interior.begin(), itend = interior.end(); it != itend; ++it )
+    path.push_back( *it );
+  return path;
+}
+
+/// Random walk in the domain interior (e.g. surface tracking).
+static std::vector<Z3i::Point> randomWalkPath( int size )
+{
+  std::vector<Z3i::Point> path;
+  Z3i::Point p = Z3i::Point::diagonal( size / 2 );
+  srand( 0 );
+  const std::size_t length = static_cast<std::size_t>( size ) * size * size / 8;
+  for ( std::size_t i = 0; i < length; ++i )
+    {
+      const int k = rand() % 3;
+      p[ k ] += ( rand() % 2 ) ? 1 : -1;
+      p[ k ] = std::max( 1, std::min( size - 2, p[ k ] ) );
+      path.push_back( p );
+    }
+  return path;
+}
+
+template<typename Q>
+static void BM_StencilScan(benchmark::State& state)
+{
+  const int size = state.range(0);
+  Q image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  for ( Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it )
+    image.setValue( *it, (*it)[0] % 7 );
+  const std::vector<Z3i::Point> path = scanPath( size );
+
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( stencilSum( image, path ) );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*path.size());
+}
+BENCHMARK_TEMPLATE(BM_StencilScan, ImageColMajor)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(BM_StencilScan, ImageBlocked4)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(BM_StencilScan, ImageBlocked8)->Arg(64)->Arg(256);
+
+template<typename Q>
+static void BM_StencilRandomWalk(benchmark::State& state)
+{
+  const int size = state.range(0);
+  Q image( Z3i::Domain( Z3i::Point::diagonal( 0 ), Z3i::Point::diagonal( size - 1 ) ) );
+  for ( Z3i::Domain::ConstIterator it = image.domain().begin(), itend = image.domain().end(); it != itend; ++it )
+    image.setValue( *it, (*it)[0] % 7 );
+  const std::vector<Z3i::Point> path = randomWalkPath( size );
+
+  while (state.KeepRunning())
+    benchmark::DoNotOptimize( stencilSum( image, path ) );
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations())*path.size());
+}
+BENCHMARK_TEMPLATE(BM_StencilRandomWalk, ImageColMajor)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(BM_StencilRandomWalk, ImageBlocked4)->Arg(64)->Arg(256);
+BENCHMARK_TEMPLATE(BM_StencilRandomWalk, ImageBlocked8)->Arg(64)->Arg(256);
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc,  char **argv )
+{
+  benchmark::Initialize(&argc, argv);
+
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
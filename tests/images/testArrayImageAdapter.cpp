@@ -26,6 +26,7 @@
 #include <cstddef>
 #include <iostream>
 #include <new>
+#include <iterator>
 #include <cmath>
 
 #include <DGtal/kernel/SpaceND.h>
@@ -113,10 +114,10 @@ void fastFillImageWithPointFn ( ImageContainerBySTLVector<TDomain, TValue>& anIm
     }
 }
 
-template < typename TIterator, typename TDomain, typename TFunction >
-void fastFillImageWithPointFn ( ArrayImageAdapter<TIterator, TDomain>& anImage, TFunction const& aFunction )
+template < typename TIterator, typename TDomain, typename TStorageOrder, typename TFunction >
+void fastFillImageWithPointFn ( ArrayImageAdapter<TIterator, TDomain, TStorageOrder>& anImage, TFunction const& aFunction )
 {
-  typedef ArrayImageAdapter<TIterator, TDomain> Image; // 'typedef' instead of 'using' because of g++ 4.7.4 bug.
+  typedef ArrayImageAdapter<TIterator, TDomain, TStorageOrder> Image; // 'typedef' instead of 'using' because of g++ 4.7.4 bug.
   using Value = typename Image::Value;
   for ( auto imgit = anImage.begin(); imgit != anImage.end(); ++imgit )
     {
@@ -292,3 +293,72 @@ TEST_CASE_METHOD( TestImage3D, "Checking ArrayImageAdapter with ImageContainerBy
   checkThat(image_view);
 }
 
+TEST_CASE_METHOD( TestImage3D, "Checking ArrayImageAdapter with C-style array and row-major storage", "[CArray][FullDomain][RowMajor]" )
+{
+  Value* data = new Value[domain.size()];
+  ArrayImageAdapter<Value*, Domain, RowMajorStorage> image( data, domain );
+  REQUIRE( static_cast<size_t>( std::distance( image.begin(), image.end() ) ) == domain.size() );
+  size_t cnt = 0;
+  for ( auto it = image.begin(); it != image.end(); ++it )
+    ++cnt;
+  REQUIRE( cnt == domain.size() );
+  checkThat(image);
+  delete[] data;
+}
+
+TEST_CASE_METHOD( TestImage3D, "Checking ArrayImageAdapter with C-style array and row-major storage on sub-domain", "[CArray][SubDomain][RowMajor]" )
+{
+  Value* data = new Value[domain.size()];
+  ArrayImageAdapter<Value*, Domain, RowMajorStorage> image( data, domain, subDomain );
+  size_t cnt = 0;
+  for ( auto it = image.begin(); it != image.end(); ++it )
+    ++cnt;
+  REQUIRE( cnt == subDomain.size() );
+  checkThat(image);
+  delete[] data;
+}
+
+TEST_CASE_METHOD( TestImage3D, "Checking ArrayImageAdapter with row-major ImageContainerBySTLVector", "[ImageSTL][FullDomain][RowMajor]" )
+{
+  ImageContainerBySTLVector<Domain, Value, RowMajorStorage> image(domain);
+  auto image_view = makeArrayImageAdapterFromImage( image );
+  checkThat(image_view);
+  for ( auto const& point : domain )
+    REQUIRE( image( point ) == image_view( point ) );
+}
+
+TEST_CASE_METHOD( TestImage3D, "Checking ArrayImageAdapter with C-style array and blocked storage", "[CArray][FullDomain][Blocked]" )
+{
+  using Storage = BlockedStorage<2>;
+  const auto size = Linearizer<Domain, Storage>::getStorageSize( domain.upperBound() - domain.lowerBound() + Domain::Point::diagonal(1) );
+  Value* data = new Value[size];
+  ArrayImageAdapter<Value*, Domain, Storage> image( data, domain );
+  checkThat(image);
+  delete[] data;
+}
+
+TEST_CASE_METHOD( TestImage3D, "Checking ArrayImageAdapter with C-style array and blocked storage on sub-domain", "[CArray][SubDomain][Blocked]" )
+{
+  using Storage = BlockedStorage<2>;
+  const auto size = Linearizer<Domain, Storage>::getStorageSize( domain.upperBound() - domain.lowerBound() + Domain::Point::diagonal(1) );
+  Value* data = new Value[size];
+  ArrayImageAdapter<Value*, Domain, Storage> image( data, domain, subDomain );
+  checkThat(image);
+  delete[] data;
+}
+
+TEST_CASE_METHOD( TestImage3D, "Checking ArrayImageAdapter with blocked ImageContainerBySTLVector", "[ImageSTL][FullDomain][Blocked]" )
+{
+  ImageContainerBySTLVector<Domain, Value, BlockedStorage<2> > image(domain);
+  auto image_view = makeArrayImageAdapterFromImage( image );
+  checkThat(image_view);
+}
+
+TEST_CASE_METHOD( TestImage3D, "Checking ArrayImageAdapter with blocked ImageContainerBySTLVector on sub-domain", "[ImageSTL][SubDomain][Blocked]" )
+{
+  ImageContainerBySTLVector<Domain, Value, BlockedStorage<2> > image(domain);
+  auto image_view = makeArrayImageAdapterFromImage( image, subDomain );
+  checkThat(image_view);
+  for ( auto const& point : subDomain )
+    REQUIRE( image( point ) == image_view( point ) );
+}
@@ -0,0 +1,166 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageContainerByBlockGrid.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ImageContainerByBlockGrid.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cstdlib>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/images/CImage.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ImageContainerByBlockGrid.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageContainerByBlockGrid.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Testing ImageContainerByBlockGrid in 2D" )
+{
+  typedef ImageContainerByBlockGrid<Z2i::Domain, int> Image;
+  typedef ImageContainerBySTLMap<Z2i::Domain, int> RefImage;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+
+  // Domain whose lower bound is not aligned and whose size is not a
+  // multiple of the block size.
+  const Z2i::Domain domain( Z2i::Point( -13, 4 ), Z2i::Point( 50, 37 ) );
+  Image image( domain, -1 );
+  RefImage ref( domain, -1 );
+
+  SECTION( "Default value and empty image" )
+    {
+      REQUIRE( image.isValid() );
+      REQUIRE( image.nbBlocks() == 0 );
+      REQUIRE( image( Z2i::Point( 0, 10 ) ) == -1 );
+      REQUIRE( image.leafBegin() == image.leafEnd() );
+    }
+
+  SECTION( "Random writes and reads against ImageContainerBySTLMap" )
+    {
+      srand( 0 );
+      for ( unsigned int i = 0; i < 500; ++i )
+        {
+          const Z2i::Point p( -13 + rand() % 64, 4 + rand() % 34 );
+          image.setValue( p, i );
+          ref.setValue( p, i );
+        }
+      REQUIRE( image.isValid() );
+      unsigned int nbok = 0;
+      for ( Z2i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+            it != itend; ++it )
+        nbok += ( image( *it ) == ref( *it ) ) ? 1 : 0;
+      REQUIRE( nbok == domain.size() );
+
+      // The default value is only stored in blocks that have been written.
+      REQUIRE( image.nbBlocks() <= ( 64 / 8 ) * ( 40 / 8 + 1 ) );
+
+      // Ranges
+      unsigned int nbRange = 0;
+      RefImage::ConstRange::ConstIterator itRef = ref.constRange().begin();
+      for ( Image::ConstRange::ConstIterator it = image.constRange().begin(),
+              itend = image.constRange().end(); it != itend; ++it, ++itRef )
+        nbRange += ( *it == *itRef ) ? 1 : 0;
+      REQUIRE( nbRange == domain.size() );
+    }
+
+  SECTION( "Leaf iteration" )
+    {
+      image.setValue( Z2i::Point( -13, 4 ), 1 );
+      image.setValue( Z2i::Point( -6, 11 ), 2 );   // same block
+      image.setValue( Z2i::Point( -5, 11 ), 3 );   // next block
+      image.setValue( Z2i::Point( 50, 37 ), 4 );
+      REQUIRE( image.nbBlocks() == 3 );
+
+      int sum = 0;
+      unsigned int nbLeaves = 0;
+      for ( Image::LeafConstIterator it = image.leafBegin(), itend = image.leafEnd();
+            it != itend; ++it, ++nbLeaves )
+        {
+          const Image::Leaf leaf = *it;
+          for ( Image::Size i = 0; i < Image::blockVolume; ++i )
+            {
+              const Z2i::Point p = leaf.getPoint( i );
+              if ( domain.isInside( p ) )
+                REQUIRE( leaf[ i ] == image( p ) );
+              if ( leaf[ i ] != -1 ) sum += leaf[ i ];
+            }
+        }
+      REQUIRE( nbLeaves == 3 );
+      REQUIRE( sum == 1 + 2 + 3 + 4 );
+
+      image.clear();
+      REQUIRE( image.nbBlocks() == 0 );
+      REQUIRE( image( Z2i::Point( -6, 11 ) ) == -1 );
+    }
+}
+
+TEST_CASE( "Testing ImageContainerByBlockGrid in 3D" )
+{
+  typedef ImageContainerByBlockGrid<Z3i::Domain, unsigned char, 2> Image;
+  BOOST_CONCEPT_ASSERT(( concepts::CImage< Image > ));
+  REQUIRE( Image::blockVolume == 64 );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 99, 99, 99 ) );
+  Image image( domain );
+
+  // Narrow band around a sphere: many blocks, forcing several rehashes.
+  unsigned int nb = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      const Z3i::Point d = *it - Z3i::Point( 50, 50, 50 );
+      const int r2 = d.dot( d );
+      if ( r2 >= 35 * 35 && r2 < 37 * 37 )
+        {
+          image.setValue( *it, 1 );
+          ++nb;
+        }
+    }
+  REQUIRE( nb > 0 );
+
+  unsigned int nbok = 0;
+  unsigned int nbset = 0;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itend = domain.end();
+        it != itend; ++it )
+    {
+      const Z3i::Point d = *it - Z3i::Point( 50, 50, 50 );
+      const int r2 = d.dot( d );
+      const unsigned char expected = ( r2 >= 35 * 35 && r2 < 37 * 37 ) ? 1 : 0;
+      nbok += ( image( *it ) == expected ) ? 1 : 0;
+      nbset += image( *it );
+    }
+  REQUIRE( nbok == domain.size() );
+  REQUIRE( nbset == nb );
+  REQUIRE( image.nbBlocks() < domain.size() / Image::blockVolume );
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,234 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageResampler.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class ImageResampler.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/RigidTransformation2D.h"
+#include "DGtal/images/RigidTransformation3D.h"
+#include "DGtal/images/ImageResampler.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// Fills an image with a deterministic pattern.
+template <typename TImage>
+void fillImage( TImage & anImage )
+{
+  typedef typename TImage::Point Point;
+  for ( typename TImage::Domain::ConstIterator it = anImage.domain().begin(), itEnd = anImage.domain().end();
+        it != itEnd; ++it )
+    {
+      int v = 0;
+      for ( Dimension i = 0; i < Point::dimension; ++i )
+        v = 31 * v + (*it)[ i ];
+      anImage.setValue( *it, ( ( v % 251 ) + 251 ) % 251 );
+    }
+}
+
+/// Counts the points where two images differ.
+template <typename TImage1, typename TImage2>
+unsigned int nbDifferences( const TImage1 & anImage1, const TImage2 & anImage2 )
+{
+  unsigned int nb = 0;
+  for ( typename TImage1::Domain::ConstIterator it = anImage1.domain().begin(), itEnd = anImage1.domain().end();
+        it != itEnd; ++it )
+    nb += ( anImage1( *it ) == anImage2( *it ) ) ? 0 : 1;
+  return nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class ImageResampler.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Nearest-neighbor resampling through rigid transformations" )
+{
+  SECTION( "2D, against ConstImageAdapter" )
+    {
+      typedef ImageContainerBySTLVector<Z2i::Domain, int> Image;
+      typedef functors::BackwardRigidTransformation2D<Z2i::Space> Backward;
+      typedef ConstImageAdapter<Image, Z2i::Domain, Backward, int, functors::Identity> Adapter;
+      const Z2i::Domain domain( Z2i::Point( -5, 3 ), Z2i::Point( 40, 31 ) );
+      Image image( domain );
+      fillImage( image );
+
+      const Backward backward( Z2i::RealPoint( 10.3, 12.1 ), 0.4321, Z2i::RealVector( 2.17, -1.31 ) );
+      const Z2i::Domain outDomain( Z2i::Point( -20, -10 ), Z2i::Point( 50, 45 ) );
+      functors::Identity id;
+      Adapter adapter( image, outDomain, backward, id );
+      adapter.setDefaultValue( 0 );
+
+      ImageResampler<Image> resampler( image );
+      resampler.setBackwardTransform( backward );
+      Image result( outDomain );
+      resampler.resample( result );
+      REQUIRE( nbDifferences( result, adapter ) == 0 );
+
+      Image resultParallel( outDomain );
+      resampler.resampleParallel( resultParallel );
+      REQUIRE( nbDifferences( resultParallel, adapter ) == 0 );
+    }
+
+  SECTION( "3D, against ConstImageAdapter, generic input image" )
+    {
+      typedef ImageContainerBySTLMap<Z3i::Domain, int> Image;
+      typedef ImageContainerBySTLVector<Z3i::Domain, int> OutputImage;
+      typedef functors::BackwardRigidTransformation3D<Z3i::Space> Backward;
+      typedef ConstImageAdapter<Image, Z3i::Domain, Backward, int, functors::Identity> Adapter;
+      const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 17, 13, 11 ) );
+      Image image( domain );
+      fillImage( image );
+
+      const Backward backward( Z3i::RealPoint( 5.2, 4.9, 6.1 ), Z3i::RealVector( 1.0, 0.3, 0.7 ).getNormalized(),
+                               0.6123, Z3i::RealVector( 1.37, -2.21, 0.53 ) );
+      const Z3i::Domain outDomain( Z3i::Point( -4, -4, -4 ), Z3i::Point( 21, 17, 15 ) );
+      functors::Identity id;
+      Adapter adapter( image, outDomain, backward, id );
+      adapter.setDefaultValue( 0 );
+
+      ImageResampler<Image> resampler( image );
+      resampler.setBackwardTransform( backward );
+      OutputImage result( outDomain );
+      resampler.resample( result );
+      REQUIRE( nbDifferences( result, adapter ) == 0 );
+    }
+}
+
+TEST_CASE( "Linear resampling" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, double> Image;
+  const Z3i::Domain domain( Z3i::Point( -3, 0, 2 ), Z3i::Point( 12, 9, 10 ) );
+  Image image( domain );
+  // Affine values are reproduced exactly by linear interpolation.
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    image.setValue( *it, 1.5 * (*it)[ 0 ] - 0.25 * (*it)[ 1 ] + 2.0 * (*it)[ 2 ] + 3.0 );
+
+  ImageResampler<Image> resampler( image, ImageResampler<Image>::Linear, -100.0 );
+  REQUIRE( resampler.isValid() );
+
+  SECTION( "Inside positions" )
+    {
+      unsigned int nbok = 0;
+      for ( unsigned int k = 0; k < 200; ++k )
+        {
+          const Z3i::RealPoint p( -3.0 + 0.0731 * k, 0.0451 * k, 2.0 + 0.0399 * k );
+          const double expected = 1.5 * p[ 0 ] - 0.25 * p[ 1 ] + 2.0 * p[ 2 ] + 3.0;
+          nbok += ( std::abs( resampler.sample( p ) - expected ) < 1e-9 ) ? 1 : 0;
+        }
+      REQUIRE( nbok == 200 );
+    }
+
+  SECTION( "Border and outside positions" )
+    {
+      // Halfway between the last point and the outside.
+      const double onBorder = resampler.sample( Z3i::RealPoint( 12.5, 4.0, 5.0 ) );
+      const double lastValue = image( Z3i::Point( 12, 4, 5 ) );
+      REQUIRE( std::abs( onBorder - 0.5 * ( lastValue - 100.0 ) ) < 1e-9 );
+      REQUIRE( resampler.sample( Z3i::RealPoint( 14.0, 4.0, 5.0 ) ) == -100.0 );
+      REQUIRE( resampler.sample( Z3i::RealPoint( 1e30, 4.0, 5.0 ) ) == -100.0 );
+    }
+
+  SECTION( "Integral values are rounded" )
+    {
+      typedef ImageContainerBySTLVector<Z2i::Domain, unsigned char> ImageUC;
+      ImageUC imageUC( Z2i::Domain( Z2i::Point( 0, 0 ), Z2i::Point( 1, 1 ) ) );
+      imageUC.setValue( Z2i::Point( 0, 0 ), 10 );
+      imageUC.setValue( Z2i::Point( 1, 0 ), 13 );
+      imageUC.setValue( Z2i::Point( 0, 1 ), 10 );
+      imageUC.setValue( Z2i::Point( 1, 1 ), 13 );
+      ImageResampler<ImageUC> resamplerUC( imageUC, ImageResampler<ImageUC>::Linear );
+      REQUIRE( resamplerUC.sample( Z2i::RealPoint( 0.5, 0.3 ) ) == 12 );
+      REQUIRE( resamplerUC.sample( Z2i::RealPoint( 0.4, 0.3 ) ) == 11 );
+    }
+}
+
+TEST_CASE( "Reslicing" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  typedef ImageContainerBySTLVector<Z2i::Domain, int> Slice;
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 31, 27, 23 ) );
+  Image image( domain );
+  fillImage( image );
+
+  const Z3i::RealVector u = Z3i::RealVector( 1.0, 1.0, 0.2 ).getNormalized();
+  const Z3i::RealVector v = Z3i::RealVector( -0.3, 0.4, 1.0 ).getNormalized();
+  const Z3i::RealPoint center( 15.21, 13.37, 11.73 );
+  const Z2i::Domain sliceDomain( Z2i::Point( 0, 0 ), Z2i::Point( 40, 30 ) );
+
+  SECTION( "Oblique slice against direct sampling" )
+    {
+      for ( unsigned int mode = 0; mode < 2; ++mode )
+        {
+          ImageResampler<Image> resampler( image, mode == 0 ? ImageResampler<Image>::NearestNeighbor
+                                                             : ImageResampler<Image>::Linear );
+          Slice slice( sliceDomain );
+          resampler.reslice( slice, center, u, v );
+          Slice sliceParallel( sliceDomain );
+          std::vector<Z3i::RealVector> directions( 2 );
+          directions[ 0 ] = u;
+          directions[ 1 ] = v;
+          resampler.resliceParallel( sliceParallel, center - u * 20.0 - v * 15.0, directions );
+          REQUIRE( nbDifferences( slice, sliceParallel ) == 0 );
+
+          unsigned int nbok = 0;
+          for ( Z2i::Domain::ConstIterator it = sliceDomain.begin(), itEnd = sliceDomain.end();
+                it != itEnd; ++it )
+            {
+              const Z3i::RealPoint p = center + u * ( (*it)[ 0 ] - 20.0 ) + v * ( (*it)[ 1 ] - 15.0 );
+              nbok += ( slice( *it ) == resampler.sample( p ) ) ? 1 : 0;
+            }
+          REQUIRE( nbok == sliceDomain.size() );
+        }
+    }
+
+  SECTION( "Axis-aligned slice" )
+    {
+      ImageResampler<Image> resampler( image );
+      std::vector<Z3i::RealVector> directions( 2 );
+      directions[ 0 ] = Z3i::RealVector( 1, 0, 0 );
+      directions[ 1 ] = Z3i::RealVector( 0, 0, 1 );
+      const Z2i::Domain xzDomain( Z2i::Point( 0, 0 ), Z2i::Point( 31, 23 ) );
+      Slice slice( xzDomain );
+      resampler.reslice( slice, Z3i::RealPoint( 0, 7, 0 ), directions );
+      unsigned int nbok = 0;
+      for ( Z2i::Domain::ConstIterator it = xzDomain.begin(), itEnd = xzDomain.end(); it != itEnd; ++it )
+        nbok += ( slice( *it ) == image( Z3i::Point( (*it)[ 0 ], 7, (*it)[ 1 ] ) ) ) ? 1 : 0;
+      REQUIRE( nbok == xzDomain.size() );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,338 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testImageSpanEvaluation.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing the span evaluation of images and adapters.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <set>
+#include <iterator>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageContainerBySTLMap.h"
+#include "DGtal/images/ConstImageAdapter.h"
+#include "DGtal/images/ImageAdapter.h"
+#include "DGtal/images/ImageHelper.h"
+#include "DGtal/images/ImageSpanEvaluation.h"
+#include "DGtal/images/imagesSetsUtils/SetFromImage.h"
+#include "DGtalCatch.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+/// A value functor without span form.
+struct Square
+{
+  int operator()( const int & aValue ) const { return aValue * aValue; }
+};
+
+/// A domain functor translating points.
+struct Shift
+{
+  Z3i::Point operator()( const Z3i::Point & aPoint ) const { return aPoint + Z3i::Point( 3, 0, -2 ); }
+};
+
+/// Checks evalSpan against operator() on every span of the domain along every axis.
+template <typename TImage>
+unsigned int checkSpans( const TImage & anImage )
+{
+  typedef typename TImage::Point Point;
+  typedef typename TImage::Value Value;
+  const Point lower = anImage.domain().lowerBound();
+  const Point upper = anImage.domain().upperBound();
+  unsigned int nbFailures = 0;
+  for ( Dimension dim = 0; dim < Point::dimension; ++dim )
+    {
+      Point rowUpper = upper;
+      rowUpper[ dim ] = lower[ dim ];
+      const typename TImage::Domain rows( lower, rowUpper );
+      const std::size_t length = upper[ dim ] - lower[ dim ] + 1;
+      std::vector<Value> values( length );
+      for ( typename TImage::Domain::ConstIterator it = rows.begin(), itEnd = rows.end();
+            it != itEnd; ++it )
+        {
+          functions::evalSpan( anImage, *it, dim, length, values.begin() );
+          Point p = *it;
+          for ( std::size_t k = 0; k < length; ++k, ++p[ dim ] )
+            nbFailures += ( values[ k ] == anImage( p ) ) ? 0 : 1;
+        }
+    }
+  return nbFailures;
+}
+
+/// Fills an image with a deterministic pattern.
+template <typename TImage>
+void fillImage( TImage & anImage )
+{
+  for ( typename TImage::Domain::ConstIterator it = anImage.domain().begin(), itEnd = anImage.domain().end();
+        it != itEnd; ++it )
+    anImage.setValue( *it, ( 7 * (*it)[ 0 ] + 13 * (*it)[ 1 ] + 29 * (*it)[ 2 ] ) % 23 );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing the span evaluation of images and adapters.
+///////////////////////////////////////////////////////////////////////////////
+
+TEST_CASE( "Span forms of functors" )
+{
+  typedef std::vector<int>::const_iterator In;
+  typedef std::vector<unsigned char>::iterator Out;
+  REQUIRE(( functors::HasSpanForm< functors::Thresholder<int>, In, Out >::value ));
+  REQUIRE(( functors::HasSpanForm< functors::IntervalThresholder<int>, In, Out >::value ));
+  REQUIRE(( functors::HasSpanForm< functors::Cast<unsigned char>, In, Out >::value ));
+  REQUIRE(( functors::HasSpanForm< functors::Identity, In, Out >::value ));
+  REQUIRE(( ! functors::HasSpanForm< Square, In, Out >::value ));
+
+  std::vector<int> values;
+  for ( int i = -10; i <= 10; ++i ) values.push_back( i );
+  std::vector<unsigned char> flags( values.size() );
+
+  functors::Thresholder<int, false, false> greater( 3 );
+  functors::transformSpan( greater, values.begin(), values.end(), flags.begin() );
+  unsigned int nbok = 0;
+  for ( std::size_t i = 0; i < values.size(); ++i )
+    nbok += ( ( flags[ i ] != 0 ) == greater( values[ i ] ) ) ? 1 : 0;
+  REQUIRE( nbok == values.size() );
+
+  functors::IntervalThresholder<int> interval( -2, 5 );
+  functors::transformSpan( interval, values.begin(), values.end(), flags.begin() );
+  nbok = 0;
+  for ( std::size_t i = 0; i < values.size(); ++i )
+    nbok += ( ( flags[ i ] != 0 ) == interval( values[ i ] ) ) ? 1 : 0;
+  REQUIRE( nbok == values.size() );
+
+  std::vector<int> squares( values.size() );
+  functors::transformSpan( Square(), values.begin(), values.end(), squares.begin() );
+  REQUIRE( squares[ 0 ] == 100 );
+  REQUIRE( squares[ 10 ] == 0 );
+}
+
+TEST_CASE( "Span evaluation of images" )
+{
+  const Z3i::Domain domain( Z3i::Point( -3, 2, -5 ), Z3i::Point( 12, 9, 4 ) );
+
+  SECTION( "ImageContainerBySTLVector, column-major storage" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+      REQUIRE(( functions::HasEvalSpan<Image, int*>::value ));
+      Image image( domain );
+      fillImage( image );
+      REQUIRE( checkSpans( image ) == 0 );
+    }
+
+  SECTION( "ImageContainerBySTLVector, blocked storage" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, int, BlockedStorage<2> > Image;
+      Image image( domain );
+      fillImage( image );
+      REQUIRE( checkSpans( image ) == 0 );
+    }
+
+  SECTION( "ImageContainerBySTLVector, bool values" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, bool> Image;
+      Image image( domain );
+      fillImage( image );
+      REQUIRE( checkSpans( image ) == 0 );
+    }
+
+  SECTION( "ImageContainerBySTLMap (per-point fallback)" )
+    {
+      typedef ImageContainerBySTLMap<Z3i::Domain, int> Image;
+      REQUIRE(( ! functions::HasEvalSpan<Image, int*>::value ));
+      Image image( domain );
+      fillImage( image );
+      REQUIRE( checkSpans( image ) == 0 );
+    }
+}
+
+TEST_CASE( "Span evaluation of adapters" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 15, 11, 7 ) );
+  Image image( domain );
+  fillImage( image );
+
+  SECTION( "ConstImageAdapter with identity domain functor and thresholder" )
+    {
+      typedef functors::Thresholder<int, false, false> Threshold;
+      typedef ConstImageAdapter<Image, Z3i::Domain, functors::Identity, bool, Threshold> Adapter;
+      REQUIRE(( functions::HasEvalSpan<Adapter, bool*>::value ));
+      functors::Identity id;
+      Threshold threshold( 11 );
+      Adapter adapter( image, domain, id, threshold );
+      REQUIRE( checkSpans( adapter ) == 0 );
+
+      // Sub-domain adapter.
+      const Z3i::Domain subDomain( Z3i::Point( 2, 3, 1 ), Z3i::Point( 9, 11, 6 ) );
+      Adapter subAdapter( image, subDomain, id, threshold );
+      REQUIRE( checkSpans( subAdapter ) == 0 );
+    }
+
+  SECTION( "ConstImageAdapter on spans longer than the read chunks" )
+    {
+      typedef functors::Thresholder<int, false, false> Threshold;
+      typedef ConstImageAdapter<Image, Z3i::Domain, functors::Identity, bool, Threshold> Adapter;
+      const Z3i::Domain longDomain( Z3i::Point( -70, 0, 0 ), Z3i::Point( 130, 2, 1 ) );
+      Image longImage( longDomain );
+      fillImage( longImage );
+      functors::Identity id;
+      Threshold threshold( 11 );
+      Adapter adapter( longImage, longDomain, id, threshold );
+      REQUIRE( checkSpans( adapter ) == 0 );
+    }
+
+  SECTION( "ConstImageAdapter with a value functor without span form" )
+    {
+      typedef ConstImageAdapter<Image, Z3i::Domain, functors::Identity, int, Square> Adapter;
+      functors::Identity id;
+      Square square;
+      Adapter adapter( image, domain, id, square );
+      REQUIRE( checkSpans( adapter ) == 0 );
+    }
+
+  SECTION( "ConstImageAdapter with a domain functor and default values" )
+    {
+      typedef ConstImageAdapter<Image, Z3i::Domain, Shift, int, functors::Identity> Adapter;
+      Shift shift;
+      functors::Identity id;
+      Adapter adapter( image, domain, shift, id );
+      adapter.setDefaultValue( -1 );
+      REQUIRE( checkSpans( adapter ) == 0 );
+    }
+
+  SECTION( "Nested ConstImageAdapter" )
+    {
+      typedef functors::Cast<unsigned char> Cast;
+      typedef ConstImageAdapter<Image, Z3i::Domain, functors::Identity, unsigned char, Cast> Adapter;
+      typedef functors::Thresholder<unsigned char> Threshold;
+      typedef ConstImageAdapter<Adapter, Z3i::Domain, functors::Identity, bool, Threshold> Adapter2;
+      functors::Identity id;
+      Cast cast;
+      Threshold threshold( 5 );
+      Adapter adapter( image, domain, id, cast );
+      Adapter2 adapter2( adapter, domain, id, threshold );
+      REQUIRE( checkSpans( adapter2 ) == 0 );
+    }
+
+  SECTION( "ImageAdapter" )
+    {
+      typedef functors::Cast<double> Cast;
+      typedef functors::Cast<int> CastBack;
+      typedef ImageAdapter<Image, Z3i::Domain, functors::Identity, double, Cast, CastBack> Adapter;
+      functors::Identity id;
+      Cast cast;
+      CastBack castBack;
+      Adapter adapter( image, domain, id, cast, castBack );
+      REQUIRE( checkSpans( adapter ) == 0 );
+    }
+}
+
+TEST_CASE( "Set extraction through span evaluation" )
+{
+  typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+  const Z3i::Domain domain( Z3i::Point( -4, 1, 0 ), Z3i::Point( 13, 9, 6 ) );
+  Image image( domain );
+  fillImage( image );
+
+  // Reference sets computed point by point.
+  std::vector<Z3i::Point> refLower, refInterval, refOpenInterval, refGreater;
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+    {
+      const int v = image( *it );
+      if ( v <= 8 ) refLower.push_back( *it );
+      if ( v >= 4 && v <= 15 ) refInterval.push_back( *it );
+      if ( v > 4 && v <= 15 ) refOpenInterval.push_back( *it );
+      if ( v > 10 ) refGreater.push_back( *it );
+    }
+
+  SECTION( "setFromImage with a threshold" )
+    {
+      std::vector<Z3i::Point> points;
+      setFromImage( image, std::back_inserter( points ), 8 );
+      REQUIRE( points == refLower );
+    }
+
+  SECTION( "setFromImage with an interval" )
+    {
+      std::vector<Z3i::Point> points;
+      setFromImage( image, std::back_inserter( points ), 4, 15 );
+      REQUIRE( points == refInterval );
+    }
+
+  SECTION( "SetFromImage with an interval" )
+    {
+      Z3i::DigitalSet set( domain );
+      SetFromImage<Z3i::DigitalSet>::append<Image>( set, image, 4, 15 );
+      REQUIRE( set.size() == refOpenInterval.size() );
+      unsigned int nbok = 0;
+      for ( std::size_t i = 0; i < refOpenInterval.size(); ++i )
+        nbok += ( set( refOpenInterval[ i ] ) ) ? 1 : 0;
+      REQUIRE( nbok == refOpenInterval.size() );
+    }
+
+  SECTION( "SetFromImage with a simple threshold" )
+    {
+      Z3i::DigitalSet set( domain );
+      functors::SimpleThresholdForegroundPredicate<Image> isForeground( image, 10 );
+      SetFromImage<Z3i::DigitalSet>::append( set, image, isForeground );
+      REQUIRE( set.size() == refGreater.size() );
+      unsigned int nbok = 0;
+      for ( std::size_t i = 0; i < refGreater.size(); ++i )
+        nbok += ( set( refGreater[ i ] ) ) ? 1 : 0;
+      REQUIRE( nbok == refGreater.size() );
+    }
+
+  SECTION( "SetFromImage and setFromImage on a bool image" )
+    {
+      typedef ImageContainerBySTLVector<Z3i::Domain, bool> BoolImage;
+      BoolImage boolImage( domain );
+      std::vector<Z3i::Point> refFalse;
+      for ( Z3i::Domain::ConstIterator it = domain.begin(), itEnd = domain.end(); it != itEnd; ++it )
+        {
+          boolImage.setValue( *it, image( *it ) > 10 );
+          if ( image( *it ) <= 10 ) refFalse.push_back( *it );
+        }
+
+      Z3i::DigitalSet set( domain );
+      SetFromImage<Z3i::DigitalSet>::append<BoolImage>( set, boolImage, false, true );
+      REQUIRE( set.size() == refGreater.size() );
+      unsigned int nbok = 0;
+      for ( std::size_t i = 0; i < refGreater.size(); ++i )
+        nbok += ( set( refGreater[ i ] ) ) ? 1 : 0;
+      REQUIRE( nbok == refGreater.size() );
+
+      std::vector<Z3i::Point> points;
+      setFromImage( boolImage, std::back_inserter( points ), false );
+      REQUIRE( points == refFalse );
+    }
+}
+
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
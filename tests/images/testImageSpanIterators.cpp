@@ -121,10 +121,63 @@ bool testSpanIterators()
 
 
 
+bool testBlockedSpanIterators()
+{
+    typedef SpaceND<3> Space3Type;
+    typedef Space3Type::Point Point;
+    typedef HyperRectDomain<Space3Type> TDomain;
+    typedef ImageContainerBySTLVector<TDomain, double, BlockedStorage<2> > TContainerV;
+
+    unsigned int nb = 0;
+    unsigned int nbok = 0;
+
+    trace.beginBlock("Test of span iterators with blocked storage");
+    const TDomain domain( Point( -1, 2, 0 ), Point( 9, 7, 4 ) );
+    TContainerV myImageV ( domain );
+
+    double cpt=0;
+    for ( TDomain::ConstIterator it = domain.begin(), itend = domain.end();
+          it != itend; ++it )
+      myImageV.setValue( *it, cpt++ );
+
+    // The range follows the domain order.
+    cpt = 0;
+    for ( TContainerV::ConstRange::ConstIterator it = myImageV.constRange().begin(),
+            itend = myImageV.constRange().end(); it != itend; ++it, ++nb )
+      nbok += ( *it == cpt++ ) ? 1 : 0;
+
+    // Span iterators along each dimension.
+    for ( TDomain::ConstIterator it = domain.begin(), itend = domain.end();
+          it != itend; ++it )
+      for ( TDomain::Dimension k = 0; k < 3; ++k )
+        {
+          if ( (*it)[ k ] != domain.lowerBound()[ k ] ) continue;
+          Point p = *it;
+          for ( TContainerV::SpanIterator sit = myImageV.spanBegin( *it, k ), sitend = myImageV.spanEnd( *it, k );
+                sit != sitend; ++sit, ++p[ k ], ++nb )
+            nbok += ( *sit == myImageV( p ) ) ? 1 : 0;
+          nbok += ( p[ k ] == domain.upperBound()[ k ] + 1 ) ? 1 : 0;
+          ++nb;
+        }
+
+    // Writing through span iterators.
+    const Point c( 0, 3, 2 );
+    for ( TContainerV::SpanIterator it = myImageV.spanBegin(c,1), itend = myImageV.spanEnd(c,1);
+          it != itend; ++it )
+      myImageV.setValue(it, 12);
+    for ( Point p = c; p[1] <= 7; ++p[1], ++nb )
+      nbok += ( myImageV( p ) == 12 ) ? 1 : 0;
+
+    trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+    trace.endBlock();
+
+    return nbok == nb;
+}
+
 int main()
 {
 
-    if ( testSpanIterators())
+    if ( testSpanIterators() && testBlockedSpanIterators() )
         return 0;
     else
         return 1;
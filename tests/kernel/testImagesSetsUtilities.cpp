@@ -34,12 +34,15 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 #include <iostream>
+#include <vector>
+#include <iterator>
 #include "DGtal/base/Common.h"
 
 #include "DGtal/images/imagesSetsUtils/ImageFromSet.h"
 #include "DGtal/images/imagesSetsUtils/SetFromImage.h"
 
 #include "DGtal/kernel/sets/DigitalSetInserter.h"
+#include "DGtal/kernel/sets/DigitalSetBySTLVector.h"
 #include "DGtal/images/ImageHelper.h"
 
 #include "DGtal/images/ImageContainerBySTLMap.h"
@@ -72,6 +75,18 @@ struct Norm1
   }
 };
 
+template <typename P>
+struct OddNorm1
+{
+  typedef P Point;
+  typedef bool Value;
+
+  Value operator()(const Point& p)
+  {
+    return p.norm1() % 2 == 1;
+  }
+};
+
 /**
  * Example of a test. To be completed.
  *
@@ -221,6 +236,96 @@ bool testSetFromImage()
   return nbok == nb;
 }
 
+bool testParallelConversions()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing parallel conversions ..." );
+
+  typedef ImageContainerBySTLVector<Domain,int> Image;
+  Domain d(Point(-5,3), Point(60,50));
+  Image image(d);
+  for (Domain::ConstIterator it = d.begin(); it != d.end(); ++it)
+    image.setValue(*it, (7*(*it)[0] + 13*(*it)[1]) % 23);
+
+  //setFromImage
+  std::vector<Point> seq, par;
+  setFromImage( image, std::back_inserter(seq), 8 );
+  setFromImageParallel( image, std::back_inserter(par), 8 );
+  nbok += ( (seq == par) && (!seq.empty()) ) ? 1 : 0;
+  nb++;
+  seq.clear(); par.clear();
+  setFromImage( image, std::back_inserter(seq), 4, 15 );
+  setFromImageParallel( image, std::back_inserter(par), 4, 15 );
+  nbok += ( (seq == par) && (!seq.empty()) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  //SetFromImage: sorted vector-based set
+  DigitalSet aSet(d);
+  SetFromImage<DigitalSet>::append<Image>(aSet, image, 4, 15);
+  DigitalSetBySTLVector<Domain> aSetVector(d);
+  SetFromImage< DigitalSetBySTLVector<Domain> >::appendParallel<Image>(aSetVector, image, 4, 15);
+  bool inside = true;
+  for (DigitalSet::ConstIterator it = aSet.begin(); it != aSet.end(); ++it)
+    inside = inside && (aSetVector.find(*it) != aSetVector.end());
+  bool ordered = true;
+  Domain::ConstIterator itd = d.begin();
+  for (DigitalSetBySTLVector<Domain>::ConstIterator it = aSetVector.begin(); it != aSetVector.end(); ++it)
+    {
+      while ( (itd != d.end()) && (*itd != *it) ) ++itd;
+      ordered = ordered && (itd != d.end());
+    }
+  nbok += ( inside && ordered && (aSet.size() == aSetVector.size()) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  //setFromPointsRangeAndPredicate
+  std::vector<Point> points(d.begin(), d.end());
+  typedef std::equal_to<Image::Value> EqualBinaryFunctor;
+  typedef std::binder2nd<EqualBinaryFunctor> ValuePredicate;
+  ValuePredicate equalTo1 (EqualBinaryFunctor(),1);
+  functors::PointFunctorPredicate<Image, ValuePredicate> pred(image, equalTo1);
+  seq.clear(); par.clear();
+  setFromPointsRangeAndPredicate( points.begin(), points.end(), std::back_inserter(seq), pred );
+  setFromPointsRangeAndPredicateParallel( points.begin(), points.end(), std::back_inserter(par), pred );
+  nbok += ( (seq == par) && (!seq.empty()) ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  //imageFromRangeAndValue and imageFromFunctor
+  Image image2(d), image3(d);
+  imageFromRangeAndValue( seq.begin(), seq.end(), image2, 128 );
+  imageFromRangeAndValueParallel( seq.begin(), seq.end(), image3, 128 );
+  nbok += std::equal( image2.begin(), image2.end(), image3.begin() ) ? 1 : 0;
+  nb++;
+  Norm1<Point> n;
+  imageFromFunctor( image2, n );
+  imageFromFunctorParallel( image3, n );
+  nbok += std::equal( image2.begin(), image2.end(), image3.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  //bit-packed output images
+  typedef ImageContainerBySTLVector<Domain,bool> BoolImage;
+  BoolImage boolImage2(d), boolImage3(d);
+  imageFromRangeAndValue( seq.begin(), seq.end(), boolImage2, true );
+  imageFromRangeAndValueParallel( seq.begin(), seq.end(), boolImage3, true );
+  nbok += std::equal( boolImage2.begin(), boolImage2.end(), boolImage3.begin() ) ? 1 : 0;
+  nb++;
+  OddNorm1<Point> odd;
+  imageFromFunctor( boolImage2, odd );
+  imageFromFunctorParallel( boolImage3, odd );
+  nbok += std::equal( boolImage2.begin(), boolImage2.end(), boolImage3.begin() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") " << std::endl;
+
+  trace.endBlock();
+
+  return nbok == nb;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Standard services - public :
 
@@ -232,7 +337,7 @@ int main( int argc, char** argv )
     trace.info() << " " << argv[ i ];
   trace.info() << endl;
 
-  bool res = testImageFromSet() && testSetFromImage();
+  bool res = testImageFromSet() && testSetFromImage() && testParallelConversions();
   trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
   trace.endBlock();
   return res ? 0 : 1;
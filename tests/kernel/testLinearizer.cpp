@@ -32,6 +32,7 @@
 
 #include <cstddef>
 #include <cmath>
+#include <vector>
 
 #include "DGtalCatch.h"
 
@@ -347,3 +348,68 @@ BENCH_LINEARIZER( 2, RowMajorStorage )
 BENCH_LINEARIZER( 3, RowMajorStorage )
 BENCH_LINEARIZER( 4, RowMajorStorage )
 BENCH_LINEARIZER( 5, RowMajorStorage )
+
+#define TEST_BLOCKED_LINEARIZER( N , L ) \
+TEST_CASE( "Testing Linearizer in dimension " #N " with BlockedStorage<" #L ">", "[test][dim" #N "][BlockedStorage]" )\
+{\
+\
+  typedef SpaceND<N>              Space;\
+  typedef HyperRectDomain<Space>  Domain;\
+  typedef Space::Point   Point;\
+\
+  typedef Linearizer<Domain, BlockedStorage<L> >   NewLinearizer;\
+\
+  std::size_t size = 1e3;\
+\
+  Point lowerBound;\
+  for ( std::size_t i = 0 ; i < N ; ++i )\
+    lowerBound[i] = 1 + 7*i;\
+\
+  std::size_t dim_size = std::size_t( std::pow( double(size), 1./N ) + 0.5 );\
+  Point upperBound;\
+  for ( std::size_t i = 0; i < N ; ++i )\
+    upperBound[i] = lowerBound[i] + dim_size + i;\
+\
+  Domain domain( lowerBound, upperBound );\
+  Point extent = upperBound - lowerBound + Point::diagonal(1);\
+  const std::size_t storageSize = NewLinearizer::getStorageSize( extent );\
+  const std::size_t blockVolume = std::size_t(1) << ( L * N );\
+\
+  REQUIRE( storageSize >= domain.size() );\
+  REQUIRE( storageSize % blockVolume == 0 );\
+\
+  SECTION( "Testing getIndex and getPoint consistency" )\
+    {\
+      std::vector<bool> used( storageSize, false );\
+      for ( Domain::ConstIterator it = domain.begin(), it_end = domain.end(); it != it_end ; ++it )\
+        {\
+          const std::size_t id = NewLinearizer::getIndex( *it, lowerBound, extent );\
+          REQUIRE( id < storageSize );\
+          REQUIRE( ! used[ id ] );\
+          used[ id ] = true;\
+          REQUIRE( id == NewLinearizer::getIndex( *it - lowerBound, extent ) );\
+          REQUIRE( id == NewLinearizer::getIndex( *it, domain ) );\
+          REQUIRE( NewLinearizer::getPoint( id, lowerBound, extent ) == *it );\
+          REQUIRE( ( NewLinearizer::getPoint( id, extent ) + lowerBound ) == *it );\
+          REQUIRE( NewLinearizer::getPoint( id, domain ) == *it );\
+        }\
+    }\
+\
+  SECTION( "Testing that blocks are contiguous" )\
+    {\
+      for ( Domain::ConstIterator it = domain.begin(), it_end = domain.end(); it != it_end ; ++it )\
+        {\
+          Point blockOrigin = *it - lowerBound;\
+          for ( std::size_t i = 0; i < N; ++i )\
+            blockOrigin[i] = ( blockOrigin[i] >> L ) << L;\
+          const std::size_t id = NewLinearizer::getIndex( *it - lowerBound, extent );\
+          REQUIRE( id / blockVolume == NewLinearizer::getIndex( blockOrigin, extent ) / blockVolume );\
+        }\
+    }\
+}
+
+TEST_BLOCKED_LINEARIZER( 1, 2 )
+TEST_BLOCKED_LINEARIZER( 2, 2 )
+TEST_BLOCKED_LINEARIZER( 3, 2 )
+TEST_BLOCKED_LINEARIZER( 3, 3 )
+TEST_BLOCKED_LINEARIZER( 4, 1 )
@@ -0,0 +1,323 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testMarchingCubesMeshExtractor.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class MarchingCubesMeshExtractor.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include <set>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#ifdef WITH_OPENMP
+#include <omp.h>
+#endif
+#include "DGtal/base/Common.h"
+#include "DGtal/base/BasicFunctors.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/kernel/CanonicEmbedder.h"
+#include "DGtal/kernel/RegularPointEmbedder.h"
+#include "DGtal/images/ImageContainerBySTLVector.h"
+#include "DGtal/images/ImageLinearCellEmbedder.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/MarchingCubesMeshExtractor.h"
+#include "DGtal/topology/SetOfSurfels.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImageContainerBySTLVector<Z3i::Domain, int> Image;
+typedef CanonicEmbedder<Z3i::Space> Embedder;
+typedef MarchingCubesMeshExtractor<Z3i::Space, Image, Embedder> ImageExtractor;
+typedef ImageExtractor::OutputMesh RealMesh;
+typedef RealMesh::MeshFace MeshFace;
+
+/// @return the cycle \a face rotated so that it starts with its smallest index.
+MeshFace normalizedCycle( MeshFace face )
+{
+  std::rotate( face.begin(), std::min_element( face.begin(), face.end() ), face.end() );
+  return face;
+}
+
+/// @return the number of directed edges of the faces of \a mesh that
+/// are not matched by exactly one opposite edge.
+unsigned int nbUnmatchedEdges( const RealMesh & mesh )
+{
+  std::map< std::pair<unsigned int, unsigned int>, int > edges;
+  for ( unsigned int f = 0; f < mesh.nbFaces(); ++f )
+    {
+      const MeshFace & face = mesh.getFace( f );
+      for ( unsigned int i = 0; i < face.size(); ++i )
+        edges[ std::make_pair( face[ i ], face[ ( i + 1 ) % face.size() ] ) ] += 1;
+    }
+  unsigned int nb = 0;
+  for ( std::map< std::pair<unsigned int, unsigned int>, int >::const_iterator it = edges.begin();
+        it != edges.end(); ++it )
+    {
+      std::map< std::pair<unsigned int, unsigned int>, int >::const_iterator
+        itO = edges.find( std::make_pair( it->first.second, it->first.first ) );
+      if ( it->second != 1 || itO == edges.end() || itO->second != 1 ) ++nb;
+    }
+  return nb;
+}
+
+/// @return the volume enclosed by the faces of \a mesh, by fans of triangles.
+double enclosedVolume( const RealMesh & mesh )
+{
+  double volume = 0.0;
+  for ( unsigned int f = 0; f < mesh.nbFaces(); ++f )
+    {
+      const MeshFace & face = mesh.getFace( f );
+      const Z3i::RealPoint & a = mesh.getVertex( face[ 0 ] );
+      for ( unsigned int i = 1; i + 1 < face.size(); ++i )
+        volume += a.dot( mesh.getVertex( face[ i ] ).crossProduct( mesh.getVertex( face[ i + 1 ] ) ) ) / 6.0;
+    }
+  return volume;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class MarchingCubesMeshExtractor.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Compares the mesh of a random binary image with the umbrellas of
+ * its digital surface, for the interior and the exterior adjacencies.
+ */
+bool testRandomImage()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing MarchingCubesMeshExtractor on a random image ..." );
+
+  const Z3i::Domain domain( Z3i::Point( 0, 0, 0 ), Z3i::Point( 13, 11, 15 ) );
+  Image image( domain );
+  Z3i::DigitalSet set( domain );
+  srand( 7 );
+  for ( Z3i::Domain::ConstIterator it = domain.begin(), itE = domain.end(); it != itE; ++it )
+    {
+      const Z3i::Point & p = *it;
+      const bool border = p[ 0 ] == 0 || p[ 1 ] == 0 || p[ 2 ] == 0
+        || p[ 0 ] == 13 || p[ 1 ] == 11 || p[ 2 ] == 15;
+      const int value = ( ! border && rand() % 2 == 0 ) ? 1 : 0;
+      image.setValue( p, value );
+      if ( value == 1 ) set.insert( p );
+    }
+  Z3i::KSpace K;
+  K.init( domain.lowerBound(), domain.upperBound(), true );
+  Embedder embedder;
+  ImageLinearCellEmbedder<Z3i::KSpace, Image, Embedder> cellEmbedder;
+  cellEmbedder.init( K, image, embedder, 0.5 );
+
+  for ( unsigned int adj = 0; adj < 2; ++adj )
+    {
+      const bool interiorAdjacency = adj == 0;
+      trace.info() << ( interiorAdjacency ? "interior" : "exterior" ) << " adjacency" << std::endl;
+      ImageExtractor extractor( image, embedder, 0.5, false, interiorAdjacency );
+      RealMesh mesh;
+      extractor.extract( mesh, domain );
+
+      typedef SetOfSurfels<Z3i::KSpace, Z3i::KSpace::SurfelSet> Container;
+      typedef DigitalSurface<Container> Surface;
+      Container container( K, SurfelAdjacency<3>( interiorAdjacency ) );
+      Surfaces<Z3i::KSpace>::sMakeBoundary( container.surfelSet(), K, set,
+                                            domain.lowerBound(), domain.upperBound() );
+      Surface surface( container );
+      const Surface::FaceSet faces = surface.allClosedFaces();
+      trace.info() << "mesh: " << mesh.nbVertex() << " vertices, " << mesh.nbFaces() << " faces"
+                   << ", surface: " << surface.size() << " surfels, " << faces.size() << " faces"
+                   << std::endl;
+      nbok += mesh.nbVertex() == surface.size() ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "one vertex per surfel" << std::endl;
+      nbok += mesh.nbFaces() == faces.size() ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "one face per umbrella" << std::endl;
+
+      // vertices are identified by their position, unique on a binary image.
+      std::map<Z3i::RealPoint, unsigned int> vertexOf;
+      for ( unsigned int v = 0; v < mesh.nbVertex(); ++v )
+        vertexOf[ mesh.getVertex( v ) ] = v;
+      bool positions = vertexOf.size() == mesh.nbVertex();
+      for ( Surface::ConstIterator it = surface.begin(), itE = surface.end(); it != itE; ++it )
+        positions = positions && vertexOf.count( cellEmbedder.embedSCell( *it ) ) == 1;
+      nbok += positions ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "vertices are the embedded surfels" << std::endl;
+
+      std::set<MeshFace> meshFaces;
+      for ( unsigned int f = 0; f < mesh.nbFaces(); ++f )
+        meshFaces.insert( normalizedCycle( mesh.getFace( f ) ) );
+      unsigned int nbSame = 0;
+      unsigned int nbReversed = 0;
+      for ( Surface::FaceSet::const_iterator it = faces.begin(), itE = faces.end(); it != itE; ++it )
+        {
+          const Surface::VertexRange umbrella = surface.verticesAroundFace( *it );
+          MeshFace face;
+          for ( Surface::VertexRange::const_iterator itV = umbrella.begin(); itV != umbrella.end(); ++itV )
+            face.push_back( vertexOf[ cellEmbedder.embedSCell( *itV ) ] );
+          nbSame += meshFaces.count( normalizedCycle( face ) );
+          std::reverse( face.begin(), face.end() );
+          nbReversed += meshFaces.count( normalizedCycle( face ) );
+        }
+      trace.info() << "umbrellas found as faces: " << nbSame << " same order, "
+                   << nbReversed << " reversed" << std::endl;
+      nbok += ( nbSame == faces.size() || nbReversed == faces.size() ) ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "faces are the umbrellas" << std::endl;
+
+      nbok += nbUnmatchedEdges( mesh ) == 0 ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "faces are consistently oriented" << std::endl;
+      const double volume = enclosedVolume( mesh );
+      trace.info() << "volume=" << volume << " nb voxels=" << set.size() << std::endl;
+      nbok += volume > 0.0 ? 1 : 0;
+      nb++;
+      trace.info() << "(" << nbok << "/" << nb << ") "
+                   << "faces are oriented outward" << std::endl;
+    }
+  trace.endBlock();
+  return nbok == nb;
+}
+
+/**
+ * Meshes an implicit ball, checks its topology, volume and normals,
+ * and that the mesh does not depend on the number of threads.
+ */
+bool testImplicitBall()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+  trace.beginBlock ( "Testing MarchingCubesMeshExtractor on an implicit ball ..." );
+
+  //! [testMarchingCubesMeshExtractorBall]
+  typedef ImplicitBall<Z3i::Space> Ball;
+  typedef RegularPointEmbedder<Z3i::Space> PointEmbedder;
+  typedef functors::Composer<PointEmbedder, Ball, double> Function;
+  typedef MarchingCubesMeshExtractor<Z3i::Space, Function, PointEmbedder> Extractor;
+  const double radius = 1.0;
+  const double h = 0.05;
+  Ball ball( Z3i::RealPoint( 0.01, 0.02, 0.03 ), radius );
+  PointEmbedder embedder;
+  embedder.init( h );
+  Function f( embedder, ball );
+  const Z3i::Domain domain( Z3i::Point::diagonal( -25 ), Z3i::Point::diagonal( 25 ) );
+  Extractor extractor( f, embedder, 0.0, false );
+  trace.info() << extractor << std::endl;
+
+  RealMesh mesh;
+  std::vector<Z3i::RealVector> normals;
+  extractor.extract( mesh, domain, normals );
+  //! [testMarchingCubesMeshExtractorBall]
+  unsigned int nbEdges = 0;
+  for ( unsigned int i = 0; i < mesh.nbFaces(); ++i )
+    nbEdges += mesh.getFace( i ).size();
+  nbEdges /= 2;
+  const int euler = static_cast<int>( mesh.nbVertex() ) - static_cast<int>( nbEdges )
+    + static_cast<int>( mesh.nbFaces() );
+  trace.info() << "mesh: " << mesh.nbVertex() << " vertices, " << nbEdges << " edges, "
+               << mesh.nbFaces() << " faces, euler=" << euler << std::endl;
+  nbok += ( euler == 2 && nbUnmatchedEdges( mesh ) == 0 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "closed oriented surface of genus 0" << std::endl;
+
+  const double volume = enclosedVolume( mesh );
+  const double expected = 4.0 * M_PI * radius * radius * radius / 3.0;
+  trace.info() << "volume=" << volume << " expected=" << expected << std::endl;
+  nbok += std::fabs( volume - expected ) < 0.01 * expected ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "volume is close to the ball volume" << std::endl;
+
+  double maxDistance = 0.0;
+  double minCos = 1.0;
+  for ( unsigned int v = 0; v < mesh.nbVertex(); ++v )
+    {
+      const Z3i::RealVector d = mesh.getVertex( v ) - Z3i::RealPoint( 0.01, 0.02, 0.03 );
+      maxDistance = std::max( maxDistance, std::fabs( d.norm() - radius ) );
+      minCos = std::min( minCos, normals[ v ].dot( d ) / d.norm() );
+    }
+  trace.info() << "max distance to sphere=" << maxDistance
+               << " min cos(normal, expected)=" << minCos << std::endl;
+  nbok += ( normals.size() == mesh.nbVertex() && maxDistance < 0.1 * h && minCos > 0.999 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "vertices are on the sphere with outward normals" << std::endl;
+
+#ifdef WITH_OPENMP
+  const int nbThreads = omp_get_max_threads();
+  omp_set_num_threads( 3 );
+#endif
+  RealMesh other;
+  other.addVertex( Z3i::RealPoint( 5.0, 5.0, 5.0 ) );
+  extractor.extract( other, domain );
+#ifdef WITH_OPENMP
+  omp_set_num_threads( nbThreads );
+#endif
+  bool same = other.nbVertex() == mesh.nbVertex() + 1 && other.nbFaces() == mesh.nbFaces();
+  for ( unsigned int v = 0; same && v < mesh.nbVertex(); ++v )
+    same = other.getVertex( v + 1 ) == mesh.getVertex( v );
+  for ( unsigned int i = 0; same && i < mesh.nbFaces(); ++i )
+    {
+      MeshFace face = mesh.getFace( i );
+      for ( unsigned int j = 0; j < face.size(); ++j ) face[ j ] += 1;
+      same = other.getFace( i ) == face;
+    }
+  nbok += same ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "same mesh with 3 threads, appended to a non empty mesh" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class MarchingCubesMeshExtractor" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testRandomImage() && testImplicitBall();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,150 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Benchmark of breadth-first traversals of a digital surface, through
+ * its tracker (DigitalSurface) or through its precomputed CSR
+ * adjacency (DigitalSurfaceCSRGraph), and of the construction of the
+ * CSR adjacency.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <vector>
+#include <benchmark/benchmark.h>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurfaceCSRGraph.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace DGtal;
+
+typedef DigitalSetBoundary<Z3i::KSpace, Z3i::DigitalSet> Container;
+typedef DigitalSurface<Container> Surface;
+typedef DigitalSurfaceCSRGraph<Container> Graph;
+
+/// The boundary of a ball of radius 25.
+struct BallSurface
+{
+  BallSurface()
+    : domain( Z3i::Point::diagonal( -27 ), Z3i::Point::diagonal( 27 ) ),
+      set( domain )
+  {
+    Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 0, 0, 0 ), 25 );
+    K.init( domain.lowerBound(), domain.upperBound(), true );
+    surface = new Surface( new Container( K, set ) );
+  }
+  ~BallSurface() { delete surface; }
+
+  Z3i::Domain domain;
+  Z3i::DigitalSet set;
+  Z3i::KSpace K;
+  Surface* surface;
+};
+
+static BallSurface & ballSurface()
+{
+  static BallSurface ball;
+  return ball;
+}
+
+/// Breadth-first traversals of the whole surface, through the tracker.
+static void BM_BreadthFirstDigitalSurface( benchmark::State & state )
+{
+  const Surface & surface = *ballSurface().surface;
+  const Surface::Vertex bel = *surface.begin();
+  Graph::Size nb = 0;
+  while ( state.KeepRunning() )
+    {
+      for ( BreadthFirstVisitor<Surface> visitor( surface, bel ); ! visitor.finished(); visitor.expand() )
+        ++nb;
+    }
+  benchmark::DoNotOptimize( nb );
+  state.SetItemsProcessed( state.iterations() * surface.size() );
+}
+BENCHMARK( BM_BreadthFirstDigitalSurface )->Unit( benchmark::kMillisecond );
+
+/// Breadth-first traversals of the whole surface, through the CSR adjacency.
+static void BM_BreadthFirstCSRGraph( benchmark::State & state )
+{
+  const Graph graph( *ballSurface().surface );
+  Graph::Size nb = 0;
+  while ( state.KeepRunning() )
+    {
+      for ( BreadthFirstVisitor<Graph> visitor( graph, 0 ); ! visitor.finished(); visitor.expand() )
+        ++nb;
+    }
+  benchmark::DoNotOptimize( nb );
+  state.SetItemsProcessed( state.iterations() * graph.size() );
+}
+BENCHMARK( BM_BreadthFirstCSRGraph )->Unit( benchmark::kMillisecond );
+
+/// Breadth-first traversals of the whole surface, through the CSR
+/// adjacency and with marks stored in a vector.
+static void BM_BreadthFirstCSRGraphArrays( benchmark::State & state )
+{
+  const Graph graph( *ballSurface().surface );
+  std::vector<Graph::Vertex> queue( graph.size() );
+  std::vector<char> marks( graph.size() );
+  Graph::Size nb = 0;
+  while ( state.KeepRunning() )
+    {
+      std::fill( marks.begin(), marks.end(), 0 );
+      std::size_t first = 0, last = 0;
+      queue[ last++ ] = 0;
+      marks[ 0 ] = 1;
+      while ( first != last )
+        {
+          const Graph::Vertex v = queue[ first++ ];
+          ++nb;
+          for ( Graph::NeighborConstIterator it = graph.neighborsBegin( v ), itE = graph.neighborsEnd( v );
+                it != itE; ++it )
+            if ( ! marks[ *it ] )
+              {
+                marks[ *it ] = 1;
+                queue[ last++ ] = *it;
+              }
+        }
+    }
+  benchmark::DoNotOptimize( nb );
+  state.SetItemsProcessed( state.iterations() * graph.size() );
+}
+BENCHMARK( BM_BreadthFirstCSRGraphArrays )->Unit( benchmark::kMillisecond );
+
+/// Construction of the CSR adjacency.
+static void BM_BuildCSRGraph( benchmark::State & state )
+{
+  const Surface & surface = *ballSurface().surface;
+  while ( state.KeepRunning() )
+    {
+      Graph graph( surface );
+      benchmark::DoNotOptimize( graph.nbArcs() );
+    }
+  state.SetItemsProcessed( state.iterations() * surface.size() );
+}
+BENCHMARK( BM_BuildCSRGraph )->Unit( benchmark::kMillisecond );
+
+BENCHMARK_MAIN();
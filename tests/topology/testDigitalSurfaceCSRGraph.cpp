@@ -0,0 +1,293 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testDigitalSurfaceCSRGraph.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing class DigitalSurfaceCSRGraph and its boost
+ * graph interface.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <vector>
+#include <map>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/Shapes.h"
+#include "DGtal/topology/DigitalSurface.h"
+#include "DGtal/topology/DigitalSetBoundary.h"
+#include "DGtal/topology/DigitalSurfaceCSRGraph.h"
+#include "DGtal/graph/CUndirectedSimpleGraph.h"
+#include "DGtal/graph/BreadthFirstVisitor.h"
+#include "DGtal/graph/DistanceBreadthFirstVisitor.h"
+#include "DGtal/graph/DigitalSurfaceCSRGraphBoostGraphInterface.h"
+#include <boost/graph/graph_concepts.hpp>
+#include <boost/graph/breadth_first_search.hpp>
+#include <boost/graph/connected_components.hpp>
+#include <boost/property_map/property_map.hpp>
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef DigitalSetBoundary<Z3i::KSpace, Z3i::DigitalSet> Container;
+typedef DigitalSurface<Container> Surface;
+typedef DigitalSurfaceCSRGraph<Container> Graph;
+
+/**
+ * Euclidean distance of the vertices of the graph to a point.
+ */
+struct VertexDistance
+{
+  typedef Graph::Vertex Argument;
+  typedef double Value;
+
+  VertexDistance( const Graph & graph, const Z3i::Point & center )
+    : myGraph( &graph ), myCenter( 2 * center + Z3i::Point::diagonal( 1 ) ) {}
+
+  Value operator()( const Argument & v ) const
+  {
+    // Khalimsky coordinates are twice the coordinates
+    const Z3i::Point p = myGraph->surface().container().space().sKCoords( myGraph->surfel( v ) );
+    return 0.5 * ( p - myCenter ).norm();
+  }
+
+  const Graph* myGraph;
+  Z3i::Point myCenter;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class DigitalSurfaceCSRGraph.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testDigitalSurfaceCSRGraph()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing DigitalSurfaceCSRGraph ..." );
+  BOOST_CONCEPT_ASSERT(( concepts::CUndirectedSimpleGraph< Graph > ));
+  Z3i::Domain domain( Z3i::Point::diagonal( -12 ), Z3i::Point::diagonal( 12 ) );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 0, 0, 0 ), 10 );
+  Shapes<Z3i::Domain>::removeNorm2Ball( set, Z3i::Point( 0, 0, 0 ), 4 );
+  Z3i::KSpace K;
+  nbok += K.init( domain.lowerBound(), domain.upperBound(), true ) ? 1 : 0;
+  nb++;
+  Surface surface( new Container( K, set ) );
+  Graph graph( surface );
+  trace.info() << graph << std::endl;
+  nbok += ( graph.isValid() && graph.size() == surface.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "one vertex per surfel" << std::endl;
+
+  unsigned int nbIndexOk = 0;
+  unsigned int nbNeighborsOk = 0;
+  unsigned int nbSymmetricOk = 0;
+  for ( Graph::ConstIterator it = graph.begin(), itE = graph.end(); it != itE; ++it )
+    {
+      const Graph::Vertex v = *it;
+      nbIndexOk += ( graph.index( graph.surfel( v ) ) == v ) ? 1 : 0;
+      std::vector<Surface::Vertex> expected;
+      std::back_insert_iterator< std::vector<Surface::Vertex> > outExpected = std::back_inserter( expected );
+      surface.writeNeighbors( outExpected, graph.surfel( v ) );
+      std::vector<Graph::Vertex> neighbors;
+      std::back_insert_iterator< std::vector<Graph::Vertex> > outNeighbors = std::back_inserter( neighbors );
+      graph.writeNeighbors( outNeighbors, v );
+      bool ok = neighbors.size() == expected.size() && graph.degree( v ) == surface.degree( graph.surfel( v ) );
+      bool symmetric = true;
+      for ( unsigned int i = 0; ok && i < neighbors.size(); ++i )
+        {
+          ok = graph.surfel( neighbors[ i ] ) == expected[ i ];
+          symmetric = symmetric
+            && std::find( graph.neighborsBegin( neighbors[ i ] ), graph.neighborsEnd( neighbors[ i ] ), v )
+            != graph.neighborsEnd( neighbors[ i ] );
+        }
+      nbNeighborsOk += ok ? 1 : 0;
+      nbSymmetricOk += symmetric ? 1 : 0;
+    }
+  nbok += ( nbIndexOk == graph.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "index( surfel( v ) ) == v" << std::endl;
+  nbok += ( nbNeighborsOk == graph.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "neighbors are the ones of DigitalSurface::writeNeighbors" << std::endl;
+  nbok += ( nbSymmetricOk == graph.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "adjacency is symmetric" << std::endl;
+  nbok += ( graph.index( K.sCell( Z3i::Point( 1, 1, 1 ), K.POS ) ) == graph.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "index of a cell outside the surface is size()" << std::endl;
+
+  // breadth-first traversals of the graph and of the surface.
+  const Surface::Vertex bel = graph.surfel( 0 );
+  std::map<Surface::Vertex, Graph::Size> surfaceDistances;
+  BreadthFirstVisitor<Surface> surfaceVisitor( surface, bel );
+  for ( ; ! surfaceVisitor.finished(); surfaceVisitor.expand() )
+    surfaceDistances[ surfaceVisitor.current().first ] = surfaceVisitor.current().second;
+  std::vector<Graph::Size> graphDistances( graph.size(), 0 );
+  unsigned int nbVisited = 0;
+  BreadthFirstVisitor<Graph> graphVisitor( graph, 0 );
+  for ( ; ! graphVisitor.finished(); graphVisitor.expand(), ++nbVisited )
+    graphDistances[ graphVisitor.current().first ] = graphVisitor.current().second;
+  unsigned int nbSameDistance = 0;
+  for ( Graph::Vertex v = 0; v < graph.size(); ++v )
+    nbSameDistance += ( surfaceDistances.count( graph.surfel( v ) ) != 0
+                        && surfaceDistances[ graph.surfel( v ) ] == graphDistances[ v ] ) ? 1 : 0;
+  trace.info() << "visited " << nbVisited << " / " << surfaceDistances.size() << std::endl;
+  nbok += ( nbVisited == surfaceDistances.size() && nbSameDistance == nbVisited ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "BreadthFirstVisitor gives the same distances on the graph and the surface" << std::endl;
+
+  // geodesic neighborhood within a Euclidean ball.
+  typedef DistanceBreadthFirstVisitor<Graph, VertexDistance> DistanceVisitor;
+  const Z3i::Point center = K.sCoords( K.sDirectIncident( bel, K.sOrthDir( bel ) ) );
+  VertexDistance distance( graph, center );
+  DistanceVisitor distanceVisitor( graph, distance, 0 );
+  unsigned int nbInBall = 0;
+  bool ordered = true;
+  double last = 0.0;
+  while ( ! distanceVisitor.finished() )
+    {
+      const DistanceVisitor::Node node = distanceVisitor.current();
+      if ( node.second > 3.0 ) break;
+      ordered = ordered && node.second >= last;
+      last = node.second;
+      ++nbInBall;
+      distanceVisitor.expand();
+    }
+  trace.info() << "ball of radius 3: " << nbInBall << " surfels" << std::endl;
+  nbok += ( ordered && nbInBall > 20 && nbInBall < graph.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "DistanceBreadthFirstVisitor visits vertices by increasing distance" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testDigitalSurfaceCSRGraphBoostGraphInterface()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef boost::graph_traits<Graph>::vertex_descriptor vertex_descriptor;
+  typedef boost::graph_traits<Graph>::vertex_iterator vertex_iterator;
+  typedef boost::graph_traits<Graph>::edge_iterator edge_iterator;
+  typedef boost::graph_traits<Graph>::out_edge_iterator out_edge_iterator;
+  typedef boost::property_map<Graph, boost::vertex_index_t>::const_type IndexMap;
+  BOOST_CONCEPT_ASSERT(( boost::VertexListGraphConcept<Graph> ));
+  BOOST_CONCEPT_ASSERT(( boost::AdjacencyGraphConcept<Graph> ));
+  BOOST_CONCEPT_ASSERT(( boost::IncidenceGraphConcept<Graph> ));
+  BOOST_CONCEPT_ASSERT(( boost::EdgeListGraphConcept<Graph> ));
+
+  trace.beginBlock ( "Testing DigitalSurfaceCSRGraph as a boost graph ..." );
+  Z3i::Domain domain( Z3i::Point::diagonal( -12 ), Z3i::Point::diagonal( 12 ) );
+  Z3i::DigitalSet set( domain );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( -5, 0, 0 ), 4 );
+  Shapes<Z3i::Domain>::addNorm2Ball( set, Z3i::Point( 5, 0, 0 ), 4 );
+  Z3i::KSpace K;
+  nbok += K.init( domain.lowerBound(), domain.upperBound(), true ) ? 1 : 0;
+  nb++;
+  Surface surface( new Container( K, set ) );
+  Graph graph( surface );
+  trace.info() << graph << std::endl;
+
+  Graph::Offset nbEdges = 0;
+  bool edgesOk = true;
+  for ( std::pair<edge_iterator, edge_iterator> ve = boost::edges( graph ); ve.first != ve.second; ++ve.first, ++nbEdges )
+    edgesOk = edgesOk && boost::target( *ve.first, graph ) == graph.neighbors()[ nbEdges ]
+      && graph.offsets()[ boost::source( *ve.first, graph ) ] <= nbEdges
+      && nbEdges < graph.offsets()[ boost::source( *ve.first, graph ) + 1 ];
+  nbok += ( edgesOk && nbEdges == boost::num_edges( graph ) && nbEdges == graph.nbArcs() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "edges visits the " << nbEdges << " arcs" << std::endl;
+
+  Graph::Offset nbOutEdges = 0;
+  for ( std::pair<vertex_iterator, vertex_iterator> vp = boost::vertices( graph ); vp.first != vp.second; ++vp.first )
+    {
+      std::pair<out_edge_iterator, out_edge_iterator> ve = boost::out_edges( *vp.first, graph );
+      nbOutEdges += ( ve.second - ve.first == static_cast<std::ptrdiff_t>( boost::out_degree( *vp.first, graph ) ) )
+        ? boost::out_degree( *vp.first, graph ) : 0;
+    }
+  nbok += ( nbOutEdges == nbEdges ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "out_degree is the number of out_edges" << std::endl;
+
+  // boost breadth first search with vector property maps
+  IndexMap index = boost::get( boost::vertex_index, graph );
+  std::vector<Graph::Size> distances( boost::num_vertices( graph ), 0 );
+  std::vector<boost::default_color_type> colors( boost::num_vertices( graph ), boost::white_color );
+  boost::breadth_first_search
+    ( graph, vertex_descriptor( 0 ),
+      boost::visitor( boost::make_bfs_visitor
+                      ( boost::record_distances( boost::make_iterator_property_map( distances.begin(), index ),
+                                                 boost::on_tree_edge() ) ) )
+      .color_map( boost::make_iterator_property_map( colors.begin(), index ) ) );
+  std::vector<Graph::Size> dgtalDistances( graph.size(), 0 );
+  unsigned int nbVisited = 0;
+  for ( BreadthFirstVisitor<Graph> visitor( graph, 0 ); ! visitor.finished(); visitor.expand(), ++nbVisited )
+    dgtalDistances[ visitor.current().first ] = visitor.current().second;
+  nbok += ( distances == dgtalDistances && nbVisited < graph.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "boost::breadth_first_search == BreadthFirstVisitor" << std::endl;
+
+  std::vector<int> components( boost::num_vertices( graph ), 0 );
+  const int nbComponents = boost::connected_components
+    ( graph, boost::make_iterator_property_map( components.begin(), index ),
+      boost::color_map( boost::make_iterator_property_map( colors.begin(), index ) ) );
+  trace.info() << "nb components = " << nbComponents << std::endl;
+  nbok += ( nbComponents == 2 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "boost::connected_components finds the two balls" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class DigitalSurfaceCSRGraph" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testDigitalSurfaceCSRGraph()
+    && testDigitalSurfaceCSRGraphBoostGraphInterface();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,244 @@
+/**
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU Lesser General Public License as
+ *  published by the Free Software Foundation, either version 3 of the
+ *  License, or  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ **/
+
+/**
+ * @file testStreamingDigitalSurface.cpp
+ * @ingroup Tests
+ *
+ * @date 2026/10/18
+ *
+ * Functions for testing classes StreamingDigitalSurface and
+ * StreamingIntegralInvariantVolumeEstimator.
+ *
+ * This file is part of the DGtal library.
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+#include <iostream>
+#include <sstream>
+#include <iterator>
+#include <set>
+#include <vector>
+#include "DGtal/base/Common.h"
+#include "DGtal/helpers/StdDefs.h"
+#include "DGtal/shapes/implicit/ImplicitBall.h"
+#include "DGtal/shapes/GaussDigitizer.h"
+#include "DGtal/topology/helpers/Surfaces.h"
+#include "DGtal/topology/StreamingDigitalSurface.h"
+#include "DGtal/geometry/surfaces/estimation/IIGeometricFunctors.h"
+#include "DGtal/geometry/surfaces/estimation/IntegralInvariantVolumeEstimator.h"
+#include "DGtal/geometry/surfaces/estimation/StreamingIntegralInvariantVolumeEstimator.h"
+///////////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+using namespace DGtal;
+
+typedef ImplicitBall<Z3i::Space> ImplicitShape;
+typedef GaussDigitizer<Z3i::Space, ImplicitShape> DigitalShape;
+typedef StreamingDigitalSurface<Z3i::KSpace, DigitalShape> Streaming;
+
+/**
+ * Counts the surfels of each slice, checking they belong to it.
+ */
+struct SliceCounter
+{
+  SliceCounter( const Z3i::KSpace & K ) : myK( K ), myNbSurfels( 0 ), myNbSlices( 0 ), myOk( true ) {}
+
+  void operator()( const Streaming::SurfelRange & surfels, const Streaming::Window & window )
+  {
+    ++myNbSlices;
+    for ( Streaming::SurfelConstIterator it = surfels.begin(), itE = surfels.end(); it != itE; ++it )
+      {
+        const Z3i::Point p = myK.sCoords( myK.sDirectIncident( *it, myK.sOrthDir( *it ) ) );
+        myOk = myOk && p[ 2 ] >= window.lowerSlice() && p[ 2 ] <= window.upperSlice()
+          && window( p );
+        ++myNbSurfels;
+      }
+  }
+
+  const Z3i::KSpace & myK;
+  unsigned int myNbSurfels;
+  unsigned int myNbSlices;
+  bool myOk;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for testing class StreamingDigitalSurface.
+///////////////////////////////////////////////////////////////////////////////
+
+bool testStreamingDigitalSurface()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  trace.beginBlock ( "Testing StreamingDigitalSurface against Surfaces::sMakeBoundary ..." );
+  const double h = 0.5;
+  ImplicitShape ishape( Z3i::RealPoint( 0.3, -0.2, 0.1 ), 5.0 );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -6.0, -7.0, -8.0 ), Z3i::RealPoint( 6.0, 7.0, 8.0 ), h );
+  Z3i::KSpace K;
+  nbok += K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) ? 1 : 0;
+  nb++;
+
+  std::set<Z3i::SCell> boundary;
+  Surfaces<Z3i::KSpace>::sMakeBoundary( boundary, K, dshape,
+                                        K.lowerBound(), K.upperBound() );
+
+  Streaming streaming( K, dshape, 2 );
+  trace.info() << streaming << std::endl;
+  std::vector<Z3i::SCell> surfels;
+  streaming.writeSurfels( std::back_inserter( surfels ) );
+  const std::set<Z3i::SCell> streamed( surfels.begin(), surfels.end() );
+  trace.info() << "boundary=" << boundary.size() << " streamed=" << surfels.size() << std::endl;
+  nbok += ( ! boundary.empty() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "no surfel is streamed twice" << std::endl;
+  nbok += ( streamed.size() == surfels.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "streamed surfels == sMakeBoundary" << std::endl;
+  nbok += ( streamed == boundary ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "window size == (2*halo+2) * slice size" << std::endl;
+  nbok += ( streaming.windowSize() == 6 * streaming.sliceSize()
+            && streaming.sliceSize() == static_cast<Streaming::Size>( ( K.upperBound()[ 0 ] - K.lowerBound()[ 0 ] + 1 )
+                                                          * ( K.upperBound()[ 1 ] - K.lowerBound()[ 1 ] + 1 ) ) ) ? 1 : 0;
+  nb++;
+
+  SliceCounter counter( K );
+  streaming.scan( counter );
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "scan visits all the slices and surfels" << std::endl;
+  nbok += ( counter.myOk && counter.myNbSurfels == surfels.size()
+            && counter.myNbSlices == static_cast<unsigned int>( streaming.lastSlice() - streaming.firstSlice() + 1 ) ) ? 1 : 0;
+  nb++;
+
+  // without halo, the window is two slices
+  Streaming streaming0( K, dshape );
+  std::vector<Z3i::SCell> surfels0;
+  streaming0.writeSurfels( std::back_inserter( surfels0 ) );
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "streaming is independent of the halo" << std::endl;
+  nbok += ( surfels0 == surfels && streaming0.windowSize() == 2 * streaming0.sliceSize() ) ? 1 : 0;
+  nb++;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+bool testStreamingIntegralInvariantVolumeEstimator()
+{
+  unsigned int nbok = 0;
+  unsigned int nb = 0;
+
+  typedef functors::IIMeanCurvature3DFunctor<Z3i::Space> Functor;
+  typedef StreamingIntegralInvariantVolumeEstimator<Z3i::KSpace, Functor> StreamingEstimator;
+  typedef IntegralInvariantVolumeEstimator<Z3i::KSpace, DigitalShape, Functor> Estimator;
+
+  trace.beginBlock ( "Testing StreamingIntegralInvariantVolumeEstimator ..." );
+  const double h = 0.25;
+  const double radius = 5.0;
+  const double re = 2.0;
+  ImplicitShape ishape( Z3i::RealPoint( 0.0, 0.0, 0.0 ), radius );
+  DigitalShape dshape;
+  dshape.attach( ishape );
+  dshape.init( Z3i::RealPoint( -6.0, -6.0, -6.0 ), Z3i::RealPoint( 6.0, 6.0, 6.0 ), h );
+  Z3i::KSpace K;
+  nbok += K.init( dshape.getLowerBound(), dshape.getUpperBound(), true ) ? 1 : 0;
+  nb++;
+
+  StreamingEstimator streamingEstimator( K );
+  streamingEstimator.setParams( re / h );
+  streamingEstimator.init( h );
+  trace.info() << streamingEstimator << std::endl;
+
+  Streaming streaming( K, dshape, streamingEstimator.halo() );
+  trace.info() << streaming << std::endl;
+  std::vector<Z3i::SCell> surfels;
+  streaming.writeSurfels( std::back_inserter( surfels ) );
+  std::vector<double> values;
+  streaming.eval( streamingEstimator, std::back_inserter( values ) );
+  nbok += ( values.size() == surfels.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "one value per surfel" << std::endl;
+
+  // same kernel as the in-memory estimator
+  Estimator estimator;
+  estimator.attach( K, dshape );
+  estimator.setParams( re / h );
+  estimator.init( h, surfels.begin(), surfels.end() );
+  unsigned int nbSame = 0;
+  unsigned int nbWindow = 0;
+  double mean = 0.0;
+  for ( unsigned int i = 0; i < surfels.size(); ++i )
+    {
+      const double expected = estimator.eval( surfels.begin() + i );
+      nbSame += ( std::abs( expected - values[ i ] ) < 1e-10 ) ? 1 : 0;
+      nbWindow += ( streamingEstimator( surfels[ i ], dshape ) == values[ i ] ) ? 1 : 0;
+      mean += values[ i ];
+    }
+  mean /= static_cast<double>( values.size() );
+  nbok += ( nbSame == surfels.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "streamed == IntegralInvariantVolumeEstimator "
+               << nbSame << "/" << surfels.size() << std::endl;
+  nbok += ( nbWindow == surfels.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "window == full predicate "
+               << nbWindow << "/" << surfels.size() << std::endl;
+  trace.info() << "mean curvature = " << mean << " expected " << ( 1.0 / radius ) << std::endl;
+  nbok += ( std::abs( mean - 1.0 / radius ) < 0.03 ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "mean curvature is close to 1/R" << std::endl;
+
+  // results can be streamed out directly
+  std::ostringstream output;
+  streaming.eval( streamingEstimator, std::ostream_iterator<double>( output, "\n" ) );
+  std::istringstream input( output.str() );
+  std::vector<double> read( ( std::istream_iterator<double>( input ) ), std::istream_iterator<double>() );
+  nbok += ( read.size() == values.size() ) ? 1 : 0;
+  nb++;
+  trace.info() << "(" << nbok << "/" << nb << ") "
+               << "results written to an ostream_iterator" << std::endl;
+  trace.endBlock();
+  return nbok == nb;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Standard services - public :
+
+int main( int argc, char** argv )
+{
+  trace.beginBlock ( "Testing class StreamingDigitalSurface" );
+  trace.info() << "Args:";
+  for ( int i = 0; i < argc; ++i )
+    trace.info() << " " << argv[ i ];
+  trace.info() << endl;
+
+  bool res = testStreamingDigitalSurface()
+    && testStreamingIntegralInvariantVolumeEstimator();
+  trace.emphase() << ( res ? "Passed." : "Error." ) << endl;
+  trace.endBlock();
+  return res ? 0 : 1;
+}
+//                                                                           //
+///////////////////////////////////////////////////////////////////////////////